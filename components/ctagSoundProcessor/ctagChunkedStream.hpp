@@ -0,0 +1,62 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// rapidjson output stream with a small fixed buffer, each full buffer is handed to a sink (http chunks, uart),
+// so large json responses are never held in memory as a whole
+// use with rapidjson::Writer, call Flush after the writer is done
+
+#pragma once
+
+#include <cstddef>
+
+#define JSON_CHUNK_SZ 1024
+
+namespace CTAG {
+    namespace SP {
+        class ctagChunkedStream final {
+        public:
+            typedef char Ch;
+            // returns false if output failed, output is dropped from then on
+            typedef bool (*Sink)(void *ctx, const char *data, size_t len);
+
+            ctagChunkedStream(Sink s, void *c) : sink(s), ctx(c) {}
+
+            void Put(const Ch c) {
+                buf[n++] = c;
+                if (n == JSON_CHUNK_SZ) Flush();
+            }
+
+            void Flush() {
+                if (n > 0 && ok) ok = sink(ctx, buf, n);
+                n = 0;
+            }
+
+            bool IsOk() const { return ok; }
+
+        private:
+            Sink sink;
+            void *ctx;
+            size_t n {0};
+            bool ok {true};
+            char buf[JSON_CHUNK_SZ];
+        };
+    }
+}
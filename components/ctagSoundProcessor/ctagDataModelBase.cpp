@@ -27,13 +27,135 @@ respective component folders / files if different from this license.
 #include "rapidjson/writer.h"
 #include "rapidjson/filereadstream.h"
 #include <cstdio>
-#include <regex>
+#include <chrono>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 #include "ctagDataModelBase.hpp"
+#include "ctagPathMatch.hpp"
 
 #define MB_BUF_SZ 4096
+#define MB_DEBOUNCE_MS 2000
+#define MB_RETRY_MS 10000 // failed deferred writes are retried after this interval
+
+std::mutex CTAG::SP::ctagDataModelBase::writeMutex;
+std::mutex CTAG::SP::ctagDataModelBase::deferredMutex;
+std::map<string, CTAG::SP::ctagDataModelBase::DeferredWrite> CTAG::SP::ctagDataModelBase::deferred;
+bool CTAG::SP::ctagDataModelBase::deferredEnabled {false};
+std::mutex CTAG::SP::ctagDataModelBase::countMutex;
+std::map<string, uint32_t> CTAG::SP::ctagDataModelBase::writeCounts;
+
+// stream buffer is only held while a file is read or written, models don't keep it allocated
+char *CTAG::SP::ctagDataModelBase::acquireBuffer() {
+    char *buffer = (char *) heap_caps_malloc(MB_BUF_SZ, MALLOC_CAP_SPIRAM);
+    if (buffer == nullptr) ESP_LOGE("Model Base", "Fatal: Out of mem!");
+    return buffer;
+}
+
+// files are written to <fn>.tmp which is renamed to fn once complete, the temporary file is the journal of the write:
+// if it is found at boot (RecoverWrites), power was lost during the write, a complete temporary file (parses) is the newer
+// content and is committed, an incomplete one is discarded and fn is still the previous content
+FILE *CTAG::SP::ctagDataModelBase::beginWrite(const string &fn) {
+    FILE *f = fopen((fn + ".tmp").c_str(), "wb");
+    if (f == NULL) ESP_LOGE("JSON", "could not open file %s.tmp", fn.c_str());
+    return f;
+}
+
+bool CTAG::SP::ctagDataModelBase::commitWrite(FILE *f, const string &fn) {
+    const bool ok = fflush(f) == 0 && !ferror(f);
+#ifndef _WIN32
+    fsync(fileno(f));
+#endif
+    fclose(f);
+    const string tmp = fn + ".tmp";
+    if (!ok) {
+        ESP_LOGE("JSON", "could not write file %s", tmp.c_str());
+        remove(tmp.c_str());
+        return false;
+    }
+    bool committed = rename(tmp.c_str(), fn.c_str()) == 0;
+    if (!committed) {
+        // file systems which don't replace on rename
+        remove(fn.c_str());
+        committed = rename(tmp.c_str(), fn.c_str()) == 0;
+        if (!committed) ESP_LOGE("JSON", "could not commit file %s", fn.c_str());
+    }
+    {
+        // counted once fn has changed, a reader taking the count before can't mistake new content for old
+        std::lock_guard<std::mutex> lock(countMutex);
+        writeCounts[fn]++;
+    }
+    return committed;
+}
+
+uint32_t CTAG::SP::ctagDataModelBase::GetWriteCount(const string &fn) {
+    std::lock_guard<std::mutex> lock(countMutex);
+    auto it = writeCounts.find(fn);
+    return it == writeCounts.end() ? 0 : it->second;
+}
+
+void CTAG::SP::ctagDataModelBase::recoverWrite(const string &fn, char *buffer) {
+    const string tmp = fn + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "rb");
+    if (f == NULL) return;
+    Document d;
+    FileReadStream is(f, buffer, MB_BUF_SZ);
+    d.ParseStream(is);
+    fclose(f);
+    if (d.HasParseError()) {
+        ESP_LOGW("JSON", "Discarding incomplete write of %s", fn.c_str());
+        remove(tmp.c_str());
+        return;
+    }
+    ESP_LOGW("JSON", "Committing interrupted write of %s", fn.c_str());
+    remove(fn.c_str());
+    rename(tmp.c_str(), fn.c_str());
+}
+
+void CTAG::SP::ctagDataModelBase::RecoverWrites(const string &dir) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    std::unique_ptr<char, decltype(&heap_caps_free)> buffer(acquireBuffer(), &heap_caps_free);
+    if (buffer == nullptr) return;
+    vector<string> dirs {dir};
+    while (!dirs.empty()) {
+        const string path = dirs.back();
+        dirs.pop_back();
+        DIR *dp = opendir(path.c_str());
+        if (dp == NULL) continue;
+        vector<string> journals; // not recovered while iterating, rename changes directory
+        struct dirent *ent;
+        while ((ent = readdir(dp)) != NULL) {
+            const string name(ent->d_name);
+            if (name == "." || name == "..") continue;
+            const string fn = path + "/" + name;
+            struct stat st;
+            if (stat(fn.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+                dirs.push_back(fn);
+            } else if (name.size() > 4 && name.compare(name.size() - 4, 4, ".tmp") == 0) {
+                journals.push_back(fn.substr(0, fn.size() - 4));
+            }
+        }
+        closedir(dp);
+        for (const auto &fn: journals) recoverWrite(fn, buffer.get());
+    }
+}
 
 void CTAG::SP::ctagDataModelBase::loadJSON(Document &d, const string &fn) {
     d.GetAllocator().Clear();
+    {
+        // content of a pending deferred write is newer than file
+        std::lock_guard<std::mutex> lock(deferredMutex);
+        auto it = deferred.find(fn);
+        if (it != deferred.end()) {
+            d.Parse(it->second.data.c_str());
+            if (!d.HasParseError()) return;
+        }
+    }
+    std::unique_ptr<char, decltype(&heap_caps_free)> buffer(acquireBuffer(), &heap_caps_free);
+    if (buffer == nullptr) return;
     ESP_LOGD("JSON", "read buffer");
     //FILE*
     fp = fopen(fn.c_str(), "r");
@@ -43,7 +165,7 @@ void CTAG::SP::ctagDataModelBase::loadJSON(Document &d, const string &fn) {
     }
     //char readBuffer[512];
 //    ESP_LOGE("JSON", "read stream");
-    FileReadStream is(fp, buffer, MB_BUF_SZ);
+    FileReadStream is(fp, buffer.get(), MB_BUF_SZ);
 //    ESP_LOGE("JSON", "trying to parse");
     d.ParseStream(is);
     fclose(fp);
@@ -56,7 +178,10 @@ void CTAG::SP::ctagDataModelBase::loadJSON(Document &d, const string &fn) {
     // CONTENTS OF SPIFFS_IMAGE/DATA
     // IF THIS HAPPENS, ALL CONTENTS OF THE AFFECTED FILE ARE RESET TO FACTORY DEFAULT
     if(d.HasParseError()){
-        string backup_file_name = std::regex_replace(fn, std::regex("data"), "dbup");
+        // backup has same path with data directory replaced by dbup
+        string backup_file_name(fn);
+        const size_t dataDir = ctagPathMatch::FindSegment(fn, "data");
+        if (dataDir != string::npos) backup_file_name.replace(dataDir, 4, "dbup");
         ESP_LOGE("JSON", "File %s has a parse error!", fn.c_str());
         ESP_LOGE("JSON", "Trying to replace with backup file %s", backup_file_name.c_str());
         fp = fopen(backup_file_name.c_str(), "r");
@@ -66,7 +191,7 @@ void CTAG::SP::ctagDataModelBase::loadJSON(Document &d, const string &fn) {
         }
         //char readBuffer[512];
 //    ESP_LOGE("JSON", "read stream");
-        FileReadStream is(fp, buffer, MB_BUF_SZ);
+        FileReadStream is(fp, buffer.get(), MB_BUF_SZ);
 //    ESP_LOGE("JSON", "trying to parse");
         d.ParseStream(is);
         fclose(fp);
@@ -80,18 +205,115 @@ void CTAG::SP::ctagDataModelBase::loadJSON(Document &d, const string &fn) {
 }
 
 void CTAG::SP::ctagDataModelBase::storeJSON(Document &d, const string &fn) {
-    //FILE*
-    fp = fopen(fn.c_str(), "w"); // non-Windows use "w"
-    if (fp == NULL) {
-        ESP_LOGE("JSON", "could not open file %s", fn.c_str());
-        return;
+    std::unique_ptr<char, decltype(&heap_caps_free)> buffer(acquireBuffer(), &heap_caps_free);
+    if (buffer == nullptr) return;
+    std::lock_guard<std::mutex> wlock(writeMutex);
+    {
+        // supersedes pending deferred write
+        std::lock_guard<std::mutex> lock(deferredMutex);
+        deferred.erase(fn);
     }
+    fp = beginWrite(fn);
+    if (fp == NULL) return;
     //char writeBuffer[512];
-    FileWriteStream os(fp, buffer, MB_BUF_SZ);
+    FileWriteStream os(fp, buffer.get(), MB_BUF_SZ);
     Writer<FileWriteStream> writer(os);
     d.Accept(writer);
-    fflush(fp);
-    fclose(fp);
+    os.Flush();
+    commitWrite(fp, fn);
+    fp = nullptr;
+}
+
+void CTAG::SP::ctagDataModelBase::storeJSONDeferred(Document &d, const string &fn) {
+    if (!deferredEnabled) {
+        storeJSON(d, fn);
+        return;
+    }
+    // serialized now, so the document may change until the write is done
+    StringBuffer sb;
+    Writer<StringBuffer> writer(sb);
+    d.Accept(writer);
+    const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(deferredMutex);
+    auto &w = deferred[fn];
+    if (w.seq == 0) w.due = now + MB_DEBOUNCE_MS; // first change since last write starts debounce interval
+    w.data.assign(sb.GetString(), sb.GetSize());
+    w.seq++;
+}
+
+bool CTAG::SP::ctagDataModelBase::streamJSON(const string &fn, Writer<ctagChunkedStream> &w) {
+    bool pending;
+    {
+        std::lock_guard<std::mutex> lock(deferredMutex);
+        pending = deferred.find(fn) != deferred.end();
+    }
+    if (pending) {
+        // content of pending deferred write is served by loadJSON
+        Document d;
+        loadJSON(d, fn);
+        if (d.HasParseError()) d.SetNull();
+        return d.Accept(w);
+    }
+    std::unique_ptr<char, decltype(&heap_caps_free)> buffer(acquireBuffer(), &heap_caps_free);
+    FILE *f = fopen(fn.c_str(), "rb");
+    if (f == NULL || buffer == nullptr) {
+        ESP_LOGE("JSON", "could not open file %s", fn.c_str());
+        if (f != NULL) fclose(f);
+        return w.Null();
+    }
+    FileReadStream is(f, buffer.get(), MB_BUF_SZ);
+    Reader reader;
+    const ParseResult ok = reader.Parse(is, w);
+    fclose(f);
+    if (!ok) {
+        // loadJSON restores the file from backup, so the next request succeeds
+        Document d;
+        loadJSON(d, fn);
+    }
+    return ok;
+}
+
+void CTAG::SP::ctagDataModelBase::EnableDeferredWrites() {
+    deferredEnabled = true;
+}
+
+void CTAG::SP::ctagDataModelBase::FlushDeferred(const bool force) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    string fn, data;
+    vector<string> failed; // not tried again in this call
+    while (true) {
+        // entry stays pending during flash write, so loadJSON keeps returning its content
+        std::lock_guard<std::mutex> wlock(writeMutex);
+        uint32_t seq;
+        {
+            std::lock_guard<std::mutex> lock(deferredMutex);
+            auto it = deferred.begin();
+            while (it != deferred.end() && ((!force && it->second.due > now) ||
+                                            std::find(failed.begin(), failed.end(), it->first) != failed.end())) ++it;
+            if (it == deferred.end()) return;
+            fn = it->first;
+            data = it->second.data;
+            seq = it->second.seq;
+        }
+        FILE *f = beginWrite(fn);
+        bool ok = false;
+        if (f != NULL) {
+            fwrite(data.data(), 1, data.size(), f);
+            ok = commitWrite(f, fn); // write errors are detected and logged here
+        }
+        std::lock_guard<std::mutex> lock(deferredMutex);
+        auto it = deferred.find(fn);
+        if (it == deferred.end()) continue;
+        if (!ok) {
+            // content is kept pending, loadJSON serves it until a retry succeeds
+            it->second.due = now + MB_RETRY_MS;
+            failed.push_back(fn);
+        } else if (it->second.seq == seq) {
+            deferred.erase(it); // else changed during write
+        }
+    }
 }
 
 void CTAG::SP::ctagDataModelBase::printJSON(Value &v) {
@@ -102,10 +324,7 @@ void CTAG::SP::ctagDataModelBase::printJSON(Value &v) {
 }
 
 CTAG::SP::ctagDataModelBase::ctagDataModelBase() {
-    buffer = (char *) heap_caps_malloc(MB_BUF_SZ, MALLOC_CAP_SPIRAM);
-    if (buffer == nullptr) ESP_LOGE("Model Base", "Fatal: Out of mem!");
 }
 
 CTAG::SP::ctagDataModelBase::~ctagDataModelBase() {
-    heap_caps_free(buffer);
 }
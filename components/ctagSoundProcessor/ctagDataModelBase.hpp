@@ -26,8 +26,13 @@ respective component folders / files if different from this license.
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <map>
+#include <mutex>
+#include <cstdio>
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include "ctagChunkedStream.hpp"
 
 using namespace rapidjson;
 using namespace std;
@@ -40,6 +45,19 @@ namespace CTAG {
 
             virtual ~ctagDataModelBase();
 
+            // deferred writes are stored by FlushDeferred, without it they are written immediately
+            static void EnableDeferredWrites();
+
+            // stores pending deferred writes which are due, or all if forced (e.g. before reboot)
+            static void FlushDeferred(const bool force = false);
+
+            // completes or discards writes interrupted by power loss in dir and its sub directories, call once at boot
+            // before any model is loaded
+            static void RecoverWrites(const string &dir);
+
+            // counts writes of json file fn, lets derived data (e.g. preset store) tell if its check of fn still holds
+            static uint32_t GetWriteCount(const string &fn);
+
         protected:
             StringBuffer json;
 
@@ -49,8 +67,35 @@ namespace CTAG {
 
             void storeJSON(rapidjson::Document &d, const string &fn);
 
-            char *buffer;
+            // coalesces frequent writes of the same file, e.g. active patch numbers, into one write
+            void storeJSONDeferred(rapidjson::Document &d, const string &fn);
+
+            // forwards json file as value to writer without building a document, memory is bounded by stream buffers,
+            // writes null if file can't be read, returns false on parse error, output is incomplete then
+            bool streamJSON(const string &fn, rapidjson::Writer<ctagChunkedStream> &w);
+
             FILE *fp = nullptr;
+
+        private:
+            static char *acquireBuffer();
+
+            static FILE *beginWrite(const string &fn);
+
+            static bool commitWrite(FILE *f, const string &fn);
+
+            static void recoverWrite(const string &fn, char *buffer);
+
+            struct DeferredWrite {
+                string data;
+                int64_t due;
+                uint32_t seq {0}; // changes since last write
+            };
+            static std::mutex writeMutex; // serializes file writes, taken before deferredMutex
+            static std::mutex deferredMutex;
+            static std::map<string, DeferredWrite> deferred;
+            static bool deferredEnabled;
+            static std::mutex countMutex;
+            static std::map<string, uint32_t> writeCounts;
         };
 
     }
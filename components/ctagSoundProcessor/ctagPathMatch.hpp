@@ -0,0 +1,102 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// allocation free matching of file paths and api urls, replaces std::regex for the few fixed patterns used
+// patterns consist of '/' separated segments, ":name" captures one segment, a trailing "*" matches the rest
+// query strings ("?...") of urls are ignored, captures point into the matched string
+
+#pragma once
+
+#include <string_view>
+#include <cstddef>
+
+namespace CTAG {
+    namespace SP {
+        class ctagPathMatch final {
+        public:
+            ctagPathMatch() = delete;
+
+            static constexpr bool StartsWith(const std::string_view s, const std::string_view prefix) {
+                return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+            }
+
+            // url without query string
+            static constexpr std::string_view Path(const std::string_view url) {
+                return url.substr(0, url.find('?'));
+            }
+
+            // last segment of path of url, e.g. channel of "/api/v1/getPresets/1?x=y"
+            static constexpr std::string_view LastSegment(const std::string_view url) {
+                const std::string_view p = Path(url);
+                const size_t pos = p.rfind('/');
+                return pos == std::string_view::npos ? p : p.substr(pos + 1);
+            }
+
+            // position of whole segment seg in path, npos if not contained
+            static constexpr size_t FindSegment(const std::string_view path, const std::string_view seg) {
+                for (size_t pos = path.find(seg); pos != std::string_view::npos; pos = path.find(seg, pos + 1)) {
+                    const size_t end = pos + seg.size();
+                    if ((pos == 0 || path[pos - 1] == '/') && (end == path.size() || path[end] == '/')) return pos;
+                }
+                return std::string_view::npos;
+            }
+
+            // returns false if pattern does not match or more than maxCaptures segments are captured
+            static constexpr bool Match(const std::string_view pattern, const std::string_view url,
+                                        std::string_view *captures = nullptr, const size_t maxCaptures = 0) {
+                const std::string_view path = Path(url);
+                size_t pp = 0, up = 0, nCaptures = 0;
+                while (pp < pattern.size()) {
+                    if (pattern[pp] == '*' && pp + 1 == pattern.size()) return true;
+                    const size_t pe = segmentEnd(pattern, pp);
+                    if (up > path.size()) return false;
+                    const size_t ue = segmentEnd(path, up);
+                    if (pattern[pp] == ':') {
+                        if (ue == up || nCaptures == maxCaptures) return false;
+                        captures[nCaptures++] = path.substr(up, ue - up);
+                    } else if (pattern.substr(pp, pe - pp) != path.substr(up, ue - up)) {
+                        return false;
+                    }
+                    pp = pe + 1;
+                    up = ue + 1;
+                }
+                return up >= path.size() + 1 || (pattern.empty() && path.empty());
+            }
+
+            // non negative decimal number, -1 if s is empty or contains other characters
+            static constexpr int ToInt(const std::string_view s) {
+                if (s.empty() || s.size() > 9) return -1;
+                int v = 0;
+                for (const char c : s) {
+                    if (c < '0' || c > '9') return -1;
+                    v = v * 10 + (c - '0');
+                }
+                return v;
+            }
+
+        private:
+            static constexpr size_t segmentEnd(const std::string_view s, const size_t from) {
+                const size_t pos = s.find('/', from);
+                return pos == std::string_view::npos ? s.size() : pos;
+            }
+        };
+    }
+}
@@ -19,14 +19,43 @@ License and copyright details for specific submodules are included in their
 respective component folders / files if different from this license.
 ***************/
 
+
 #include "ctagSPAllocator.hpp"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
 #include <cstdint>
 #include <cassert>
+#include <algorithm>
 
 using namespace CTAG::SP;
 
+#define ARENA_PAINT 0xA5A5A5A5
+#define ARENA_ALIGN SP_ARENA_ALIGN
+
+namespace {
+    // bump allocation from free space [buffer, buffer + size) of arena, returns nullptr if not enough memory
+    // HOT allocations are taken from bottom, COLD allocations from top of free space
+    void *bump(void *&buffer, std::size_t &size, std::size_t const &n, std::size_t align, ctagSPAllocator::Hint const &hint) {
+        if (nullptr == buffer) return nullptr;
+        assert((align & (align - 1)) == 0);
+        if (align < ARENA_ALIGN) align = ARENA_ALIGN;
+        const uintptr_t lo = reinterpret_cast<uintptr_t>(buffer);
+        const uintptr_t hi = lo + size;
+        if (hint == ctagSPAllocator::Hint::COLD) {
+            if (n > size) return nullptr;
+            const uintptr_t p = (hi - n) & ~(align - 1);
+            if (p < lo) return nullptr;
+            size = p - lo;
+            return reinterpret_cast<void *>(p);
+        }
+        const uintptr_t p = (lo + align - 1) & ~(align - 1);
+        if (p + n > hi || p + n < p) return nullptr;
+        buffer = reinterpret_cast<void *>(p + n);
+        size = hi - (p + n);
+        return reinterpret_cast<void *>(p);
+    }
+}
+
 // create all definitions
 void *ctagSPAllocator::internalBuffer = nullptr;
 void *ctagSPAllocator::buffer1 = nullptr;
@@ -34,16 +63,39 @@ void *ctagSPAllocator::buffer2 = nullptr;
 std::size_t ctagSPAllocator::totalSize = 0;
 std::size_t ctagSPAllocator::size1 = 0;
 std::size_t ctagSPAllocator::size2 = 0;
+void *ctagSPAllocator::spiramBuffer = nullptr;
+void *ctagSPAllocator::spiram1 = nullptr;
+void *ctagSPAllocator::spiram2 = nullptr;
+std::size_t ctagSPAllocator::spiramTotalSize = 0;
+std::size_t ctagSPAllocator::spiramSize1 = 0;
+std::size_t ctagSPAllocator::spiramSize2 = 0;
+ctagSPAllocator::Usage ctagSPAllocator::chUsage[2] {};
+void *ctagSPAllocator::chBase[2] {nullptr, nullptr};
+std::string ctagSPAllocator::owner[2];
+std::map<std::string, ctagSPAllocator::Usage> ctagSPAllocator::peakUsage;
 ctagSPAllocator::AllocationType ctagSPAllocator::allocationType = ctagSPAllocator::AllocationType::CH0;
 
 void ctagSPAllocator::AllocateInternalBuffer(std::size_t const &size) {
     ESP_LOGI("ctagSPAllocator", "AllocateInternalBuffer: allocating %d bytes", size);
-    internalBuffer = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    // size is multiple of alignment so that CH1 arena at top of buffer is aligned
+    totalSize = size & ~(std::size_t) (ARENA_ALIGN - 1);
+    internalBuffer = heap_caps_aligned_alloc(ARENA_ALIGN, totalSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     if(nullptr == internalBuffer){
         ESP_LOGE("ctagSPAllocator", "AllocateInternalBuffer: could not allocate memory of size %d", size);
         assert(nullptr != internalBuffer);
     }
-    totalSize = size;
+}
+
+void ctagSPAllocator::AllocateSPIRAMBuffer(std::size_t const &size) {
+    ESP_LOGI("ctagSPAllocator", "AllocateSPIRAMBuffer: allocating %d bytes", size);
+    // size is multiple of twice the alignment so that CH1 arena in middle of buffer is aligned
+    spiramTotalSize = size & ~(std::size_t) (2 * ARENA_ALIGN - 1);
+    spiramBuffer = heap_caps_aligned_alloc(ARENA_ALIGN, spiramTotalSize, MALLOC_CAP_SPIRAM);
+    if(nullptr == spiramBuffer){
+        // not fatal, plugins requesting SPIRAM will fail to allocate
+        ESP_LOGE("ctagSPAllocator", "AllocateSPIRAMBuffer: could not allocate memory of size %d", size);
+        spiramTotalSize = 0;
+    }
 }
 
 void ctagSPAllocator::ReleaseInternalBuffer() {
@@ -55,37 +107,28 @@ void ctagSPAllocator::ReleaseInternalBuffer() {
     totalSize = 0;
     size1 = 0;
     size2 = 0;
+    chBase[0] = chBase[1] = nullptr;
+    chUsage[0].internalSize = chUsage[1].internalSize = 0;
+}
+
+void ctagSPAllocator::ReleaseSPIRAMBuffer() {
+    ESP_LOGI("ctagSPAllocator", "ReleaseSPIRAMBuffer: releasing memory");
+    heap_caps_free(spiramBuffer);
+    spiramBuffer = nullptr;
+    spiram1 = nullptr;
+    spiram2 = nullptr;
+    spiramTotalSize = 0;
+    spiramSize1 = 0;
+    spiramSize2 = 0;
+    chUsage[0].spiramSize = chUsage[1].spiramSize = 0;
+    chUsage[0].spiramUsed = chUsage[1].spiramUsed = 0;
 }
 
 void *ctagSPAllocator::Allocate(std::size_t const &size) {
-    void *ptr = nullptr;
-    if(allocationType == AllocationType::CH0){
-        if(size1 >= size){
-            ptr = buffer1;
-            buffer1 = static_cast<uint8_t *>(buffer1) + size;
-            size1 -= size;
-        }else{
-            ESP_LOGE("ctagSPAllocator", "Allocate: not enough memory for CH0 request %d bytes, %d bytes free", size, size1);
-            assert(false);
-        }
-    }else if(allocationType == AllocationType::CH1){
-        if(size2 >= size){
-            ptr = buffer2;
-            buffer2 = static_cast<uint8_t *>(buffer2) + size;
-            size2 -= size;
-        }else{
-            ESP_LOGE("ctagSPAllocator", "Allocate: not enough memory for CH1 request %d bytes, %d bytes free", size, size1);
-            assert(false);
-        }
-    }else if(allocationType == AllocationType::STEREO){
-        if(size1 >= size){
-            ptr = buffer1;
-            buffer1 = static_cast<uint8_t *>(buffer1) + size;
-            size1 -= size;
-        }else{
-            ESP_LOGE("ctagSPAllocator", "Allocate: not enough memory for STEREO request %d bytes, %d bytes free", size, size1);
-            assert(false);
-        }
+    // object size is rounded up, so that blockMem passed to Init is aligned as well
+    void *ptr = Allocate(Round(size), ARENA_ALIGN, Region::INTERNAL);
+    if(nullptr == ptr){
+        assert(false);
     }
     switch(allocationType){
         case AllocationType::CH0:
@@ -104,6 +147,30 @@ void *ctagSPAllocator::Allocate(std::size_t const &size) {
     return ptr;
 }
 
+void *ctagSPAllocator::Allocate(std::size_t const &size, std::size_t const &align, Region const &region, Hint const &hint) {
+    const int ch = allocationType == AllocationType::CH1 ? 1 : 0;
+    void *ptr = nullptr;
+    if(region != Region::SPIRAM){
+        ptr = ch == 0 ? bump(buffer1, size1, size, align, hint) : bump(buffer2, size2, size, align, hint);
+        if(nullptr != ptr) return ptr;
+        if(region == Region::INTERNAL){
+            ESP_LOGE("ctagSPAllocator", "Allocate: not enough internal memory for CH%d request %d bytes, %d bytes free",
+                     ch, size, ch == 0 ? size1 : size2);
+            return nullptr;
+        }
+        ESP_LOGW("ctagSPAllocator", "Allocate: internal memory exhausted for CH%d request %d bytes, using SPIRAM", ch, size);
+    }
+    ptr = ch == 0 ? bump(spiram1, spiramSize1, size, align, hint) : bump(spiram2, spiramSize2, size, align, hint);
+    if(nullptr == ptr){
+        ESP_LOGE("ctagSPAllocator", "Allocate: not enough SPIRAM for CH%d request %d bytes, %d bytes free",
+                 ch, size, ch == 0 ? spiramSize1 : spiramSize2);
+        return nullptr;
+    }
+    chUsage[ch].spiramUsed = chUsage[ch].spiramSize - (ch == 0 ? spiramSize1 : spiramSize2);
+    ESP_LOGI("ctagSPAllocator", "Allocate: allocating CH%d %d bytes SPIRAM, %d bytes used", ch, size, chUsage[ch].spiramUsed);
+    return ptr;
+}
+
 std::size_t ctagSPAllocator::GetRemainingBufferSize() {
     if(allocationType == AllocationType::CH0 || allocationType == AllocationType::STEREO){
         ESP_LOGD("ctagSPAllocator", "GetRemainingBuffer: CH0 or STEREO %d bytes free", size1);
@@ -130,24 +197,97 @@ void *ctagSPAllocator::GetRemainingBuffer() {
 }
 
 
-void ctagSPAllocator::PrepareAllocation(AllocationType const &type) {
+bool ctagSPAllocator::Fits(AllocationType const &type, std::size_t const &internalSize) {
+    // the plugin being replaced releases its reservation, the other channel keeps it
+    const std::size_t size = (internalSize + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if(type == AllocationType::CH0) return size <= totalSize - chUsage[1].internalSize;
+    if(type == AllocationType::CH1) return size <= totalSize - chUsage[0].internalSize;
+    return size <= totalSize;
+}
+
+bool ctagSPAllocator::PrepareAllocation(AllocationType const &type, std::string const &id, std::size_t const &internalSize) {
+    // mono plugins reserve what they need, CH0 from bottom, CH1 from top of arena, stereo plugins get full arena
+    // without requirement mono plugins get half of the arena
+    std::size_t size = internalSize == 0 ? (totalSize / 2) & ~(ARENA_ALIGN - 1) : (internalSize + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if(type == AllocationType::STEREO) size = totalSize;
+    if(!Fits(type, size)){
+        ESP_LOGE("ctagSPAllocator", "PrepareAllocation: %s needs %d bytes, %d bytes reserved by other channel",
+                 id.c_str(), size, chUsage[type == AllocationType::CH1 ? 0 : 1].internalSize);
+        return false;
+    }
     allocationType = type;
+    // previous plugins of affected channels are gone, keep their peaks
+    if(allocationType != AllocationType::CH1) updatePeak(0);
+    if(allocationType != AllocationType::CH0) updatePeak(1);
     if(allocationType == AllocationType::CH0){
-        ESP_LOGI("ctagSPAllocator", "SetAllocationType: Single Channel CH0");
-        size1 = totalSize / 2;
+        ESP_LOGI("ctagSPAllocator", "SetAllocationType: Single Channel CH0, %d bytes", size);
+        size1 = size;
         buffer1 = internalBuffer;
+        spiramSize1 = spiramTotalSize / 2;
+        spiram1 = spiramBuffer;
     }else if(allocationType == AllocationType::CH1){
-        ESP_LOGI("ctagSPAllocator", "SetAllocationType: Single Channel CH1");
-        size2 = totalSize / 2;
-        buffer2 = static_cast<uint8_t *>(internalBuffer) + size2;
+        ESP_LOGI("ctagSPAllocator", "SetAllocationType: Single Channel CH1, %d bytes", size);
+        size2 = size;
+        buffer2 = internalBuffer == nullptr ? nullptr : static_cast<uint8_t *>(internalBuffer) + totalSize - size;
+        spiramSize2 = spiramTotalSize / 2;
+        spiram2 = spiramBuffer == nullptr ? nullptr : static_cast<uint8_t *>(spiramBuffer) + spiramSize2;
     }else if(allocationType == AllocationType::STEREO){
         ESP_LOGI("ctagSPAllocator", "SetAllocationType: Stereo");
-        size1 = totalSize;
+        size1 = size;
         buffer1 = internalBuffer;
         size2 = 0;
         buffer2 = nullptr;
+        spiramSize1 = spiramTotalSize;
+        spiram1 = spiramBuffer;
+        spiramSize2 = 0;
+        spiram2 = nullptr;
     }else{
         ESP_LOGE("ctagSPAllocator", "SetAllocationType: unknown allocation type");
         assert(false);
     }
-}
\ No newline at end of file
+    const int ch = allocationType == AllocationType::CH1 ? 1 : 0;
+    // paint arena of channel, watermark is measured against it
+    chBase[ch] = ch == 0 ? buffer1 : buffer2;
+    if(nullptr != chBase[ch]) std::fill_n(static_cast<uint32_t *>(chBase[ch]), size / 4, ARENA_PAINT);
+    chUsage[ch] = Usage {0, size, 0, ch == 0 ? spiramSize1 : spiramSize2};
+    owner[ch] = id;
+    if(allocationType == AllocationType::STEREO){
+        chBase[1] = nullptr;
+        chUsage[1] = Usage {0, 0, 0, 0};
+        owner[1].clear();
+    }
+    return true;
+}
+
+std::size_t ctagSPAllocator::measureInternal(int const &ch) {
+    if(nullptr == chBase[ch] || chUsage[ch].internalSize == 0) return 0;
+    const uint32_t *arena = static_cast<const uint32_t *>(chBase[ch]);
+    // words which are not paint anymore, touched by object, Allocate or blockMem
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < chUsage[ch].internalSize / 4; i++) n += arena[i] != ARENA_PAINT;
+    const std::size_t bumped = chUsage[ch].internalSize - (ch == 0 ? size1 : size2);
+    return std::max(n * 4, bumped);
+}
+
+void ctagSPAllocator::updatePeak(int const &ch) {
+    if(owner[ch].empty()) return;
+    const Usage u = GetUsage(ch);
+    Usage &p = peakUsage[owner[ch]];
+    p.internalUsed = std::max(p.internalUsed, u.internalUsed);
+    p.internalSize = u.internalSize;
+    p.spiramUsed = std::max(p.spiramUsed, u.spiramUsed);
+    p.spiramSize = u.spiramSize;
+}
+
+ctagSPAllocator::Usage ctagSPAllocator::GetUsage(int const &ch) {
+    if(ch < 0 || ch > 1) return Usage {0, 0, 0, 0};
+    Usage u = chUsage[ch];
+    u.internalUsed = measureInternal(ch);
+    return u;
+}
+
+std::map<std::string, ctagSPAllocator::Usage> const &ctagSPAllocator::GetPeakUsage() {
+    updatePeak(0);
+    updatePeak(1);
+    return peakUsage;
+}
@@ -21,18 +21,41 @@ respective component folders / files if different from this license.
 
 // this is an arena style allocator for the sound processors
 // implemented to reduce memory fragmentation
+// it manages two arenas, one in internal RAM (fast, small) and one in SPIRAM (slow, large)
 // steps to use:
-// 1. call AllocateInternalBuffer with size of large buffer at program start
-// 2. call PrepareAllocation with specific AllocationType before creating new sound processor,
-// note that the state is set in "allocationType" for subsequent allocations
+// 1. call AllocateInternalBuffer and AllocateSPIRAMBuffer with size of large buffers at program start
+// 2. call PrepareAllocation with specific AllocationType, plugin id and internal memory requirement before creating new
+// sound processor, note that the state is set in "allocationType" for subsequent allocations
+// the internal arena is split dynamically, a mono sound processor reserves its requirement (sizeof + blockMemSize,
+// generated at build time by the factory) CH0 from bottom, CH1 from top, a stereo sound processor gets the full arena
 // 3. Allocate is called in overloaded new operator of sound processor
 // 4. GetRemainingBufferSize is called by sound processor factory in "Init()" to pass remaining memory size available to sound processor
 // 5. GetRemainingBuffer is called by sound processor factory in "Init()" to pass remaining memory available to sound processor
-// 6. ReleaseInternalBuffer is called at program end to release large buffer, or when large memory is needed somewhere else
+// 6. in "Init()" sound processors may request additional memory with Allocate(size, align, region) instead of heap_caps_malloc,
+// memory is released when the arena is reset, i.e. no explicit free needed
+// 7. ReleaseInternalBuffer / ReleaseSPIRAMBuffer are called at program end to release large buffers,
+// or when large memory is needed somewhere else
+// note: internal memory from Allocate(size, align, region) is taken from the same remaining buffer which is passed as
+// blockMem to "Init()", a sound processor must therefore use either blockMem or Allocate for internal memory, SPIRAM can always be used
+// usage of the internal arena is measured by a watermark (the channel's arena is painted when prepared), hence blockMem
+// usage is included, peak usage is kept per plugin id
+// every allocation is aligned to at least SP_ARENA_ALIGN bytes, HOT allocations (state touched every sample) are packed
+// contiguously from the bottom of a channel's arena, COLD allocations (rarely touched, large) from its top
 
 #pragma once
 
 #include <cstddef>
+#include <string>
+#include <map>
+#include "sdkconfig.h"
+
+#ifdef CONFIG_SP_ARENA_ALIGN
+#define SP_ARENA_ALIGN CONFIG_SP_ARENA_ALIGN
+#else
+#define SP_ARENA_ALIGN 16
+#endif
+
+static_assert(SP_ARENA_ALIGN >= 16 && (SP_ARENA_ALIGN & (SP_ARENA_ALIGN - 1)) == 0, "arena alignment must be power of 2 >= 16");
 
 namespace CTAG::SP {
     class ctagSPAllocator final {
@@ -43,25 +66,73 @@ namespace CTAG::SP {
             CH1,
             STEREO
         };
+        // memory region of an allocation
+        enum Region {
+            INTERNAL, // internal RAM only, for state accessed per sample
+            SPIRAM, // SPIRAM only, for large buffers e.g. delay lines
+            INTERNAL_FIRST // internal RAM if available, else SPIRAM
+        };
+        // access pattern of an allocation
+        enum Hint {
+            HOT, // touched every sample, e.g. filter state, delay lines
+            COLD // touched rarely or sparsely, e.g. large sample buffers
+        };
+        // memory usage of a channel / a plugin in bytes
+        struct Usage {
+            std::size_t internalUsed, internalSize;
+            std::size_t spiramUsed, spiramSize;
+        };
         ctagSPAllocator() = delete;
 
         // allocate large block of memory which is used by the sound processors
         static void AllocateInternalBuffer(std::size_t const &size);
+        // allocate large block of SPIRAM which is used by the sound processors
+        static void AllocateSPIRAMBuffer(std::size_t const &size);
         // release large block of memory
         static void ReleaseInternalBuffer();
+        // release large block of SPIRAM
+        static void ReleaseSPIRAMBuffer();
+        // size rounded up to arena alignment
+        static constexpr std::size_t Round(std::size_t const &size) {
+            return (size + SP_ARENA_ALIGN - 1) & ~static_cast<std::size_t>(SP_ARENA_ALIGN - 1);
+        }
+        // internal memory requirement of a sound processor, used by factory
+        static constexpr std::size_t Requirement(std::size_t const &objectSize, std::size_t const &blockMemSize) {
+            return Round(objectSize) + Round(blockMemSize);
+        }
         // called by new operator of sound processors
         static void *Allocate(std::size_t const &size);
+        // called by sound processors for additional memory, returns nullptr if region is exhausted
+        // align is raised to SP_ARENA_ALIGN if smaller
+        static void *Allocate(std::size_t const &size, std::size_t const &align, Region const &region, Hint const &hint = Hint::HOT);
         // called to determine remaining size after new allocation for other heap allocations of sound processor
         static std::size_t GetRemainingBufferSize();
         // called to pass heap available to sound processor
         static void *GetRemainingBuffer();
-        // prepare allocation type, must be called before creating new sound processor
-        static void PrepareAllocation(AllocationType const &type);
+        // true if a sound processor with internalSize bytes requirement fits next to the other channel's sound processor,
+        // checked against the current plugin of the other channel, not against a configuration it is about to change to
+        static bool Fits(AllocationType const &type, std::size_t const &internalSize);
+        // prepare allocation type, must be called before creating new sound processor, internalSize 0 reserves half
+        // of the arena for mono sound processors, returns false if requirement does not fit
+        static bool PrepareAllocation(AllocationType const &type, std::string const &id = "", std::size_t const &internalSize = 0);
+        // current usage of the plugin in channel ch, updates peak usage of its plugin id
+        static Usage GetUsage(int const &ch);
+        // peak usage per plugin id since startup
+        static std::map<std::string, Usage> const &GetPeakUsage();
 
     private:
+        static std::size_t measureInternal(int const &ch);
+        static void updatePeak(int const &ch);
         static void *internalBuffer; // main ptr to large buffer
         static void *buffer1, *buffer2; // ptrs pointing at memory available for sound processor
         static std::size_t totalSize, size1, size2; // size of large buffer and size of memory available for sound processor
+        static void *spiramBuffer; // main ptr to large SPIRAM buffer
+        static void *spiram1, *spiram2; // ptrs pointing at SPIRAM available for sound processor
+        static std::size_t spiramTotalSize, spiramSize1, spiramSize2;
+        static Usage chUsage[2]; // arena sizes of channels and SPIRAM used, internal used is measured
+        static void *chBase[2]; // start of internal arena of channels
+        static std::string owner[2]; // plugin ids of channels
+        static std::map<std::string, Usage> peakUsage;
         static AllocationType allocationType; // type of sound processor to create, is state variable
     };
 }
@@ -21,11 +21,14 @@ respective component folders / files if different from this license.
 
 
 #include "ctagSPDataModel.hpp"
+#include <cstring>
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/stringbuffer.h"
 #include "esp_log.h"
+#include "esp_system.h"
 #include "ctagResources.hpp"
+#include "ctagSPPresetStore.hpp"
 
 /*
 #ifndef TBD_SIM
@@ -37,79 +40,212 @@ respective component folders / files if different from this license.
 
 using namespace CTAG::SP;
 
+string ctagSPDataModel::stagedID;
+// random start per boot, versions clients hold from before a reboot are unlikely to fall into the new range
+std::atomic<uint32_t> ctagSPDataModel::versionCounter {(esp_random() >> 2) + 1};
+Document ctagSPDataModel::stagedMp;
+
 ctagSPDataModel::ctagSPDataModel(const string &id, const bool isStereo) {
-    // acquire data from json files ui model and patch model
+    // ui model is only read on request, patch model is read to obtain active preset
     muiFileName = string(CTAG::RESOURCES::spiffsRoot + "/data/sp/mui-") + id + string(".jsn");
-    //std::cout << "Reading " << muiFileName << std::endl;
-    loadJSON(mui, muiFileName);
     mpFileName = string(CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-") + id + string(".jsn");
-    //std::cout << "Reading " << mpFileName << std::endl;
-    loadJSON(mp, mpFileName);
-    // load last activated preset
-    ESP_LOGD("Model", "Loading patch number %d", mp["activePatch"].GetInt());
-    LoadPreset(mp["activePatch"].GetInt());
+    if (loadStoredPreset(-1)) {
+        if (stagedID == id) {
+            release(stagedMp);
+            stagedID.clear();
+        }
+        return;
+    }
+    if (stagedID == id) {
+        // take over prefetched document
+        ESP_LOGD("Model", "Using staged model of %s", id.c_str());
+        mp.Swap(stagedMp);
+        release(stagedMp);
+        stagedID.clear();
+    } else {
+        loadJSON(mp, mpFileName);
+    }
+    // activate last activated preset, file has just been read, an intact store header holds the latest recall
+    if (mp.IsObject() && mp.HasMember("activePatch") && mp["activePatch"].IsInt()) {
+        int num = ctagSPPresetStore::ReadActivePatch(mpFileName);
+        if (num < 0) num = mp["activePatch"].GetInt();
+        ESP_LOGD("Model", "Loading patch number %d", num);
+        selectPreset(num);
+    }
+    ctagSPPresetStore(mpFileName).Build(mp);
+    release(mp);
+}
 
+void ctagSPDataModel::Prefetch(const string &id) {
+    const string fn = string(CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-") + id + string(".jsn");
+    // nothing to parse if preset store is up to date
+    string ids;
+    uint32_t idsCrc = 0;
+    if (ctagSPPresetStore(fn).Open(ids, idsCrc)) return;
+    ctagSPDataModel loader;
+    loader.loadJSON(stagedMp, fn);
+    stagedID = id;
+    if (stagedMp.HasParseError() || !stagedMp.IsObject()) stagedID.clear();
 }
 
 ctagSPDataModel::~ctagSPDataModel() {
 }
 
+void ctagSPDataModel::release(Document &d) {
+    d.SetNull();
+    d.GetAllocator().Clear();
+}
+
 const char *ctagSPDataModel::GetCStrJSONParams() {
     json.Clear();
+    loadJSON(mui, muiFileName);
     mergeModels();
     Writer<StringBuffer> writer(json);
     mui.Accept(writer);
+    release(mui);
     //printf("%s\n", json.GetString());
     return json.GetString();
 }
 
+const char *ctagSPDataModel::GetCStrJSONParamDelta(const uint32_t since) {
+    json.Clear();
+    // since from other boot (or 0) lies outside of the versions of this parameter set
+    const bool full = since < baseVersion || since > versionCounter;
+    Writer<StringBuffer> writer(json);
+    writer.StartObject();
+    writer.Key("version");
+    writer.Uint(versionCounter);
+    writer.Key("full");
+    writer.Bool(full);
+    writer.Key("params");
+    writer.StartArray();
+    for (const auto &p : activeParams) {
+        if (!full && p.version <= since) continue;
+        writer.StartObject();
+        writer.Key("id");
+        writer.String(&activeIds[p.idOffset], p.idLen);
+        writer.Key("current");
+        writer.Int(p.current);
+        if (p.flags & HAS_CV) {
+            writer.Key("cv");
+            writer.Int(p.cv);
+        }
+        if (p.flags & HAS_TRIG) {
+            writer.Key("trig");
+            writer.Int(p.trig);
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return json.GetString();
+}
+
 void ctagSPDataModel::mergeModels() {
-    // iterate preset model for all parameters
-    if (!activePreset.HasMember("params")) return;
-    if (!mui.HasMember("params")) return;
-    Value &patchParams = activePreset["params"];
-    for (auto &v : patchParams.GetArray()) {
-        //printf("Searching for %s in ui model", v["id"].GetString());
-        recursiveFindAndInsert(v, mui["params"]);
+    // iterate active preset for all parameters
+    if (!mui.IsObject() || !mui.HasMember("params")) return;
+    Value paramF(kObjectType);
+    Document::AllocatorType &allocator = mui.GetAllocator();
+    paramF.AddMember("id", Value(kStringType), allocator);
+    paramF.AddMember("current", 0, allocator);
+    paramF.AddMember("cv", 0, allocator);
+    paramF.AddMember("trig", 0, allocator);
+    for (const auto &p : activeParams) {
+        paramF["id"].SetString(StringRef(&activeIds[p.idOffset], p.idLen));
+        paramF["current"].SetInt(p.current);
+        paramF["cv"].SetInt(p.cv);
+        paramF["trig"].SetInt(p.trig);
+        recursiveFindAndInsert(paramF, p.flags, mui["params"]);
+    }
+}
+
+void ctagSPDataModel::setActivePreset(const Value &preset) {
+    activeName.clear();
+    activeIds.clear();
+    activeParams.clear();
+    storeIdsCrc = 0;
+    if (!preset.IsObject()) return;
+    auto name = preset.FindMember("name");
+    if (name != preset.MemberEnd() && name->value.IsString())
+        activeName.assign(name->value.GetString(), name->value.GetStringLength());
+    forEachParamOf(preset, [this](const PresetParam &pp) {
+        if (pp.idLen > UINT8_MAX || activeIds.size() + pp.idLen + 1 > UINT16_MAX) {
+            ESP_LOGE("Model", "Preset parameter id exceeds compact storage, skipped");
+            return;
+        }
+        ActiveParam p {static_cast<uint16_t>(activeIds.size()), static_cast<uint8_t>(pp.idLen), 0, pp.current,
+                       static_cast<int16_t>(pp.cv), static_cast<int16_t>(pp.trig), 0};
+        if (pp.hasCV) p.flags |= HAS_CV;
+        if (pp.hasTrig) p.flags |= HAS_TRIG;
+        activeIds.append(pp.id, pp.idLen);
+        activeIds.push_back('\0');
+        activeParams.push_back(p);
+    });
+    activeParams.shrink_to_fit();
+    activeIds.shrink_to_fit();
+    replacedActiveParams();
+}
+
+void ctagSPDataModel::replacedActiveParams() {
+    baseVersion = ++versionCounter;
+    for (auto &p : activeParams) p.version = baseVersion;
+}
+
+void ctagSPDataModel::writeActivePreset(Value &preset, Document::AllocatorType &allocator) const {
+    preset.SetObject();
+    preset.AddMember("name", Value(activeName.c_str(), activeName.size(), allocator), allocator);
+    Value params(kArrayType);
+    params.Reserve(activeParams.size(), allocator);
+    for (const auto &p : activeParams) {
+        Value v(kObjectType);
+        v.AddMember("id", Value(&activeIds[p.idOffset], p.idLen, allocator), allocator);
+        v.AddMember("current", p.current, allocator);
+        if (p.flags & HAS_CV) v.AddMember("cv", p.cv, allocator);
+        if (p.flags & HAS_TRIG) v.AddMember("trig", p.trig, allocator);
+        params.PushBack(v, allocator);
     }
+    preset.AddMember("params", params, allocator);
+}
+
+int ctagSPDataModel::findActiveParam(const string &id) const {
+    for (size_t i = 0; i < activeParams.size(); i++) {
+        const auto &p = activeParams[i];
+        if (p.idLen == id.size() && id.compare(0, p.idLen, &activeIds[p.idOffset], p.idLen) == 0) return i;
+    }
+    return -1;
 }
 
 void ctagSPDataModel::SetParamValue(const string &id, const string &key, const int val) {
     ESP_LOGD("Model", "Setting id %s, with %s to %d", id.c_str(), key.c_str(), val);
-    if (!activePreset.HasMember("params")) return;
-    Value &patchParams = activePreset["params"];
-    if (!patchParams.IsArray()) return;
-    for (auto &v : patchParams.GetArray()) {
-        //printf("Searching for %s in ui model", v["id"].GetString());
-        if (!v.HasMember("id")) return;
-        if (!v["id"].IsString()) return;
-        if (v["id"] == id) {
-            ESP_LOGD("Model", "I found the value");
-            if (!v.HasMember(key)) return;
-            v[key] = val;
-        }
+    const int i = findActiveParam(id);
+    if (i < 0) return;
+    auto &p = activeParams[i];
+    bool changed = false;
+    if (key == "current") {
+        changed = p.current != val;
+        p.current = val;
+    } else if (key == "cv" && (p.flags & HAS_CV)) {
+        changed = p.cv != val;
+        p.cv = val;
+    } else if (key == "trig" && (p.flags & HAS_TRIG)) {
+        changed = p.trig != val;
+        p.trig = val;
     }
+    if (changed) p.version = ++versionCounter;
 }
 
 int ctagSPDataModel::GetParamValue(const string &id, const string &key) {
-    if (!activePreset.HasMember("params")) return 0;
-    Value &patchParams = activePreset["params"];
-    if (!patchParams.IsArray()) return 0;
-    for (auto &v : patchParams.GetArray()) {
-        if (!v.HasMember("id")) return 0;
-        if (!v["id"].IsString()) return 0;
-        if (v["id"] == id) {
-            if (!v.HasMember(key)) return 0;
-            return v[key].GetInt();
-        }
-    }
+    const int i = findActiveParam(id);
+    if (i < 0) return 0;
+    const auto &p = activeParams[i];
+    if (key == "current") return p.current;
+    if (key == "cv" && (p.flags & HAS_CV)) return p.cv;
+    if (key == "trig" && (p.flags & HAS_TRIG)) return p.trig;
     return 0;
 }
 
 
 const char *ctagSPDataModel::GetCStrJSONPresets() {
-    if (!mp.HasMember("activePatch")) return nullptr;
-    if (!mp["activePatch"].IsInt()) return nullptr;
     json.Clear();
     int num = 0;
     // data to be printed
@@ -119,11 +255,11 @@ const char *ctagSPDataModel::GetCStrJSONPresets() {
     // temporary root documents p is export d is patch file
     Document p, d;
     // data to be printed
-    n.SetInt(mp["activePatch"].GetInt());
+    n.SetInt(activePatch);
     obj.AddMember("activePresetNumber", n, p.GetAllocator());
     // load presets to document d
     loadJSON(d, mpFileName);
-    if (!d.HasMember("patches")) return nullptr;
+    if (!d.IsObject() || !d.HasMember("patches")) return nullptr;
     if (!d["patches"].IsArray()) return nullptr;
     // iterate presets
     for (auto &v : d["patches"].GetArray()) {
@@ -143,32 +279,86 @@ const char *ctagSPDataModel::GetCStrJSONPresets() {
 }
 
 void ctagSPDataModel::LoadPreset(const int num) {
+    if (loadStoredPreset(num < 0 ? 0 : num)) return;
+    loadJSON(mp, mpFileName);
+    selectPreset(num);
+    ctagSPPresetStore(mpFileName).Build(mp);
+    release(mp);
+}
+
+bool ctagSPDataModel::loadStoredPreset(const int num) {
+    ctagSPPresetStore store(mpFileName);
+    string ids, name;
+    uint32_t idsCrc = storeIdsCrc;
+    if (!store.Open(ids, idsCrc)) return false;
+    if (store.GetNumPresets() == 0) return false;
+    int patchNum = num < 0 ? store.GetActivePatch() : num;
+    if (patchNum >= store.GetNumPresets()) patchNum = store.GetNumPresets() - 1;
+    vector<ctagSPPresetStore::Entry> entries;
+    if (!store.Read(patchNum, name, entries)) return false;
+    if (idsCrc != storeIdsCrc) {
+        if (ids.size() > UINT16_MAX) return false;
+        activeIds.swap(ids);
+        storeIdsCrc = idsCrc;
+    }
+    activeName.swap(name);
+    activeParams.clear();
+    size_t offset = 0;
+    for (const auto &e : entries) {
+        const size_t len = strlen(&activeIds[offset]);
+        if ((e.flags & ctagSPPresetStore::PRESENT) && len <= UINT8_MAX) {
+            activeParams.push_back(ActiveParam {static_cast<uint16_t>(offset), static_cast<uint8_t>(len),
+                                                static_cast<uint8_t>(e.flags & (HAS_CV | HAS_TRIG)), e.current,
+                                                e.cv, e.trig, 0});
+        }
+        offset += len + 1;
+    }
+    replacedActiveParams();
+    ESP_LOGD("Model", "Preset Name is %s number %d (store)", activeName.c_str(), patchNum);
+    activePatch = patchNum;
+    store.WriteActivePatch(patchNum);
+    return true;
+}
+
+void ctagSPDataModel::ReloadPresets() {
     loadJSON(mp, mpFileName);
+}
+
+void ctagSPDataModel::ReleasePresets() {
+    release(mp);
+}
+
+const Value *ctagSPDataModel::getStoredPreset(const int num) const {
+    if (!mp.IsObject() || !mp.HasMember("patches")) return nullptr;
+    if (!mp["patches"].IsArray()) return nullptr;
+    if (num < 0 || static_cast<SizeType>(num) >= mp["patches"].GetArray().Size()) return nullptr;
+    return &mp["patches"].GetArray()[num];
+}
+
+void ctagSPDataModel::selectPreset(const int num) {
     int patchNum = num;
     if (patchNum < 0) patchNum = 0;
-    if (!mp.HasMember("patches")) return;
+    if (!mp.IsObject() || !mp.HasMember("patches")) return;
     if (!mp["patches"].IsArray()) return;
     if (patchNum >= mp["patches"].GetArray().Size()) {
         ESP_LOGD("Model", "Bounds check patch num %d, size %d", patchNum, mp["patches"].GetArray().Size());
         patchNum = mp["patches"].GetArray().Size() - 1;
     }
-    activePreset.GetAllocator().Clear();
-    activePreset.CopyFrom(mp["patches"].GetArray()[patchNum], activePreset.GetAllocator());
-    ESP_LOGD("Model", "Preset Name is %s number %d", activePreset["name"].GetString(), patchNum);
+    setActivePreset(mp["patches"].GetArray()[patchNum]);
+    ESP_LOGD("Model", "Preset Name is %s number %d", activeName.c_str(), patchNum);
+    activePatch = patchNum;
     // save currently loaded preset to model
     if (!mp.HasMember("activePatch")) return;
-    mp["activePatch"].SetInt(patchNum);
-    storeJSON(mp, mpFileName);
-    json.Clear();
-    Writer<StringBuffer> writer(json);
-    mp.Accept(writer);
+    if (mp["activePatch"].GetInt() != patchNum) {
+        mp["activePatch"].SetInt(patchNum);
+        storeJSON(mp, mpFileName);
+    }
 }
 
-void ctagSPDataModel::recursiveFindAndInsert(const Value &paramF, Value &paramI) {
+void ctagSPDataModel::recursiveFindAndInsert(const Value &paramF, const uint8_t flags, Value &paramI) {
     if (!paramI.IsArray()) return;
     for (auto &v : paramI.GetArray()) {
         //printf("Matching for %s in with %s", paramF["id"].GetString(), v["id"].GetString());
-        if (!paramF.HasMember("id")) return;
         if (!v.HasMember("id")) return;
         if (paramF["id"] == v["id"]) {
             //printf("Found, inserting data...");
@@ -177,13 +367,13 @@ void ctagSPDataModel::recursiveFindAndInsert(const Value &paramF, Value &paramI)
                 v.AddMember("current", paramF["current"].GetInt(), mui.GetAllocator());
             else
                 iter->value = paramF["current"].GetInt();
-            if (v["type"] == "bool" && paramF.HasMember("trig")) {
+            if (v["type"] == "bool" && (flags & HAS_TRIG)) {
                 Value::MemberIterator iter = v.FindMember("trig");
                 if (iter == v.MemberEnd())
                     v.AddMember("trig", paramF["trig"].GetInt(), mui.GetAllocator());
                 else
                     iter->value = paramF["trig"].GetInt();
-            } else if (v["type"] == "int" && paramF.HasMember("cv")) {
+            } else if (v["type"] == "int" && (flags & HAS_CV)) {
                 Value::MemberIterator iter = v.FindMember("cv");
                 if (iter == v.MemberEnd())
                     v.AddMember("cv", paramF["cv"].GetInt(), mui.GetAllocator());
@@ -193,7 +383,7 @@ void ctagSPDataModel::recursiveFindAndInsert(const Value &paramF, Value &paramI)
             break;
         } else if (v["type"] == "group") {
             //printf("Going for a group recursion");
-            recursiveFindAndInsert(paramF, v["params"]);
+            recursiveFindAndInsert(paramF, flags, v["params"]);
         }
     }
 }
@@ -201,43 +391,37 @@ void ctagSPDataModel::recursiveFindAndInsert(const Value &paramF, Value &paramI)
 
 void ctagSPDataModel::SavePreset(const string &name, const int number) {
     //ESP_LOGE("Model", "Save preset %s %d", name.c_str(), number);
-    //ESP_LOGE("MOdel", "Stored JSON before");
-    //PrintSelf();
     loadJSON(mp, mpFileName);
     int patchNum = number;
     if (patchNum < 0) patchNum = 0;
-    if (!mp.HasMember("patches")) return;
-    if (!mp["patches"].IsArray()) return;
+    if (!mp.IsObject() || !mp.HasMember("patches") || !mp["patches"].IsArray()) {
+        release(mp);
+        return;
+    }
     if (patchNum > mp["patches"].GetArray().Size()) patchNum = mp["patches"].GetArray().Size();
-    if (!activePreset.HasMember("name")) return;
-    activePreset["name"].SetString(name, activePreset.GetAllocator());
+    activeName = name;
+    Value preset;
+    writeActivePreset(preset, mp.GetAllocator()); // saved preset is current
     //ESP_LOGE("Model", "Adding new number %d, patchnum %d, patch array size %d", number, patchNum, mp["patches"].GetArray().Size());
     if (patchNum == mp["patches"].GetArray().Size()) {
-        Value copyOfPreset(activePreset, mp.GetAllocator());
-        //copyOfPreset["name"].SetString(name, mp.GetAllocator());
-        mp["patches"].PushBack(copyOfPreset.Move(), mp.GetAllocator());
-        /*
-        ESP_LOGE("Model", "Adding new number %d, patchnum %d, patch array size %d", number, patchNum,
-                 mp["patches"].GetArray().Size());
-                 */
+        mp["patches"].PushBack(preset.Move(), mp.GetAllocator());
     } else {
-        mp["patches"][patchNum].CopyFrom(activePreset, mp.GetAllocator()); // saved preset is current
-        //ESP_LOGE("Model", "Replace");
+        mp["patches"][patchNum] = preset.Move();
     }
-    if (!mp.HasMember("activePatch")) return;
-    mp["activePatch"] = patchNum;
-    storeJSON(mp, mpFileName);
-    //ESP_LOGE("MOdel", "Stored JSON after");
-    //PrintSelf();
+    activePatch = patchNum;
+    if (mp.HasMember("activePatch")) {
+        mp["activePatch"] = patchNum;
+        storeJSON(mp, mpFileName);
+        ctagSPPresetStore(mpFileName).Build(mp);
+    }
+    release(mp);
 }
 
 void ctagSPDataModel::PrintSelf() {
-    ESP_LOGD("Model", "mp:");
-    printJSON(mp);
-    ESP_LOGD("Model", "mui:");
-    printJSON(mui);
-    ESP_LOGD("Model", "activePreset:");
-    printJSON(activePreset);
+    ESP_LOGD("Model", "activePreset %d:", activePatch);
+    Document d;
+    writeActivePreset(d, d.GetAllocator());
+    printJSON(d);
 }
 
 const char *ctagSPDataModel::GetCStrJSONAllPresetData() {
@@ -251,43 +435,27 @@ const char *ctagSPDataModel::GetCStrJSONAllPresetData() {
 }
 
 bool ctagSPDataModel::IsParamTrig(const string &id) {
-    if (!activePreset.HasMember("params")) return false;
-    Value &patchParams = activePreset["params"];
-    if (!patchParams.IsArray()) return false;
-    for (auto &v : patchParams.GetArray()) {
-        if (!v.HasMember("id")) return false;
-        if (!v["id"].IsString()) return false;
-        if (v["id"] == id) {
-            if (v.HasMember("trig")) return true;
-        }
-    }
-    return false;
+    const int i = findActiveParam(id);
+    return i >= 0 && (activeParams[i].flags & HAS_TRIG);
 }
 
 bool ctagSPDataModel::IsParamCV(const string &id) {
-    if (!activePreset.HasMember("params")) return false;
-    Value &patchParams = activePreset["params"];
-    if (!patchParams.IsArray()) return false;
-    for (auto &v : patchParams.GetArray()) {
-        if (!v.HasMember("id")) return false;
-        if (!v["id"].IsString()) return false;
-        if (v["id"] == id) {
-            if (v.HasMember("cv")) return true;
-        }
-    }
-    return false;
+    const int i = findActiveParam(id);
+    return i >= 0 && (activeParams[i].flags & HAS_CV);
 }
 
 std::string ctagSPDataModel::GetActivePluginParameters() {
+    Document d;
+    writeActivePreset(d, d.GetAllocator());
     rapidjson::StringBuffer parameters;
     rapidjson::Writer<rapidjson::StringBuffer> writer(parameters);
-    activePreset.Accept(writer);
+    d.Accept(writer);
     return parameters.GetString();
 }
 
 void ctagSPDataModel::SetActivePluginParameters(const std::string &parameters) {
     Document d;
     d.Parse(parameters.c_str());
-    activePreset.GetAllocator().Clear();
-    activePreset.CopyFrom(d, activePreset.GetAllocator());
+    if (d.HasParseError()) return;
+    setActivePreset(d);
 }
@@ -27,10 +27,18 @@ respective component folders / files if different from this license.
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <atomic>
 
 using namespace std;
 using namespace rapidjson;
 
+// data model of a sound processor
+// only the active preset is kept in memory, as compact parameter vector
+// ui model (mui) is read on demand when the web ui requests parameter specs and released afterwards,
+// preset model (mp) is read for preset operations and released afterwards,
+// presets are recalled from the binary preset store if it is up to date, which avoids parsing mp
+
 namespace CTAG {
     namespace SP {
         class ctagSPDataModel : public ctagDataModelBase {
@@ -39,6 +47,10 @@ namespace CTAG {
 
             ~ctagSPDataModel();
 
+            // staging slot, parses preset file of plugin id ahead of its construction, i.e. before audio is faded out
+            // the next model constructed with the same id takes over the staged document instead of reading the file
+            static void Prefetch(const string &id);
+
             const char *GetCStrJSONParams();
 
             void LoadPreset(const int num);
@@ -56,6 +68,46 @@ namespace CTAG {
             std::string GetActivePluginParameters(); // active preset which contains non stored values
             void SetActivePluginParameters(const std::string &preset);
 
+            // parameters of active preset changed after version since, all if the parameter set has been replaced
+            // (preset load, plugin change) since then, i.e. {"version": v, "full": bool, "params": [...]}
+            const char *GetCStrJSONParamDelta(const uint32_t since);
+
+            // parameter entry of active preset, cv / trig are only valid if hasCV / hasTrig
+            struct PresetParam {
+                const char *id;
+                uint32_t idLen;
+                int current;
+                int cv;
+                int trig;
+                bool hasCV;
+                bool hasTrig;
+            };
+
+            // iterates all parameters of active preset in stored order, no allocations
+            template<typename F>
+            void ForEachParam(F &&f) const {
+                for (const auto &p : activeParams) {
+                    f(PresetParam {&activeIds[p.idOffset], p.idLen, p.current, p.cv, p.trig,
+                                   (p.flags & HAS_CV) != 0, (p.flags & HAS_TRIG) != 0});
+                }
+            }
+
+            // iterates all parameters of stored preset num, returns false if preset does not exist
+            // stored presets must be read with ReloadPresets before
+            template<typename F>
+            bool ForEachPresetParam(const int num, F &&f) const {
+                const Value *preset = getStoredPreset(num);
+                if (preset == nullptr) return false;
+                forEachParamOf(*preset, f);
+                return true;
+            }
+
+            // reads stored presets from file, e.g. if they were changed by preset upload
+            void ReloadPresets();
+
+            // frees stored presets read by ReloadPresets
+            void ReleasePresets();
+
             bool IsParamTrig(const string &id);
 
             bool IsParamCV(const string &id);
@@ -63,14 +115,86 @@ namespace CTAG {
             void PrintSelf();
 
         private:
-            void recursiveFindAndInsert(const Value &paramF, Value &paramI);
-
-            // merge ui and preset models
+            template<typename F>
+            static void forEachParamOf(const Value &preset, F &&f) {
+                if (!preset.IsObject() || !preset.HasMember("params")) return;
+                const Value &patchParams = preset["params"];
+                if (!patchParams.IsArray()) return;
+                for (const auto &v : patchParams.GetArray()) {
+                    auto id = v.FindMember("id");
+                    if (id == v.MemberEnd() || !id->value.IsString()) return;
+                    PresetParam pp {id->value.GetString(), id->value.GetStringLength(), 0, 0, 0, false, false};
+                    auto it = v.FindMember("current");
+                    if (it != v.MemberEnd() && it->value.IsInt()) pp.current = it->value.GetInt();
+                    it = v.FindMember("cv");
+                    if (it != v.MemberEnd() && it->value.IsInt()) {
+                        pp.cv = it->value.GetInt();
+                        pp.hasCV = true;
+                    }
+                    it = v.FindMember("trig");
+                    if (it != v.MemberEnd() && it->value.IsInt()) {
+                        pp.trig = it->value.GetInt();
+                        pp.hasTrig = true;
+                    }
+                    f(pp);
+                }
+            }
+
+            const Value *getStoredPreset(const int num) const;
+
+            ctagSPDataModel() = default; // used as file loader for staging
+
+            // copies preset num of mp to active preset, stores mp only if active patch number changed
+            void selectPreset(const int num);
+
+            // reads preset num (-1 is active patch of store) from binary store, false if store is not up to date
+            bool loadStoredPreset(const int num);
+
+            // active preset from / to json preset object {name, params: [{id, current, cv | trig}]}
+            void setActivePreset(const Value &preset);
+
+            void writeActivePreset(Value &preset, Document::AllocatorType &allocator) const;
+
+            // frees memory of document
+            static void release(Document &d);
+
+            void recursiveFindAndInsert(const Value &paramF, const uint8_t flags, Value &paramI);
+
+            // merge ui and active preset models
             void mergeModels();
 
-            Document mui, mp;
+            // parameter of active preset, 16 bytes instead of a json object per parameter
+            enum ParamFlags : uint8_t {
+                HAS_CV = 1,
+                HAS_TRIG = 2
+            };
+            struct ActiveParam {
+                uint16_t idOffset; // into activeIds
+                uint8_t idLen;
+                uint8_t flags;
+                int32_t current;
+                int16_t cv, trig; // input channel numbers
+                uint32_t version; // of last change
+            };
+
+            // new version of active parameters, after the whole set has been replaced
+            void replacedActiveParams();
+
+            int findActiveParam(const string &id) const;
+
+            Document mui, mp; // only valid during api calls
             string mpFileName, muiFileName;
-            Document activePreset;
+            string activeName, activeIds; // ids are '\0' separated
+            vector<ActiveParam> activeParams;
+            int activePatch {0};
+            uint32_t storeIdsCrc {0}; // crc of preset store id table if activeIds is that table, else 0
+            uint32_t baseVersion {0}; // version at which active parameter set has been replaced
+
+            // versions of parameter changes, shared by all models so they increase across plugin changes
+            static std::atomic<uint32_t> versionCounter;
+
+            static string stagedID;
+            static Document stagedMp;
         };
     }
 }
@@ -0,0 +1,250 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "ctagSPPresetStore.hpp"
+#include <sys/stat.h>
+#include <cstring>
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "ctagDataModelBase.hpp"
+
+#define PS_MAGIC 0x50444254 // TBDP
+#define PS_VERSION 2
+
+using namespace CTAG::SP;
+using namespace rapidjson;
+
+std::mutex ctagSPPresetStore::verifiedMutex;
+std::map<std::string, ctagSPPresetStore::Verified> ctagSPPresetStore::verified;
+
+ctagSPPresetStore::ctagSPPresetStore(const std::string &jsonFileName) : jsonFn(jsonFileName),
+                                                                        binFn(binFileName(jsonFileName)) {
+}
+
+ctagSPPresetStore::~ctagSPPresetStore() {
+    if (fp != nullptr) fclose(fp);
+}
+
+std::string ctagSPPresetStore::binFileName(const std::string &jsonFileName) {
+    const size_t dot = jsonFileName.rfind('.');
+    return jsonFileName.substr(0, dot) + ".bin";
+}
+
+int32_t ctagSPPresetStore::jsonSize(const std::string &fn) {
+    struct stat st;
+    if (stat(fn.c_str(), &st) != 0) return -1;
+    return st.st_size;
+}
+
+bool ctagSPPresetStore::jsonCrc(const std::string &fn, uint32_t &crc) {
+    FILE *f = fopen(fn.c_str(), "rb");
+    if (f == nullptr) return false;
+    uint8_t buf[256];
+    size_t n;
+    crc = 0;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) crc = esp_rom_crc32_le(crc, buf, n);
+    const bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
+
+uint32_t ctagSPPresetStore::headerCrc(const Header &h) {
+    return esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(&h), offsetof(Header, crc));
+}
+
+bool ctagSPPresetStore::readHeader() {
+    return fread(&header, sizeof(Header), 1, fp) == 1 && header.magic == PS_MAGIC && header.version == PS_VERSION &&
+           header.crc == headerCrc(header);
+}
+
+// json is current if it has the crc the store was built from, size is compared first as it needs no read
+bool ctagSPPresetStore::jsonCurrent() {
+    if (static_cast<int32_t>(header.jsonSize) != jsonSize(jsonFn)) return false;
+    // count is taken before reading, a write meanwhile fails the next check
+    const uint32_t writeCount = ctagDataModelBase::GetWriteCount(jsonFn);
+    {
+        std::lock_guard<std::mutex> lock(verifiedMutex);
+        auto it = verified.find(jsonFn);
+        if (it != verified.end() && it->second.writeCount == writeCount) return it->second.crc == header.jsonCrc;
+    }
+    uint32_t crc;
+    if (!jsonCrc(jsonFn, crc)) return false;
+    std::lock_guard<std::mutex> lock(verifiedMutex);
+    verified[jsonFn] = Verified {crc, writeCount};
+    return crc == header.jsonCrc;
+}
+
+bool ctagSPPresetStore::Open(std::string &ids, uint32_t &idsCrc) {
+    if (fp != nullptr) fclose(fp);
+    fp = fopen(binFn.c_str(), "rb");
+    if (fp == nullptr) return false;
+    if (!readHeader() || !jsonCurrent()) {
+        ESP_LOGI("PresetStore", "%s is outdated", binFn.c_str());
+        fclose(fp);
+        fp = nullptr;
+        return false;
+    }
+    if (header.idsCrc == idsCrc) return true; // caller already holds id table
+    std::string tmp(header.idsSize, '\0');
+    if (fread(&tmp[0], 1, header.idsSize, fp) != header.idsSize ||
+        esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(tmp.data()), tmp.size()) != header.idsCrc) {
+        ESP_LOGE("PresetStore", "%s has a damaged id table", binFn.c_str());
+        fclose(fp);
+        fp = nullptr;
+        return false;
+    }
+    ids.swap(tmp);
+    idsCrc = header.idsCrc;
+    return true;
+}
+
+bool ctagSPPresetStore::Read(const int num, std::string &name, std::vector<Entry> &entries) {
+    if (fp == nullptr || num < 0 || num >= header.nPresets) return false;
+    RecordHeader rh;
+    entries.resize(header.nParams);
+    if (fseek(fp, recordOffset(num), SEEK_SET) != 0 ||
+        fread(&rh, sizeof(RecordHeader), 1, fp) != 1 ||
+        fread(entries.data(), sizeof(Entry), header.nParams, fp) != header.nParams) {
+        return false;
+    }
+    uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(rh.name), nameLen);
+    crc = esp_rom_crc32_le(crc, reinterpret_cast<const uint8_t *>(entries.data()), header.nParams * sizeof(Entry));
+    if (crc != rh.crc) {
+        ESP_LOGE("PresetStore", "%s preset %d is damaged", binFn.c_str(), num);
+        return false;
+    }
+    // names which don't fit are not terminated, such presets are read from json
+    if (rh.name[nameLen - 1] != '\0') return false;
+    name = rh.name;
+    return true;
+}
+
+void ctagSPPresetStore::WriteActivePatch(const int num) {
+    if (fp == nullptr || num == header.activePatch) return;
+    fclose(fp);
+    fp = fopen(binFn.c_str(), "r+b");
+    if (fp == nullptr) return;
+    header.activePatch = num;
+    header.crc = headerCrc(header);
+    fwrite(&header, sizeof(Header), 1, fp);
+    fflush(fp);
+}
+
+void ctagSPPresetStore::Build(const Document &mp) {
+    if (fp != nullptr) fclose(fp);
+    fp = nullptr;
+    if (!mp.IsObject() || !mp.HasMember("patches") || !mp["patches"].IsArray()) return;
+    const auto &patches = mp["patches"].GetArray();
+    // parameter index is union of ids of all presets in order of appearance
+    std::string ids;
+    std::vector<std::pair<const char *, uint32_t>> index;
+    auto find = [&index](const char *id, const uint32_t len) {
+        for (size_t i = 0; i < index.size(); i++)
+            if (index[i].second == len && memcmp(index[i].first, id, len) == 0) return static_cast<int>(i);
+        return -1;
+    };
+    for (const auto &p : patches) {
+        if (!p.HasMember("params") || !p["params"].IsArray()) continue;
+        for (const auto &v : p["params"].GetArray()) {
+            if (!v.HasMember("id") || !v["id"].IsString()) continue;
+            const char *id = v["id"].GetString();
+            const uint32_t len = v["id"].GetStringLength();
+            if (find(id, len) >= 0) continue;
+            index.emplace_back(id, len);
+            ids.append(id, len);
+            ids.push_back('\0');
+        }
+    }
+    if (index.size() > UINT16_MAX || patches.Size() > UINT16_MAX) return;
+
+    header = Header {PS_MAGIC, PS_VERSION, static_cast<uint16_t>(index.size()),
+                     static_cast<uint16_t>(patches.Size()), 0, 0, 0, static_cast<uint32_t>(ids.size()),
+                     esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(ids.data()), ids.size()), 0};
+    if (mp.HasMember("activePatch") && mp["activePatch"].IsInt()) header.activePatch = mp["activePatch"].GetInt();
+    // with deferred writes the json file may still hold the previous content, the store then is rebuilt once the
+    // write has happened
+    const uint32_t writeCount = ctagDataModelBase::GetWriteCount(jsonFn);
+    const int32_t size = jsonSize(jsonFn);
+    if (size < 0 || !jsonCrc(jsonFn, header.jsonCrc)) return;
+    header.jsonSize = size;
+    header.crc = headerCrc(header);
+    {
+        std::lock_guard<std::mutex> lock(verifiedMutex);
+        verified[jsonFn] = Verified {header.jsonCrc, writeCount};
+    }
+
+    FILE *f = fopen(binFn.c_str(), "wb");
+    if (f == nullptr) {
+        ESP_LOGE("PresetStore", "could not open file %s", binFn.c_str());
+        return;
+    }
+    fwrite(&header, sizeof(Header), 1, f);
+    fwrite(ids.data(), 1, ids.size(), f);
+    RecordHeader rh;
+    std::vector<Entry> entries(index.size());
+    for (const auto &p : patches) {
+        memset(&rh, 0, sizeof(RecordHeader));
+        memset(entries.data(), 0, entries.size() * sizeof(Entry));
+        if (p.HasMember("name") && p["name"].IsString())
+            strncpy(rh.name, p["name"].GetString(), nameLen);
+        if (p.HasMember("params") && p["params"].IsArray()) {
+            for (const auto &v : p["params"].GetArray()) {
+                if (!v.HasMember("id") || !v["id"].IsString()) continue;
+                Entry &e = entries[find(v["id"].GetString(), v["id"].GetStringLength())];
+                e.flags = PRESENT;
+                auto it = v.FindMember("current");
+                if (it != v.MemberEnd() && it->value.IsInt()) e.current = it->value.GetInt();
+                it = v.FindMember("cv");
+                if (it != v.MemberEnd() && it->value.IsInt()) {
+                    e.cv = it->value.GetInt();
+                    e.flags |= HAS_CV;
+                }
+                it = v.FindMember("trig");
+                if (it != v.MemberEnd() && it->value.IsInt()) {
+                    e.trig = it->value.GetInt();
+                    e.flags |= HAS_TRIG;
+                }
+            }
+        }
+        rh.crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(rh.name), nameLen);
+        rh.crc = esp_rom_crc32_le(rh.crc, reinterpret_cast<const uint8_t *>(entries.data()),
+                                  entries.size() * sizeof(Entry));
+        fwrite(&rh, sizeof(RecordHeader), 1, f);
+        fwrite(entries.data(), sizeof(Entry), entries.size(), f);
+    }
+    fflush(f);
+    fclose(f);
+    ESP_LOGI("PresetStore", "Built %s, %d presets of %d parameters", binFn.c_str(), header.nPresets,
+             header.nParams);
+}
+
+void ctagSPPresetStore::Invalidate(const std::string &jsonFileName) {
+    remove(binFileName(jsonFileName).c_str());
+    std::lock_guard<std::mutex> lock(verifiedMutex);
+    verified.erase(jsonFileName);
+}
+
+int ctagSPPresetStore::ReadActivePatch(const std::string &jsonFileName) {
+    ctagSPPresetStore store(jsonFileName);
+    store.fp = fopen(store.binFn.c_str(), "rb");
+    if (store.fp == nullptr || !store.readHeader()) return -1;
+    return store.header.activePatch;
+}
@@ -0,0 +1,137 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// binary preset store of a sound processor, kept next to the json preset file mp-<id>.jsn as mp-<id>.bin
+// layout: header | parameter ids ('\0' separated, defines parameter index) | nPresets fixed size records
+// record: crc | name | one entry per parameter index, so a preset is read with a single seek and read
+// the store is derived data, it is rebuilt from the json file whenever that has changed (crc of json is kept
+// in header) or a crc does not match, the json file stays the reference for the web ui and backups
+// exception is the active patch, recall updates it in the store header only, so the store is authoritative for it
+// while its header is intact, json activePatch is brought up to date whenever the model writes the json file
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include "rapidjson/document.h"
+
+namespace CTAG {
+    namespace SP {
+        class ctagSPPresetStore final {
+        public:
+            // entry flags, HAS_CV and HAS_TRIG match the flags of the data model
+            enum EntryFlags : uint8_t {
+                HAS_CV = 1,
+                HAS_TRIG = 2,
+                PRESENT = 4 // parameter is part of the preset
+            };
+
+            struct Entry {
+                int32_t current;
+                int16_t cv;
+                int8_t trig;
+                uint8_t flags;
+            };
+
+            static constexpr uint32_t nameLen = 48;
+
+            explicit ctagSPPresetStore(const std::string &jsonFileName);
+
+            ~ctagSPPresetStore();
+
+            // checks header against json file, reads parameter id table if it differs from idsCrc
+            bool Open(std::string &ids, uint32_t &idsCrc);
+
+            // store must be open, reads preset num, returns false if it does not exist or is damaged
+            bool Read(const int num, std::string &name, std::vector<Entry> &entries);
+
+            int GetNumPresets() const { return header.nPresets; }
+
+            int GetActivePatch() const { return header.activePatch; }
+
+            // updates active patch number in header only, the store is authoritative for it
+            void WriteActivePatch(const int num);
+
+            // builds store from parsed json preset file, which must just have been read or written
+            void Build(const rapidjson::Document &mp);
+
+            // forces a rebuild on next access, e.g. after json has been replaced
+            static void Invalidate(const std::string &jsonFileName);
+
+            // active patch of an intact store header even if json has changed since build, -1 if there is none
+            static int ReadActivePatch(const std::string &jsonFileName);
+
+        private:
+            struct Header {
+                uint32_t magic;
+                uint16_t version;
+                uint16_t nParams;
+                uint16_t nPresets;
+                uint16_t activePatch;
+                uint32_t jsonSize; // size and crc of json file store has been built from
+                uint32_t jsonCrc;
+                uint32_t idsSize;
+                uint32_t idsCrc;
+                uint32_t crc; // of header up to here
+            };
+
+            struct RecordHeader {
+                uint32_t crc; // of name and entries
+                char name[nameLen];
+            };
+
+            static std::string binFileName(const std::string &jsonFileName);
+
+            static int32_t jsonSize(const std::string &fn);
+
+            static bool jsonCrc(const std::string &fn, uint32_t &crc);
+
+            bool readHeader();
+
+            bool jsonCurrent();
+
+            static uint32_t headerCrc(const Header &h);
+
+            uint32_t recordSize() const { return sizeof(RecordHeader) + header.nParams * sizeof(Entry); }
+
+            uint32_t recordOffset(const int num) const {
+                return sizeof(Header) + header.idsSize + num * recordSize();
+            }
+
+            std::string jsonFn, binFn;
+            Header header {};
+            FILE *fp {nullptr}; // open between Open and destruction
+
+            // crc of json files computed in this session, valid until the file is written again, saves reading the
+            // json on every Open
+            struct Verified {
+                uint32_t crc;
+                uint32_t writeCount;
+            };
+            static std::mutex verifiedMutex;
+            static std::map<std::string, Verified> verified;
+        };
+    }
+}
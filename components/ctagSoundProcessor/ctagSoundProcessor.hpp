@@ -60,23 +60,123 @@ respective component folders / files if different from this license.
     float outname = (inname/norm+1.f)/2.f * scale; \
     if(cv_##inname != -1) outname = fabsf(data.cv[cv_##inname]) * scale; 
 
+// smoothed variants, outname is a per sample ramp over the block (float[bufSz]),
+// smoother is a HELPERS::ctagSmoothedParam member of the plugin
+// if plugin uses audio rate cv (data.cvBlock set) and param is cv controlled, cv is taken per sample instead
+#define MK_FLT_PAR_ABS_SMOOTH(outname, inname, norm, scale, smoother) \
+    float outname[bufSz]; \
+    if(cv_##inname != -1 && static_cast<uint32_t>(cv_##inname) < data.nCVBlock) { \
+        const float *outname##_cv = &data.cvBlock[cv_##inname * bufSz]; \
+        for(int outname##_i = 0; outname##_i < bufSz; outname##_i++) \
+            outname[outname##_i] = fabsf(outname##_cv[outname##_i]) * scale; \
+        smoother.Reset(outname[bufSz - 1]); \
+    } else { \
+        MK_FLT_PAR_ABS(outname##_target, inname, norm, scale) \
+        smoother.Process(outname##_target, outname, bufSz); \
+    }
+
+#define MK_FLT_PAR_SMOOTH(outname, inname, norm, scale, smoother) \
+    float outname[bufSz]; \
+    if(cv_##inname != -1 && static_cast<uint32_t>(cv_##inname) < data.nCVBlock) { \
+        const float *outname##_cv = &data.cvBlock[cv_##inname * bufSz]; \
+        for(int outname##_i = 0; outname##_i < bufSz; outname##_i++) \
+            outname[outname##_i] = outname##_cv[outname##_i] * scale; \
+        smoother.Reset(outname[bufSz - 1]); \
+    } else { \
+        MK_FLT_PAR(outname##_target, inname, norm, scale) \
+        smoother.Process(outname##_target, outname, bufSz); \
+    }
+
 
 #include <stdint.h>
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 #include <functional>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <cassert>
 #include "ctagSPDataModel.hpp"
 #include "ctagSPAllocator.hpp"
+#include "helpers/ctagSPSCQueue.hpp"
+#include "helpers/ctagParamMorph.hpp"
+#include "helpers/ctagSmoothedParam.hpp"
+
+// audio block size in frames, set by build system (Kconfig CONFIG_TBD_AUDIO_BLOCK_SIZE / simulator TBD_BLOCK_SIZE)
+#ifndef TBD_BLOCK_SIZE
+#define TBD_BLOCK_SIZE 32
+#endif
 
 using namespace std;
 
+// parameter table entries, emitted by generator into knowYourself()
+#define MK_PARAM_INT(cls, name) \
+    {ParamHash(#name), #name, static_cast<atomic<int32_t> ctagSoundProcessor::*>(&cls::name), \
+    static_cast<atomic<int32_t> ctagSoundProcessor::*>(&cls::cv_##name), ctagParamDesc::INT}
+
+#define MK_PARAM_BOOL(cls, name) \
+    {ParamHash(#name), #name, static_cast<atomic<int32_t> ctagSoundProcessor::*>(&cls::name), \
+    static_cast<atomic<int32_t> ctagSoundProcessor::*>(&cls::trig_##name), ctagParamDesc::BOOL}
+
 namespace CTAG {
     namespace SP {
         struct ProcessData {
-            float *buf;
+            float *buf; // interleaved stereo, bufSz frames
             float *cv;
             uint8_t *trig;
+            uint32_t bufSz {TBD_BLOCK_SIZE}; // frames in buf
+            // audio rate cvs, nCVBlock x bufSz channel major (cv ch starts at ch * bufSz), interpolated from block rate cvs,
+            // only set for plugins which request it by GetUsesAudioRateCV, nullptr / 0 otherwise
+            const float *cvBlock {nullptr};
+            uint32_t nCVBlock {0};
+        };
+
+        // FNV-1a hash of parameter ids, compile time for tables, run time for lookups
+        constexpr uint32_t ParamHash(const char *s, std::size_t len) {
+            uint32_t h = 2166136261u;
+            for (std::size_t i = 0; i < len; i++) {
+                h ^= static_cast<uint8_t>(s[i]);
+                h *= 16777619u;
+            }
+            return h;
+        }
+
+        constexpr uint32_t ParamHash(const char *s) {
+            std::size_t len = 0;
+            while (s[len] != '\0') len++;
+            return ParamHash(s, len);
+        }
+
+        // which value of a parameter is addressed, maps to "current", "cv", "trig" of data model
+        enum ParamKey : uint8_t {
+            PARAM_CURRENT,
+            PARAM_CV,
+            PARAM_TRIG,
+            PARAM_INVALID
+        };
+
+        inline ParamKey ParamKeyFromString(const string &key) {
+            if (key.compare("current") == 0) return PARAM_CURRENT;
+            if (key.compare("cv") == 0) return PARAM_CV;
+            if (key.compare("trig") == 0) return PARAM_TRIG;
+            return PARAM_INVALID;
+        }
+
+        class ctagSoundProcessor;
+
+        // describes one parameter of a sound processor, tables are constexpr and live in flash
+        struct ctagParamDesc {
+            enum Kind : uint8_t {
+                INT, // modulated by cv
+                BOOL // modulated by trig
+            };
+            uint32_t hash;
+            const char *id;
+            atomic<int32_t> ctagSoundProcessor::*value;
+            atomic<int32_t> ctagSoundProcessor::*mod; // cv_ or trig_ member
+            Kind kind;
         };
 
         class ctagSoundProcessor {
@@ -86,15 +186,31 @@ namespace CTAG {
             // plugins will need to make sure not to use more than blocksize bytes of data
             virtual void Init(std::size_t blockSize, void *blockPtr) = 0;
 
+            // bytes of blockMem needed in Init, plugins using blockMem hide this with their own declaration
+            // mono plugins get exactly this, stereo plugins get the remaining arena, see ctagSPAllocator
+            static constexpr std::size_t blockMemSize = 0;
+
             virtual ~ctagSoundProcessor() {};
 
             void* operator new (std::size_t size) {
                 return ctagSPAllocator::Allocate(size);
             }
 
+            // over aligned plugins, e.g. with alignas members
+            void* operator new (std::size_t size, std::align_val_t align) {
+                void *ptr = ctagSPAllocator::Allocate(ctagSPAllocator::Round(size), static_cast<std::size_t>(align),
+                                                      ctagSPAllocator::Region::INTERNAL);
+                assert(nullptr != ptr);
+                return ptr;
+            }
+
             void operator delete (void *ptr) noexcept {
                 // arena allocator will just reset the arena
             }
+
+            void operator delete (void *ptr, std::align_val_t align) noexcept {
+                // arena allocator will just reset the arena
+            }
             void* operator new[] (std::size_t size) = delete;
             void* operator new[] (std::size_t size, const std::nothrow_t& tag) = delete;
             void operator delete[] (void *ptr) noexcept = delete;
@@ -105,30 +221,140 @@ namespace CTAG {
 
             const char *GetCStrJSONParamSpecs() const { return model->GetCStrJSONParams(); }
 
+            // parameters changed after version since, see ctagSPDataModel
+            const char *GetCStrJSONParamDelta(const uint32_t since) const { return model->GetCStrJSONParamDelta(since); }
+
             virtual const char *GetCStrID() { return id.c_str(); }
             virtual const string& GetID() { return id; }
 
+            // parameter table access, index is dense 0..GetNumParams()-1
+            int GetNumParams() const { return nParams; }
+
+            const ctagParamDesc *GetParamDesc(const int index) const {
+                if (index < 0 || index >= nParams) return nullptr;
+                return &params[index];
+            }
+
+            // returns -1 if not found, hint is the index tried first
+            int GetParamIndex(const char *id, const std::size_t len, const int hint = -1) const {
+                if (hint >= 0 && hint < nParams && isParamAt(hint, id, len)) return hint;
+                const uint32_t h = ParamHash(id, len);
+                for (int i = 0; i < nParams; i++) {
+                    if (params[i].hash == h && isParamAt(i, id, len)) return i;
+                }
+                return -1;
+            }
+
+            int GetParamIndex(const string &id) const { return GetParamIndex(id.c_str(), id.length()); }
+
+            // called by api thread, parameter is resolved here and applied by audio thread at start of next block,
+            // i.e. with block granularity, updates are not sample accurate
             void SetParamValue(const string &id, const string &key, const int val) {
-                setParamValueInternal(id, key, val); // as immediate as possible
+                const int index = GetParamIndex(id);
+                const ParamKey k = ParamKeyFromString(key);
+                if (index < 0 || k == PARAM_INVALID) {
+                    // plugins w/o parameter table --> set immediately
+                    setParamValueInternal(id, key, val);
+                } else if (overflowPending.load(std::memory_order_acquire)
+                           || !paramEvents->Push({static_cast<uint16_t>(index), k, val})) {
+                    // queue full, once values wait in overflow table later ones go there too so queue can't
+                    // override them with older values
+                    pushOverflow(index, k, val);
+                }
                 model->SetParamValue(id, key, val);
             }
 
+            // called by audio thread before Process, applies all pending parameter updates
+            void ApplyParamEvents() {
+                ParamEvent e;
+                while (paramEvents->Pop(e)) setParamValueByIndex(e.index, e.key, e.value);
+                if (!overflowPending.exchange(false, std::memory_order_acq_rel)) return;
+                // values queued later by api thread are applied next block, after these
+                const int nWords = (nParams * PARAM_INVALID + 31) / 32;
+                for (int w = 0; w < nWords; w++) {
+                    uint32_t bits = overflowDirty[w].exchange(0, std::memory_order_acquire);
+                    while (bits != 0) {
+                        const int slot = w * 32 + __builtin_ctz(bits);
+                        bits &= bits - 1;
+                        setParamValueByIndex(slot / PARAM_INVALID, static_cast<ParamKey>(slot % PARAM_INVALID),
+                                             overflowValues[slot].load(std::memory_order_relaxed));
+                    }
+                }
+            }
+
             const char *GetCStrJSONPresets() { return model->GetCStrJSONPresets(); }
 
             const char *GetCStrJSONAllPresetData() { return model->GetCStrJSONAllPresetData(); }
 
             bool GetIsStereo() const { return isStereo; }
 
+            // plugin reads data.cvBlock, i.e. cvs are interpolated to audio rate for it
+            bool GetUsesAudioRateCV() const { return usesAudioRateCV; }
+
             void SavePreset(const string &name, const int number) { model->SavePreset(name, number); }
 
+            // must not run concurrently with Process, pending events are flushed so they don't override preset
             void LoadPreset(const int number) {
+                PrepareLoadPreset(number);
+                ApplyLoadedPreset();
+            }
+
+            // two phase preset load, file access happens in PrepareLoadPreset while audio keeps running,
+            // ApplyLoadedPreset must not run concurrently with Process
+            void PrepareLoadPreset(const int number) {
                 model->LoadPreset(number); // first get the data into the model
+            }
+
+            void ApplyLoadedPreset() {
+                ApplyParamEvents();
+                if (morph != nullptr) morph->Stop();
                 loadPresetInternal();
             }
 
+            // preset morphing, parameter vectors of both presets are computed here by api thread,
+            // returns false if plugin has no parameter table or presets don't exist
+            bool PrepareMorph(const int presetA, const int presetB, const int timeMs, const int cv) {
+                if (nParams == 0) return false;
+                std::vector<int32_t> va(nParams), vb(nParams);
+                for (int i = 0; i < nParams; i++) va[i] = vb[i] = this->*(params[i].value);
+                model->ReloadPresets();
+                auto collect = [this](std::vector<int32_t> &v) {
+                    return [&v, this, hint = 0](const ctagSPDataModel::PresetParam &pp) mutable {
+                        const int index = GetParamIndex(pp.id, pp.idLen, hint);
+                        if (index < 0) return;
+                        hint = index + 1;
+                        v[index] = pp.current;
+                    };
+                };
+                const bool found = model->ForEachPresetParam(presetA, collect(va)) &&
+                                   model->ForEachPresetParam(presetB, collect(vb));
+                model->ReleasePresets();
+                if (!found) return false;
+                if (pendingMorph == nullptr) pendingMorph = std::make_unique<HELPERS::ctagParamMorph>();
+                pendingMorph->Clear();
+                for (int i = 0; i < nParams; i++) pendingMorph->Add(i, va[i], vb[i]);
+                pendingMorph->Start(timeMs, cv >= -1 && cv < N_CVS ? cv : -1, bufSz);
+                return true;
+            }
+
+            // must not run concurrently with Process, previous morph is kept for reuse by next PrepareMorph
+            void ApplyPreparedMorph() {
+                ApplyParamEvents();
+                morph.swap(pendingMorph);
+            }
+
+            // called by audio thread before Process, interpolates morphed parameters
+            void ProcessMorph(const float *cv) {
+                if (morph == nullptr || !morph->Process(cv)) return;
+                const uint32_t n = morph->GetSize();
+                for (uint32_t i = 0; i < n; i++) this->*(params[morph->GetIndex(i)].value) = morph->GetValue(i);
+            }
+
             std::string GetActivePluginParameters() { return model->GetActivePluginParameters(); }
             void SetActivePluginParameters(std::string const& p) {
+                ApplyParamEvents();
                 model->SetActivePluginParameters(p);
+                if (morph != nullptr) morph->Stop();
                 loadPresetInternal();
             }
 
@@ -136,59 +362,97 @@ namespace CTAG {
 
             virtual void knowYourself() = 0;
 
+            template<std::size_t N>
+            void setParamTable(const ctagParamDesc (&table)[N]) {
+                static_assert(N < 65536, "Too many parameters");
+                params = table;
+                nParams = N;
+            }
+
+            // dense setter, cv and trig indices are range checked
+            void setParamValueByIndex(const int index, const ParamKey key, const int val) {
+                const ctagParamDesc &p = params[index];
+                switch (key) {
+                    case PARAM_CURRENT:
+                        this->*(p.value) = val;
+                        break;
+                    case PARAM_CV:
+                        if (p.kind == ctagParamDesc::INT && val >= -1 && val < N_CVS) this->*(p.mod) = val;
+                        break;
+                    case PARAM_TRIG:
+                        if (p.kind == ctagParamDesc::BOOL && val >= -1 && val < N_TRIGS) this->*(p.mod) = val;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
             virtual void setParamValueInternal(const string &id, const string &key, const int val) {
                 //printf("%s, %s, %d\n", id.c_str(), key.c_str(), val);
-                if (key.compare("current") == 0) {
-                    auto it = pMapPar.find(id);
-                    if (it != pMapPar.end()) {
-                        (it->second)(val);
-                    }
-                    return;
-                }
-                if (key.compare("cv") == 0) {
-                    if (val >= -1 && val < N_CVS) {
-                        auto it = pMapCv.find(id);
-                        if (it != pMapCv.end()) {
-                            (it->second)(val);
-                        }
-                    }
-                    return;
-                }
-                if (key.compare("trig") == 0) {
-                    if (val >= -1 && val < N_TRIGS) {
-                        auto it = pMapTrig.find(id);
-                        if (it != pMapTrig.end()) {
-                            (it->second)(val);
-                        }
-                    }
-                    return;
-                }
+                const int index = GetParamIndex(id);
+                if (index < 0) return;
+                setParamValueByIndex(index, ParamKeyFromString(key), val);
             };
 
             virtual void loadPresetInternal() {
-                // iterate all parameters, take names from parameter map (first element)
-                for (const auto &kv: pMapPar) {
-                    setParamValueInternal(kv.first, "current", model->GetParamValue(kv.first, "current"));
+                // single pass over preset, preset order usually matches table order so the hint mostly hits
+                int hint = 0;
+                model->ForEachParam([&](const ctagSPDataModel::PresetParam &pp) {
+                    const int index = GetParamIndex(pp.id, pp.idLen, hint);
+                    if (index < 0) return;
+                    hint = index + 1;
+                    setParamValueByIndex(index, PARAM_CURRENT, pp.current);
                     // check if cv and trig are set in preset, if so set in processor param
-                    if (model->IsParamCV(kv.first)) {
-                        //ESP_LOGW("MOdel", "IntParam %s, %d", name.c_str(), model->GetParamValue(name, "cv"));
-                        setParamValueInternal(kv.first, "cv", model->GetParamValue(kv.first, "cv"));
-                    } else if (model->IsParamTrig(kv.first)) {
-                        //ESP_LOGW("MOdel", "BoolParam %s, %d", name.c_str(), model->GetParamValue(name, "trig"));
-                        setParamValueInternal(kv.first, "trig", model->GetParamValue(kv.first, "trig"));
+                    if (pp.hasCV) {
+                        setParamValueByIndex(index, PARAM_CV, pp.cv);
+                    } else if (pp.hasTrig) {
+                        setParamValueByIndex(index, PARAM_TRIG, pp.trig);
                     }
-                }
+                });
             };
 
             bool isStereo = false;
-            int const bufSz = 32;
+            bool usesAudioRateCV = false; // set in Init if plugin wants data.cvBlock
+            static constexpr int bufSz = TBD_BLOCK_SIZE;
             int processCh = 0;
             int instance {0};
             std::unique_ptr<ctagSPDataModel> model = nullptr;
             string id = "";
-            map<string, function<void(const int)>> pMapPar;
-            map<string, function<void(const int)>> pMapCv;
-            map<string, function<void(const int)>> pMapTrig;
+
+        private:
+            bool isParamAt(const int index, const char *id, const std::size_t len) const {
+                return strncmp(params[index].id, id, len) == 0 && params[index].id[len] == '\0';
+            }
+
+            // api thread, allocated on first overflow, audio thread only accesses table after seeing overflowPending
+            void pushOverflow(const int index, const ParamKey key, const int val) {
+                if (overflowValues == nullptr) {
+                    overflowValues = std::make_unique<std::atomic<int32_t>[]>(nParams * PARAM_INVALID);
+                    overflowDirty = std::make_unique<std::atomic<uint32_t>[]>((nParams * PARAM_INVALID + 31) / 32);
+                }
+                const int slot = index * PARAM_INVALID + key;
+                overflowValues[slot].store(val, std::memory_order_relaxed);
+                overflowDirty[slot / 32].fetch_or(1u << (slot % 32), std::memory_order_release);
+                overflowPending.store(true, std::memory_order_release);
+            }
+
+            // pre-resolved parameter update
+            struct ParamEvent {
+                uint16_t index;
+                ParamKey key;
+                int32_t value;
+            };
+            // heap allocated, keeps sound processor arena footprint small
+            std::unique_ptr<HELPERS::ctagSPSCQueue<ParamEvent, 64>> paramEvents
+                    = std::make_unique<HELPERS::ctagSPSCQueue<ParamEvent, 64>>();
+            // latest value per parameter and key of updates which didn't fit the queue, coalesced so none is lost
+            std::unique_ptr<std::atomic<int32_t>[]> overflowValues;
+            std::unique_ptr<std::atomic<uint32_t>[]> overflowDirty; // bit per slot index * PARAM_INVALID + key
+            std::atomic<bool> overflowPending {false};
+            // preset morph owned by audio thread and morph being prepared by api thread, heap allocated on first use
+            std::unique_ptr<HELPERS::ctagParamMorph> morph, pendingMorph;
+            const ctagParamDesc *params = nullptr;
+            uint16_t nParams = 0;
         };
     }
-}
\ No newline at end of file
+}
@@ -297,50 +297,31 @@ ctagSoundProcessorAPCpp::~ctagSoundProcessorAPCpp()
 void ctagSoundProcessorAPCpp::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("MOD_freq_1", [&](const int val){ MOD_freq_1 = val;});
-    pMapCv.emplace("MOD_freq_1", [&](const int val){ cv_MOD_freq_1 = val;});
-    pMapPar.emplace("Freq_1", [&](const int val){ Freq_1 = val;});
-    pMapCv.emplace("Freq_1", [&](const int val){ cv_Freq_1 = val;});
-    pMapPar.emplace("MOD_active_1", [&](const int val){ MOD_active_1 = val;});
-    pMapTrig.emplace("MOD_active_1", [&](const int val){ trig_MOD_active_1 = val;});
-    pMapPar.emplace("MOD_is_PWM_1", [&](const int val){ MOD_is_PWM_1 = val;});
-    pMapTrig.emplace("MOD_is_PWM_1", [&](const int val){ trig_MOD_is_PWM_1 = val;});
-    pMapPar.emplace("SmoothOSC_1", [&](const int val){ SmoothOSC_1 = val;});
-    pMapTrig.emplace("SmoothOSC_1", [&](const int val){ trig_SmoothOSC_1 = val;});
-    pMapPar.emplace("SmoothOSC_2", [&](const int val){ SmoothOSC_2 = val;});
-    pMapTrig.emplace("SmoothOSC_2", [&](const int val){ trig_SmoothOSC_2 = val;});
-    pMapPar.emplace("MOD_is_PWM_2", [&](const int val){ MOD_is_PWM_2 = val;});
-    pMapTrig.emplace("MOD_is_PWM_2", [&](const int val){ trig_MOD_is_PWM_2 = val;});
-    pMapPar.emplace("MOD_active_2", [&](const int val){ MOD_active_2 = val;});
-    pMapTrig.emplace("MOD_active_2", [&](const int val){ trig_MOD_active_2 = val;});
-    pMapPar.emplace("Freq_2", [&](const int val){ Freq_2 = val;});
-    pMapCv.emplace("Freq_2", [&](const int val){ cv_Freq_2 = val;});
-    pMapPar.emplace("MOD_freq_2", [&](const int val){ MOD_freq_2 = val;});
-    pMapCv.emplace("MOD_freq_2", [&](const int val){ cv_MOD_freq_2 = val;});
-    pMapPar.emplace("Freqmod_amount_1", [&](const int val){ Freqmod_amount_1 = val;});
-    pMapCv.emplace("Freqmod_amount_1", [&](const int val){ cv_Freqmod_amount_1 = val;});
-    pMapPar.emplace("Freqmod_freq_1", [&](const int val){ Freqmod_freq_1 = val;});
-    pMapCv.emplace("Freqmod_freq_1", [&](const int val){ cv_Freqmod_freq_1 = val;});
-    pMapPar.emplace("FreqmodSquare_active_1", [&](const int val){ FreqmodSquare_active_1 = val;});
-    pMapTrig.emplace("FreqmodSquare_active_1", [&](const int val){ trig_FreqmodSquare_active_1 = val;});
-    pMapPar.emplace("FreqmodSquare_active_2", [&](const int val){ FreqmodSquare_active_2 = val;});
-    pMapTrig.emplace("FreqmodSquare_active_2", [&](const int val){ trig_FreqmodSquare_active_2 = val;});
-    pMapPar.emplace("Freqmod_freq_2", [&](const int val){ Freqmod_freq_2 = val;});
-    pMapCv.emplace("Freqmod_freq_2", [&](const int val){ cv_Freqmod_freq_2 = val;});
-    pMapPar.emplace("Freqmod_amount_2", [&](const int val){ Freqmod_amount_2 = val;});
-    pMapCv.emplace("Freqmod_amount_2", [&](const int val){ cv_Freqmod_amount_2 = val;});
-    pMapPar.emplace("Vol_amount", [&](const int val){ Vol_amount = val;});
-    pMapCv.emplace("Vol_amount", [&](const int val){ cv_Vol_amount = val;});
-    pMapPar.emplace("Env_active", [&](const int val){ Env_active = val;});
-    pMapTrig.emplace("Env_active", [&](const int val){ trig_Env_active = val;});
-    pMapPar.emplace("Trigger_env", [&](const int val){ Trigger_env = val;});
-    pMapTrig.emplace("Trigger_env", [&](const int val){ trig_Trigger_env = val;});
-    pMapPar.emplace("Env_Attack", [&](const int val){ Env_Attack = val;});
-    pMapCv.emplace("Env_Attack", [&](const int val){ cv_Env_Attack = val;});
-    pMapPar.emplace("Env_Decay", [&](const int val){ Env_Decay = val;});
-    pMapCv.emplace("Env_Decay", [&](const int val){ cv_Env_Decay = val;});
-    pMapPar.emplace("Env_loop_active", [&](const int val){ Env_loop_active = val;});
-    pMapTrig.emplace("Env_loop_active", [&](const int val){ trig_Env_loop_active = val;});
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, MOD_freq_1),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freq_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, MOD_active_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, MOD_is_PWM_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, SmoothOSC_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, SmoothOSC_2),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, MOD_is_PWM_2),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, MOD_active_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freq_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, MOD_freq_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freqmod_amount_1),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freqmod_freq_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, FreqmodSquare_active_1),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, FreqmodSquare_active_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freqmod_freq_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Freqmod_amount_2),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Vol_amount),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, Env_active),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, Trigger_env),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Env_Attack),
+        MK_PARAM_INT(ctagSoundProcessorAPCpp, Env_Decay),
+        MK_PARAM_BOOL(ctagSoundProcessorAPCpp, Env_loop_active),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "APCpp";
     // sectionCpp0
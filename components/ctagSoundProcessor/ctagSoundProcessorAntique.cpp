@@ -30,7 +30,7 @@ using namespace CTAG::SP;
 
 void ctagSoundProcessorAntique::Process(const ProcessData &data) {
     // dry buffer
-    float dry[32];
+    float dry[bufSz];
     // input shaping
     MK_FLT_PAR_ABS(fInputLevel, inplevel, 4095.f, 1.f)
     fInputLevel *= fInputLevel;
@@ -48,13 +48,13 @@ void ctagSoundProcessorAntique::Process(const ProcessData &data) {
     MK_INT_PAR_ABS(iHumShape, humshape, 32767.f)
     MK_INT_PAR_ABS(iHumAgression, humagr, 30)
     iHumAgression++;
-    int16_t ibuf[32];
-    const uint8_t sync[32] {0};
+    int16_t ibuf[bufSz];
+    const uint8_t sync[bufSz] {0};
     humm.set_shape(braids::AnalogOscillatorShape::OSC_SHAPE_TRIANGLE_FOLD);
     humm.set_parameter(iHumShape);
     humm.set_aux_parameter(0);
     humm.set_pitch(1000 + iHumFreq);
-    humm.Render(sync, ibuf, nullptr, 32);
+    humm.Render(sync, ibuf, nullptr, bufSz);
 
     // hiss
     MK_FLT_PAR_ABS_MIN_MAX(fHissFreq, hissf, 4095.f, 20.f, 20000.f)
@@ -230,17 +230,17 @@ void ctagSoundProcessorAntique::Init(std::size_t blockSize, void *blockPtr) {
     humm.Init();
 
     // flutter, wow
-    assert(blockSize >= 4096 * sizeof(float));
+    assert(blockSize >= blockMemSize);
     fx_buffer = (float *) blockPtr;
     fx.Init(fx_buffer);
-    lfoWow.SetSampleRate(44100.f / 32.f);
+    lfoWow.SetSampleRate(44100.f / bufSz);
     lfoWow.SetFrequency(.55f);
-    lfoFlutter.SetSampleRate(44100.f / 32.f);
+    lfoFlutter.SetSampleRate(44100.f / bufSz);
     lfoFlutter.SetFrequency(10.f);
 
     // pop
     loopCntr = 0;
-    lfoPopBlend.SetSampleRate(44100.f/32.f);
+    lfoPopBlend.SetSampleRate(44100.f / bufSz);
     lfoPopBlend.SetFrequency(0.01f);
     seed1 = rand();
     seed2 = rand();
@@ -270,84 +270,48 @@ ctagSoundProcessorAntique::~ctagSoundProcessorAntique() {
 void ctagSoundProcessorAntique::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("inplevel", [&](const int val){ inplevel = val;});
-	pMapCv.emplace("inplevel", [&](const int val){ cv_inplevel = val;});
-	pMapPar.emplace("inpdist", [&](const int val){ inpdist = val;});
-	pMapCv.emplace("inpdist", [&](const int val){ cv_inpdist = val;});
-	pMapPar.emplace("inprepitch", [&](const int val){ inprepitch = val;});
-	pMapCv.emplace("inprepitch", [&](const int val){ cv_inprepitch = val;});
-	pMapPar.emplace("hisslevel", [&](const int val){ hisslevel = val;});
-	pMapCv.emplace("hisslevel", [&](const int val){ cv_hisslevel = val;});
-	pMapPar.emplace("hissf", [&](const int val){ hissf = val;});
-	pMapCv.emplace("hissf", [&](const int val){ cv_hissf = val;});
-	pMapPar.emplace("hissbw", [&](const int val){ hissbw = val;});
-	pMapCv.emplace("hissbw", [&](const int val){ cv_hissbw = val;});
-	pMapPar.emplace("hissshp", [&](const int val){ hissshp = val;});
-	pMapCv.emplace("hissshp", [&](const int val){ cv_hissshp = val;});
-	pMapPar.emplace("scrublev", [&](const int val){ scrublev = val;});
-	pMapCv.emplace("scrublev", [&](const int val){ cv_scrublev = val;});
-	pMapPar.emplace("scrubcen", [&](const int val){ scrubcen = val;});
-	pMapCv.emplace("scrubcen", [&](const int val){ cv_scrubcen = val;});
-	pMapPar.emplace("scrubq", [&](const int val){ scrubq = val;});
-	pMapCv.emplace("scrubq", [&](const int val){ cv_scrubq = val;});
-	pMapPar.emplace("scrubmodlev", [&](const int val){ scrubmodlev = val;});
-	pMapCv.emplace("scrubmodlev", [&](const int val){ cv_scrubmodlev = val;});
-	pMapPar.emplace("humlev", [&](const int val){ humlev = val;});
-	pMapCv.emplace("humlev", [&](const int val){ cv_humlev = val;});
-	pMapPar.emplace("humf", [&](const int val){ humf = val;});
-	pMapCv.emplace("humf", [&](const int val){ cv_humf = val;});
-	pMapPar.emplace("humshape", [&](const int val){ humshape = val;});
-	pMapCv.emplace("humshape", [&](const int val){ cv_humshape = val;});
-	pMapPar.emplace("humagr", [&](const int val){ humagr = val;});
-	pMapCv.emplace("humagr", [&](const int val){ cv_humagr = val;});
-	pMapPar.emplace("wowl", [&](const int val){ wowl = val;});
-	pMapCv.emplace("wowl", [&](const int val){ cv_wowl = val;});
-	pMapPar.emplace("wowf", [&](const int val){ wowf = val;});
-	pMapCv.emplace("wowf", [&](const int val){ cv_wowf = val;});
-	pMapPar.emplace("flutl", [&](const int val){ flutl = val;});
-	pMapCv.emplace("flutl", [&](const int val){ cv_flutl = val;});
-	pMapPar.emplace("flutf", [&](const int val){ flutf = val;});
-	pMapCv.emplace("flutf", [&](const int val){ cv_flutf = val;});
-	pMapPar.emplace("clickl", [&](const int val){ clickl = val;});
-	pMapCv.emplace("clickl", [&](const int val){ cv_clickl = val;});
-	pMapPar.emplace("clickd", [&](const int val){ clickd = val;});
-	pMapCv.emplace("clickd", [&](const int val){ cv_clickd = val;});
-	pMapPar.emplace("clickf", [&](const int val){ clickf = val;});
-	pMapCv.emplace("clickf", [&](const int val){ cv_clickf = val;});
-	pMapPar.emplace("clickfmod", [&](const int val){ clickfmod = val;});
-	pMapCv.emplace("clickfmod", [&](const int val){ cv_clickfmod = val;});
-	pMapPar.emplace("clickq", [&](const int val){ clickq = val;});
-	pMapCv.emplace("clickq", [&](const int val){ cv_clickq = val;});
-	pMapPar.emplace("clickqm", [&](const int val){ clickqm = val;});
-	pMapCv.emplace("clickqm", [&](const int val){ cv_clickqm = val;});
-	pMapPar.emplace("popl", [&](const int val){ popl = val;});
-	pMapCv.emplace("popl", [&](const int val){ cv_popl = val;});
-	pMapPar.emplace("popd1", [&](const int val){ popd1 = val;});
-	pMapCv.emplace("popd1", [&](const int val){ cv_popd1 = val;});
-	pMapPar.emplace("popd2", [&](const int val){ popd2 = val;});
-	pMapCv.emplace("popd2", [&](const int val){ cv_popd2 = val;});
-	pMapPar.emplace("poplen", [&](const int val){ poplen = val;});
-	pMapCv.emplace("poplen", [&](const int val){ cv_poplen = val;});
-	pMapPar.emplace("poplensy", [&](const int val){ poplensy = val;});
-	pMapTrig.emplace("poplensy", [&](const int val){ trig_poplensy = val;});
-	pMapPar.emplace("popblen", [&](const int val){ popblen = val;});
-	pMapCv.emplace("popblen", [&](const int val){ cv_popblen = val;});
-	pMapPar.emplace("popf", [&](const int val){ popf = val;});
-	pMapCv.emplace("popf", [&](const int val){ cv_popf = val;});
-	pMapPar.emplace("popdcy", [&](const int val){ popdcy = val;});
-	pMapCv.emplace("popdcy", [&](const int val){ cv_popdcy = val;});
-	pMapPar.emplace("outlevel", [&](const int val){ outlevel = val;});
-	pMapCv.emplace("outlevel", [&](const int val){ cv_outlevel = val;});
-    pMapPar.emplace("outdw", [&](const int val){ outdw = val;});
-    pMapCv.emplace("outdw", [&](const int val){ cv_outdw = val;});
-	pMapPar.emplace("outfltctr", [&](const int val){ outfltctr = val;});
-	pMapCv.emplace("outfltctr", [&](const int val){ cv_outfltctr = val;});
-	pMapPar.emplace("outfltbw", [&](const int val){ outfltbw = val;});
-	pMapCv.emplace("outfltbw", [&](const int val){ cv_outfltbw = val;});
-	pMapPar.emplace("outfltq", [&](const int val){ outfltq = val;});
-	pMapCv.emplace("outfltq", [&](const int val){ cv_outfltq = val;});
-	pMapPar.emplace("hishumpre", [&](const int val){ hishumpre = val;});
-	pMapTrig.emplace("hishumpre", [&](const int val){ trig_hishumpre = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorAntique, inplevel),
+		MK_PARAM_INT(ctagSoundProcessorAntique, inpdist),
+		MK_PARAM_INT(ctagSoundProcessorAntique, inprepitch),
+		MK_PARAM_INT(ctagSoundProcessorAntique, hisslevel),
+		MK_PARAM_INT(ctagSoundProcessorAntique, hissf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, hissbw),
+		MK_PARAM_INT(ctagSoundProcessorAntique, hissshp),
+		MK_PARAM_INT(ctagSoundProcessorAntique, scrublev),
+		MK_PARAM_INT(ctagSoundProcessorAntique, scrubcen),
+		MK_PARAM_INT(ctagSoundProcessorAntique, scrubq),
+		MK_PARAM_INT(ctagSoundProcessorAntique, scrubmodlev),
+		MK_PARAM_INT(ctagSoundProcessorAntique, humlev),
+		MK_PARAM_INT(ctagSoundProcessorAntique, humf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, humshape),
+		MK_PARAM_INT(ctagSoundProcessorAntique, humagr),
+		MK_PARAM_INT(ctagSoundProcessorAntique, wowl),
+		MK_PARAM_INT(ctagSoundProcessorAntique, wowf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, flutl),
+		MK_PARAM_INT(ctagSoundProcessorAntique, flutf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickl),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickd),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickfmod),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickq),
+		MK_PARAM_INT(ctagSoundProcessorAntique, clickqm),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popl),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popd1),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popd2),
+		MK_PARAM_INT(ctagSoundProcessorAntique, poplen),
+		MK_PARAM_BOOL(ctagSoundProcessorAntique, poplensy),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popblen),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popf),
+		MK_PARAM_INT(ctagSoundProcessorAntique, popdcy),
+		MK_PARAM_INT(ctagSoundProcessorAntique, outlevel),
+		MK_PARAM_INT(ctagSoundProcessorAntique, outdw),
+		MK_PARAM_INT(ctagSoundProcessorAntique, outfltctr),
+		MK_PARAM_INT(ctagSoundProcessorAntique, outfltbw),
+		MK_PARAM_INT(ctagSoundProcessorAntique, outfltq),
+		MK_PARAM_BOOL(ctagSoundProcessorAntique, hishumpre),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "Antique";
 	// sectionCpp0
@@ -43,6 +43,7 @@ namespace CTAG {
         public:
             virtual void Process(const ProcessData &) override;
            virtual void Init(std::size_t blockSize, void *blockPtr) override;
+           static constexpr std::size_t blockMemSize = 4096 * sizeof(float);
             virtual ~ctagSoundProcessorAntique();
 
         private:
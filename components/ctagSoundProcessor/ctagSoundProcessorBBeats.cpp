@@ -481,76 +481,44 @@ void ctagSoundProcessorBBeats::knowYourself()
 {
   // autogenerated code here
   // sectionCpp0
-  pMapPar.emplace("beatA_stop", [&](const int val){ beatA_stop = val;});
-  pMapTrig.emplace("beatA_stop", [&](const int val){ trig_beatA_stop = val;});
-  pMapPar.emplace("beatA_backwards", [&](const int val){ beatA_backwards = val;});
-  pMapTrig.emplace("beatA_backwards", [&](const int val){ trig_beatA_backwards = val;});
-  pMapPar.emplace("beatA_select", [&](const int val){ beatA_select = val;});
-  pMapCv.emplace("beatA_select", [&](const int val){ cv_beatA_select = val;});
-  pMapPar.emplace("beatA_pitch", [&](const int val){ beatA_pitch = val;});
-  pMapCv.emplace("beatA_pitch", [&](const int val){ cv_beatA_pitch = val;});
-  pMapPar.emplace("beatB_stop", [&](const int val){ beatB_stop = val;});
-  pMapTrig.emplace("beatB_stop", [&](const int val){ trig_beatB_stop = val;});
-  pMapPar.emplace("beatB_backwards", [&](const int val){ beatB_backwards = val;});
-  pMapTrig.emplace("beatB_backwards", [&](const int val){ trig_beatB_backwards = val;});
-  pMapPar.emplace("beatB_select", [&](const int val){ beatB_select = val;});
-  pMapCv.emplace("beatB_select", [&](const int val){ cv_beatB_select = val;});
-  pMapPar.emplace("beatB_pitch", [&](const int val){ beatB_pitch = val;});
-  pMapCv.emplace("beatB_pitch", [&](const int val){ cv_beatB_pitch = val;});
-  pMapPar.emplace("reset_bbeats_on_stop", [&](const int val){ reset_bbeats_on_stop = val;});
-  pMapTrig.emplace("reset_bbeats_on_stop", [&](const int val){ trig_reset_bbeats_on_stop = val;});
-  pMapPar.emplace("volume", [&](const int val){ volume = val;});
-  pMapCv.emplace("volume", [&](const int val){ cv_volume = val;});
-  pMapPar.emplace("xFadeA_B", [&](const int val){ xFadeA_B = val;});
-  pMapCv.emplace("xFadeA_B", [&](const int val){ cv_xFadeA_B = val;});
-  pMapPar.emplace("destinationEG_1", [&](const int val){ destinationEG_1 = val;});
-  pMapCv.emplace("destinationEG_1", [&](const int val){ cv_destinationEG_1 = val;});
-  pMapPar.emplace("activateEG_1", [&](const int val){ activateEG_1 = val;});
-  pMapTrig.emplace("activateEG_1", [&](const int val){ trig_activateEG_1 = val;});
-  pMapPar.emplace("loopEG_1", [&](const int val){ loopEG_1 = val;});
-  pMapTrig.emplace("loopEG_1", [&](const int val){ trig_loopEG_1 = val;});
-  pMapPar.emplace("amountEG_1", [&](const int val){ amountEG_1 = val;});
-  pMapCv.emplace("amountEG_1", [&](const int val){ cv_amountEG_1 = val;});
-  pMapPar.emplace("attackEG_1", [&](const int val){ attackEG_1 = val;});
-  pMapCv.emplace("attackEG_1", [&](const int val){ cv_attackEG_1 = val;});
-  pMapPar.emplace("decayEG_1", [&](const int val){ decayEG_1 = val;});
-  pMapCv.emplace("decayEG_1", [&](const int val){ cv_decayEG_1 = val;});
-  pMapPar.emplace("destinationEG_2", [&](const int val){ destinationEG_2 = val;});
-  pMapCv.emplace("destinationEG_2", [&](const int val){ cv_destinationEG_2 = val;});
-  pMapPar.emplace("activateEG_2", [&](const int val){ activateEG_2 = val;});
-  pMapTrig.emplace("activateEG_2", [&](const int val){ trig_activateEG_2 = val;});
-  pMapPar.emplace("loopEG_2", [&](const int val){ loopEG_2 = val;});
-  pMapTrig.emplace("loopEG_2", [&](const int val){ trig_loopEG_2 = val;});
-  pMapPar.emplace("amountEG_2", [&](const int val){ amountEG_2 = val;});
-  pMapCv.emplace("amountEG_2", [&](const int val){ cv_amountEG_2 = val;});
-  pMapPar.emplace("attackEG_2", [&](const int val){ attackEG_2 = val;});
-  pMapCv.emplace("attackEG_2", [&](const int val){ cv_attackEG_2 = val;});
-  pMapPar.emplace("decayEG_2", [&](const int val){ decayEG_2 = val;});
-  pMapCv.emplace("decayEG_2", [&](const int val){ cv_decayEG_2 = val;});
-  pMapPar.emplace("destinationEG_3", [&](const int val){ destinationEG_3 = val;});
-  pMapCv.emplace("destinationEG_3", [&](const int val){ cv_destinationEG_3 = val;});
-  pMapPar.emplace("activateEG_3", [&](const int val){ activateEG_3 = val;});
-  pMapTrig.emplace("activateEG_3", [&](const int val){ trig_activateEG_3 = val;});
-  pMapPar.emplace("loopEG_3", [&](const int val){ loopEG_3 = val;});
-  pMapTrig.emplace("loopEG_3", [&](const int val){ trig_loopEG_3 = val;});
-  pMapPar.emplace("amountEG_3", [&](const int val){ amountEG_3 = val;});
-  pMapCv.emplace("amountEG_3", [&](const int val){ cv_amountEG_3 = val;});
-  pMapPar.emplace("attackEG_3", [&](const int val){ attackEG_3 = val;});
-  pMapCv.emplace("attackEG_3", [&](const int val){ cv_attackEG_3 = val;});
-  pMapPar.emplace("decayEG_3", [&](const int val){ decayEG_3 = val;});
-  pMapCv.emplace("decayEG_3", [&](const int val){ cv_decayEG_3 = val;});
-  pMapPar.emplace("destinationEG_4", [&](const int val){ destinationEG_4 = val;});
-  pMapCv.emplace("destinationEG_4", [&](const int val){ cv_destinationEG_4 = val;});
-  pMapPar.emplace("activateEG_4", [&](const int val){ activateEG_4 = val;});
-  pMapTrig.emplace("activateEG_4", [&](const int val){ trig_activateEG_4 = val;});
-  pMapPar.emplace("loopEG_4", [&](const int val){ loopEG_4 = val;});
-  pMapTrig.emplace("loopEG_4", [&](const int val){ trig_loopEG_4 = val;});
-  pMapPar.emplace("amountEG_4", [&](const int val){ amountEG_4 = val;});
-  pMapCv.emplace("amountEG_4", [&](const int val){ cv_amountEG_4 = val;});
-  pMapPar.emplace("attackEG_4", [&](const int val){ attackEG_4 = val;});
-  pMapCv.emplace("attackEG_4", [&](const int val){ cv_attackEG_4 = val;});
-  pMapPar.emplace("decayEG_4", [&](const int val){ decayEG_4 = val;});
-  pMapCv.emplace("decayEG_4", [&](const int val){ cv_decayEG_4 = val;});
+  static constexpr ctagParamDesc params[] {
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, beatA_stop),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, beatA_backwards),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, beatA_select),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, beatA_pitch),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, beatB_stop),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, beatB_backwards),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, beatB_select),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, beatB_pitch),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, reset_bbeats_on_stop),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, volume),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, xFadeA_B),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, destinationEG_1),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, activateEG_1),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, loopEG_1),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, amountEG_1),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, attackEG_1),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, decayEG_1),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, destinationEG_2),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, activateEG_2),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, loopEG_2),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, amountEG_2),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, attackEG_2),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, decayEG_2),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, destinationEG_3),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, activateEG_3),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, loopEG_3),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, amountEG_3),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, attackEG_3),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, decayEG_3),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, destinationEG_4),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, activateEG_4),
+      MK_PARAM_BOOL(ctagSoundProcessorBBeats, loopEG_4),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, amountEG_4),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, attackEG_4),
+      MK_PARAM_INT(ctagSoundProcessorBBeats, decayEG_4),
+  };
+  setParamTable(params);
   isStereo = false;
   id = "BBeats";
   // sectionCpp0
@@ -203,44 +203,28 @@ void ctagSoundProcessorBCSR::updateParams(const ProcessData &data) {
 
 void ctagSoundProcessorBCSR::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("level", [&](const int val) { level = val; });
-    pMapCv.emplace("level", [&](const int val) { cv_level = val; });
-    pMapPar.emplace("invert", [&](const int val) { invert = val; });
-    pMapTrig.emplace("invert", [&](const int val) { trig_invert = val; });
-    pMapPar.emplace("dry", [&](const int val) { dry = val; });
-    pMapCv.emplace("dry", [&](const int val) { cv_dry = val; });
-    pMapPar.emplace("bc_ena", [&](const int val) { bc_ena = val; });
-    pMapTrig.emplace("bc_ena", [&](const int val) { trig_bc_ena = val; });
-    pMapPar.emplace("bc_amount", [&](const int val) { bc_amount = val; });
-    pMapCv.emplace("bc_amount", [&](const int val) { cv_bc_amount = val; });
-    pMapPar.emplace("eg_bc_ena", [&](const int val) { eg_bc_ena = val; });
-    pMapTrig.emplace("eg_bc_ena", [&](const int val) { trig_eg_bc_ena = val; });
-    pMapPar.emplace("eg_bc_loop", [&](const int val) { eg_bc_loop = val; });
-    pMapTrig.emplace("eg_bc_loop", [&](const int val) { trig_eg_bc_loop = val; });
-    pMapPar.emplace("eg_bc_le", [&](const int val) { eg_bc_le = val; });
-    pMapTrig.emplace("eg_bc_le", [&](const int val) { trig_eg_bc_le = val; });
-    pMapPar.emplace("eg_bc_amount", [&](const int val) { eg_bc_amount = val; });
-    pMapCv.emplace("eg_bc_amount", [&](const int val) { cv_eg_bc_amount = val; });
-    pMapPar.emplace("eg_bc_att", [&](const int val) { eg_bc_att = val; });
-    pMapCv.emplace("eg_bc_att", [&](const int val) { cv_eg_bc_att = val; });
-    pMapPar.emplace("eg_bc_dec", [&](const int val) { eg_bc_dec = val; });
-    pMapCv.emplace("eg_bc_dec", [&](const int val) { cv_eg_bc_dec = val; });
-    pMapPar.emplace("sr_ena", [&](const int val) { sr_ena = val; });
-    pMapTrig.emplace("sr_ena", [&](const int val) { trig_sr_ena = val; });
-    pMapPar.emplace("sr_amount", [&](const int val) { sr_amount = val; });
-    pMapCv.emplace("sr_amount", [&](const int val) { cv_sr_amount = val; });
-    pMapPar.emplace("eg_sr_ena", [&](const int val) { eg_sr_ena = val; });
-    pMapTrig.emplace("eg_sr_ena", [&](const int val) { trig_eg_sr_ena = val; });
-    pMapPar.emplace("eg_sr_loop", [&](const int val) { eg_sr_loop = val; });
-    pMapTrig.emplace("eg_sr_loop", [&](const int val) { trig_eg_sr_loop = val; });
-    pMapPar.emplace("eg_sr_le", [&](const int val) { eg_sr_le = val; });
-    pMapTrig.emplace("eg_sr_le", [&](const int val) { trig_eg_sr_le = val; });
-    pMapPar.emplace("eg_sr_amount", [&](const int val) { eg_sr_amount = val; });
-    pMapCv.emplace("eg_sr_amount", [&](const int val) { cv_eg_sr_amount = val; });
-    pMapPar.emplace("eg_sr_att", [&](const int val) { eg_sr_att = val; });
-    pMapCv.emplace("eg_sr_att", [&](const int val) { cv_eg_sr_att = val; });
-    pMapPar.emplace("eg_sr_dec", [&](const int val) { eg_sr_dec = val; });
-    pMapCv.emplace("eg_sr_dec", [&](const int val) { cv_eg_sr_dec = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorBCSR, level),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, invert),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, dry),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, bc_ena),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, bc_amount),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_bc_ena),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_bc_loop),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_bc_le),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_bc_amount),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_bc_att),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_bc_dec),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, sr_ena),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, sr_amount),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_sr_ena),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_sr_loop),
+        MK_PARAM_BOOL(ctagSoundProcessorBCSR, eg_sr_le),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_sr_amount),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_sr_att),
+        MK_PARAM_INT(ctagSoundProcessorBCSR, eg_sr_dec),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "BCSR";
     // sectionCpp0
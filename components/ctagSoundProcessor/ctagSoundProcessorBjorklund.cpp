@@ -619,186 +619,99 @@ ctagSoundProcessorBjorklund::~ctagSoundProcessorBjorklund() {
 void ctagSoundProcessorBjorklund::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("Trigger", [&](const int val) { Trigger = val; });
-    pMapTrig.emplace("Trigger", [&](const int val) { trig_Trigger = val; });
-    pMapPar.emplace("BeatDivider", [&](const int val) { BeatDivider = val; });
-    pMapCv.emplace("BeatDivider", [&](const int val) { cv_BeatDivider = val; });
-    pMapPar.emplace("InternalClock", [&](const int val) { InternalClock = val; });
-    pMapTrig.emplace("InternalClock", [&](const int val) { trig_InternalClock = val; });
-    pMapPar.emplace("ClockSpeed", [&](const int val) { ClockSpeed = val; });
-    pMapCv.emplace("ClockSpeed", [&](const int val) { cv_ClockSpeed = val; });
-    pMapPar.emplace("MasterPitch", [&](const int val) { MasterPitch = val; });
-    pMapCv.emplace("MasterPitch", [&](const int val) { cv_MasterPitch = val; });
-    pMapPar.emplace("MasterTune", [&](const int val) { MasterTune = val; });
-    pMapCv.emplace("MasterTune", [&](const int val) { cv_MasterTune = val; });
-    pMapPar.emplace("QuantizePitch", [&](const int val) { QuantizePitch = val; });
-    pMapTrig.emplace("QuantizePitch", [&](const int val) { trig_QuantizePitch = val; });
-    pMapPar.emplace("ScaleCorrect", [&](const int val) { ScaleCorrect = val; });
-    pMapCv.emplace("ScaleCorrect", [&](const int val) { cv_ScaleCorrect = val; });
-    pMapPar.emplace("Volume", [&](const int val) { Volume = val; });
-    pMapCv.emplace("Volume", [&](const int val) { cv_Volume = val; });
-    pMapPar.emplace("SawPitch", [&](const int val) { SawPitch = val; });
-    pMapCv.emplace("SawPitch", [&](const int val) { cv_SawPitch = val; });
-    pMapPar.emplace("SawTune", [&](const int val) { SawTune = val; });
-    pMapCv.emplace("SawTune", [&](const int val) { cv_SawTune = val; });
-    pMapPar.emplace("PulsePitch", [&](const int val) { PulsePitch = val; });
-    pMapCv.emplace("PulsePitch", [&](const int val) { cv_PulsePitch = val; });
-    pMapPar.emplace("PulseTune", [&](const int val) { PulseTune = val; });
-    pMapCv.emplace("PulseTune", [&](const int val) { cv_PulseTune = val; });
-    pMapPar.emplace("PulseWidth", [&](const int val) { PulseWidth = val; });
-    pMapCv.emplace("PulseWidth", [&](const int val) { cv_PulseWidth = val; });
-    pMapPar.emplace("PWMon", [&](const int val) { PWMon = val; });
-    pMapTrig.emplace("PWMon", [&](const int val) { trig_PWMon = val; });
-    pMapPar.emplace("PWMspeed", [&](const int val) { PWMspeed = val; });
-    pMapCv.emplace("PWMspeed", [&](const int val) { cv_PWMspeed = val; });
-    pMapPar.emplace("PWMamount", [&](const int val) { PWMamount = val; });
-    pMapCv.emplace("PWMamount", [&](const int val) { cv_PWMamount = val; });
-    pMapPar.emplace("NoiseVol", [&](const int val) { NoiseVol = val; });
-    pMapCv.emplace("NoiseVol", [&](const int val) { cv_NoiseVol = val; });
-    pMapPar.emplace("SawVol", [&](const int val) { SawVol = val; });
-    pMapCv.emplace("SawVol", [&](const int val) { cv_SawVol = val; });
-    pMapPar.emplace("PulseVol", [&](const int val) { PulseVol = val; });
-    pMapCv.emplace("PulseVol", [&](const int val) { cv_PulseVol = val; });
-    pMapPar.emplace("OSCmix", [&](const int val) { OSCmix = val; });
-    pMapCv.emplace("OSCmix", [&](const int val) { cv_OSCmix = val; });
-    pMapPar.emplace("RingOnSaw", [&](const int val) { RingOnSaw = val; });
-    pMapTrig.emplace("RingOnSaw", [&](const int val) { trig_RingOnSaw = val; });
-    pMapPar.emplace("RingOnPulse", [&](const int val) { RingOnPulse = val; });
-    pMapTrig.emplace("RingOnPulse", [&](const int val) { trig_RingOnPulse = val; });
-    pMapPar.emplace("AMisSquare", [&](const int val) { AMisSquare = val; });
-    pMapTrig.emplace("AMisSquare", [&](const int val) { trig_AMisSquare = val; });
-    pMapPar.emplace("RingModFreq", [&](const int val) { RingModFreq = val; });
-    pMapCv.emplace("RingModFreq", [&](const int val) { cv_RingModFreq = val; });
-    pMapPar.emplace("RingModAmnt", [&](const int val) { RingModAmnt = val; });
-    pMapCv.emplace("RingModAmnt", [&](const int val) { cv_RingModAmnt = val; });
-    pMapPar.emplace("WaveFolder", [&](const int val) { WaveFolder = val; });
-    pMapCv.emplace("WaveFolder", [&](const int val) { cv_WaveFolder = val; });
-    pMapPar.emplace("Cutoff", [&](const int val) { Cutoff = val; });
-    pMapCv.emplace("Cutoff", [&](const int val) { cv_Cutoff = val; });
-    pMapPar.emplace("Resonance", [&](const int val) { Resonance = val; });
-    pMapCv.emplace("Resonance", [&](const int val) { cv_Resonance = val; });
-    pMapPar.emplace("FilterTracking", [&](const int val) { FilterTracking = val; });
-    pMapCv.emplace("FilterTracking", [&](const int val) { cv_FilterTracking = val; });
-    pMapPar.emplace("FilterLeakage", [&](const int val) { FilterLeakage = val; });
-    pMapCv.emplace("FilterLeakage", [&](const int val) { cv_FilterLeakage = val; });
-    pMapPar.emplace("PatternSequencer", [&](const int val) { PatternSequencer = val; });
-    pMapTrig.emplace("PatternSequencer", [&](const int val) { trig_PatternSequencer = val; });
-    pMapPar.emplace("ResetSequencer", [&](const int val) { ResetSequencer = val; });
-    pMapTrig.emplace("ResetSequencer", [&](const int val) { trig_ResetSequencer = val; });
-    pMapPar.emplace("BjorklundOff", [&](const int val) { BjorklundOff = val; });
-    pMapTrig.emplace("BjorklundOff", [&](const int val) { trig_BjorklundOff = val; });
-    pMapPar.emplace("BjorklundPattern", [&](const int val) { BjorklundPattern = val; });
-    pMapCv.emplace("BjorklundPattern", [&](const int val) { cv_BjorklundPattern = val; });
-    pMapPar.emplace("BjorklundShift", [&](const int val) { BjorklundShift = val; });
-    pMapCv.emplace("BjorklundShift", [&](const int val) { cv_BjorklundShift = val; });
-    pMapPar.emplace("PalindromeOff", [&](const int val) { PalindromeOff = val; });
-    pMapTrig.emplace("PalindromeOff", [&](const int val) { trig_PalindromeOff = val; });
-    pMapPar.emplace("PalindromeSelect", [&](const int val) { PalindromeSelect = val; });
-    pMapCv.emplace("PalindromeSelect", [&](const int val) { cv_PalindromeSelect = val; });
-    pMapPar.emplace("PalindromeRootkey", [&](const int val) { PalindromeRootkey = val; });
-    pMapCv.emplace("PalindromeRootkey", [&](const int val) { cv_PalindromeRootkey = val; });
-    pMapPar.emplace("AccentOff", [&](const int val) { AccentOff = val; });
-    pMapTrig.emplace("AccentOff", [&](const int val) { trig_AccentOff = val; });
-    pMapPar.emplace("AccentSync", [&](const int val) { AccentSync = val; });
-    pMapTrig.emplace("AccentSync", [&](const int val) { trig_AccentSync = val; });
-    pMapPar.emplace("AccentDestination", [&](const int val) { AccentDestination = val; });
-    pMapCv.emplace("AccentDestination", [&](const int val) { cv_AccentDestination = val; });
-    pMapPar.emplace("AccentBeatDivider", [&](const int val) { AccentBeatDivider = val; });
-    pMapCv.emplace("AccentBeatDivider", [&](const int val) { cv_AccentBeatDivider = val; });
-    pMapPar.emplace("AccentIsBjorklund", [&](const int val) { AccentIsBjorklund = val; });
-    pMapTrig.emplace("AccentIsBjorklund", [&](const int val) { trig_AccentIsBjorklund = val; });
-    pMapPar.emplace("AccentSelect", [&](const int val) { AccentSelect = val; });
-    pMapCv.emplace("AccentSelect", [&](const int val) { cv_AccentSelect = val; });
-    pMapPar.emplace("AccentShift", [&](const int val) { AccentShift = val; });
-    pMapCv.emplace("AccentShift", [&](const int val) { cv_AccentShift = val; });
-    pMapPar.emplace("AccentAmount", [&](const int val) { AccentAmount = val; });
-    pMapCv.emplace("AccentAmount", [&](const int val) { cv_AccentAmount = val; });
-    pMapPar.emplace("EGvolActive", [&](const int val) { EGvolActive = val; });
-    pMapTrig.emplace("EGvolActive", [&](const int val) { trig_EGvolActive = val; });
-    pMapPar.emplace("EGvolNegative", [&](const int val) { EGvolNegative = val; });
-    pMapTrig.emplace("EGvolNegative", [&](const int val) { trig_EGvolNegative = val; });
-    pMapPar.emplace("VolAttack", [&](const int val) { VolAttack = val; });
-    pMapCv.emplace("VolAttack", [&](const int val) { cv_VolAttack = val; });
-    pMapPar.emplace("VolDecay", [&](const int val) { VolDecay = val; });
-    pMapCv.emplace("VolDecay", [&](const int val) { cv_VolDecay = val; });
-    pMapPar.emplace("VolEnvAmount", [&](const int val) { VolEnvAmount = val; });
-    pMapCv.emplace("VolEnvAmount", [&](const int val) { cv_VolEnvAmount = val; });
-    pMapPar.emplace("EGvolLoop", [&](const int val) { EGvolLoop = val; });
-    pMapTrig.emplace("EGvolLoop", [&](const int val) { trig_EGvolLoop = val; });
-    pMapPar.emplace("EasyEditOn", [&](const int val) { EasyEditOn = val; });
-    pMapTrig.emplace("EasyEditOn", [&](const int val) { trig_EasyEditOn = val; });
-    pMapPar.emplace("EGnoiseActive", [&](const int val) { EGnoiseActive = val; });
-    pMapTrig.emplace("EGnoiseActive", [&](const int val) { trig_EGnoiseActive = val; });
-    pMapPar.emplace("EGnoiseNegative", [&](const int val) { EGnoiseNegative = val; });
-    pMapTrig.emplace("EGnoiseNegative", [&](const int val) { trig_EGnoiseNegative = val; });
-    pMapPar.emplace("NoiseAttack", [&](const int val) { NoiseAttack = val; });
-    pMapCv.emplace("NoiseAttack", [&](const int val) { cv_NoiseAttack = val; });
-    pMapPar.emplace("NoiseDecay", [&](const int val) { NoiseDecay = val; });
-    pMapCv.emplace("NoiseDecay", [&](const int val) { cv_NoiseDecay = val; });
-    pMapPar.emplace("NoiseEnvAmount", [&](const int val) { NoiseEnvAmount = val; });
-    pMapCv.emplace("NoiseEnvAmount", [&](const int val) { cv_NoiseEnvAmount = val; });
-    pMapPar.emplace("EGnoiseLoop", [&](const int val) { EGnoiseLoop = val; });
-    pMapTrig.emplace("EGnoiseLoop", [&](const int val) { trig_EGnoiseLoop = val; });
-    pMapPar.emplace("EGoscMixActive", [&](const int val) { EGoscMixActive = val; });
-    pMapTrig.emplace("EGoscMixActive", [&](const int val) { trig_EGoscMixActive = val; });
-    pMapPar.emplace("EGoscMixNegative", [&](const int val) { EGoscMixNegative = val; });
-    pMapTrig.emplace("EGoscMixNegative", [&](const int val) { trig_EGoscMixNegative = val; });
-    pMapPar.emplace("OscMixAttack", [&](const int val) { OscMixAttack = val; });
-    pMapCv.emplace("OscMixAttack", [&](const int val) { cv_OscMixAttack = val; });
-    pMapPar.emplace("OscMixDecay", [&](const int val) { OscMixDecay = val; });
-    pMapCv.emplace("OscMixDecay", [&](const int val) { cv_OscMixDecay = val; });
-    pMapPar.emplace("OscMixEnvAmount", [&](const int val) { OscMixEnvAmount = val; });
-    pMapCv.emplace("OscMixEnvAmount", [&](const int val) { cv_OscMixEnvAmount = val; });
-    pMapPar.emplace("EGoscMixLoop", [&](const int val) { EGoscMixLoop = val; });
-    pMapTrig.emplace("EGoscMixLoop", [&](const int val) { trig_EGoscMixLoop = val; });
-    pMapPar.emplace("EGringActive", [&](const int val) { EGringActive = val; });
-    pMapTrig.emplace("EGringActive", [&](const int val) { trig_EGringActive = val; });
-    pMapPar.emplace("EGringNegative", [&](const int val) { EGringNegative = val; });
-    pMapTrig.emplace("EGringNegative", [&](const int val) { trig_EGringNegative = val; });
-    pMapPar.emplace("RingAttack", [&](const int val) { RingAttack = val; });
-    pMapCv.emplace("RingAttack", [&](const int val) { cv_RingAttack = val; });
-    pMapPar.emplace("RingDecay", [&](const int val) { RingDecay = val; });
-    pMapCv.emplace("RingDecay", [&](const int val) { cv_RingDecay = val; });
-    pMapPar.emplace("RingAmount", [&](const int val) { RingAmount = val; });
-    pMapCv.emplace("RingAmount", [&](const int val) { cv_RingAmount = val; });
-    pMapPar.emplace("EGringLoop", [&](const int val) { EGringLoop = val; });
-    pMapTrig.emplace("EGringLoop", [&](const int val) { trig_EGringLoop = val; });
-    pMapPar.emplace("EGwfActive", [&](const int val) { EGwfActive = val; });
-    pMapTrig.emplace("EGwfActive", [&](const int val) { trig_EGwfActive = val; });
-    pMapPar.emplace("EGwfNegative", [&](const int val) { EGwfNegative = val; });
-    pMapTrig.emplace("EGwfNegative", [&](const int val) { trig_EGwfNegative = val; });
-    pMapPar.emplace("WfAttack", [&](const int val) { WfAttack = val; });
-    pMapCv.emplace("WfAttack", [&](const int val) { cv_WfAttack = val; });
-    pMapPar.emplace("WfDecay", [&](const int val) { WfDecay = val; });
-    pMapCv.emplace("WfDecay", [&](const int val) { cv_WfDecay = val; });
-    pMapPar.emplace("WfEnvAmount", [&](const int val) { WfEnvAmount = val; });
-    pMapCv.emplace("WfEnvAmount", [&](const int val) { cv_WfEnvAmount = val; });
-    pMapPar.emplace("EGwfLoop", [&](const int val) { EGwfLoop = val; });
-    pMapTrig.emplace("EGwfLoop", [&](const int val) { trig_EGwfLoop = val; });
-    pMapPar.emplace("EGfiltActive", [&](const int val) { EGfiltActive = val; });
-    pMapTrig.emplace("EGfiltActive", [&](const int val) { trig_EGfiltActive = val; });
-    pMapPar.emplace("EGfiltNegative", [&](const int val) { EGfiltNegative = val; });
-    pMapTrig.emplace("EGfiltNegative", [&](const int val) { trig_EGfiltNegative = val; });
-    pMapPar.emplace("FiltAttack", [&](const int val) { FiltAttack = val; });
-    pMapCv.emplace("FiltAttack", [&](const int val) { cv_FiltAttack = val; });
-    pMapPar.emplace("FiltDecay", [&](const int val) { FiltDecay = val; });
-    pMapCv.emplace("FiltDecay", [&](const int val) { cv_FiltDecay = val; });
-    pMapPar.emplace("FiltAmount", [&](const int val) { FiltAmount = val; });
-    pMapCv.emplace("FiltAmount", [&](const int val) { cv_FiltAmount = val; });
-    pMapPar.emplace("EGfiltLoop", [&](const int val) { EGfiltLoop = val; });
-    pMapTrig.emplace("EGfiltLoop", [&](const int val) { trig_EGfiltLoop = val; });
-    pMapPar.emplace("EGfilterLeakActive", [&](const int val) { EGfilterLeakActive = val; });
-    pMapTrig.emplace("EGfilterLeakActive", [&](const int val) { trig_EGfilterLeakActive = val; });
-    pMapPar.emplace("EGfilterLeakNegative", [&](const int val) { EGfilterLeakNegative = val; });
-    pMapTrig.emplace("EGfilterLeakNegative", [&](const int val) { trig_EGfilterLeakNegative = val; });
-    pMapPar.emplace("FilterLeakAttack", [&](const int val) { FilterLeakAttack = val; });
-    pMapCv.emplace("FilterLeakAttack", [&](const int val) { cv_FilterLeakAttack = val; });
-    pMapPar.emplace("FilterLeakDecay", [&](const int val) { FilterLeakDecay = val; });
-    pMapCv.emplace("FilterLeakDecay", [&](const int val) { cv_FilterLeakDecay = val; });
-    pMapPar.emplace("FilterLeakEnvAmount", [&](const int val) { FilterLeakEnvAmount = val; });
-    pMapCv.emplace("FilterLeakEnvAmount", [&](const int val) { cv_FilterLeakEnvAmount = val; });
-    pMapPar.emplace("FilterLeakEnvLoop", [&](const int val) { FilterLeakEnvLoop = val; });
-    pMapTrig.emplace("FilterLeakEnvLoop", [&](const int val) { trig_FilterLeakEnvLoop = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, Trigger),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, BeatDivider),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, InternalClock),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, ClockSpeed),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, MasterPitch),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, MasterTune),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, QuantizePitch),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, ScaleCorrect),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, Volume),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, SawPitch),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, SawTune),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PulsePitch),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PulseTune),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PulseWidth),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, PWMon),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PWMspeed),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PWMamount),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, NoiseVol),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, SawVol),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PulseVol),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, OSCmix),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, RingOnSaw),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, RingOnPulse),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, AMisSquare),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, RingModFreq),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, RingModAmnt),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, WaveFolder),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, Cutoff),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, Resonance),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FilterTracking),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FilterLeakage),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, PatternSequencer),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, ResetSequencer),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, BjorklundOff),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, BjorklundPattern),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, BjorklundShift),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, PalindromeOff),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PalindromeSelect),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, PalindromeRootkey),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, AccentOff),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, AccentSync),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, AccentDestination),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, AccentBeatDivider),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, AccentIsBjorklund),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, AccentSelect),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, AccentShift),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, AccentAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGvolActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGvolNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, VolAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, VolDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, VolEnvAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGvolLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EasyEditOn),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGnoiseActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGnoiseNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, NoiseAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, NoiseDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, NoiseEnvAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGnoiseLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGoscMixActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGoscMixNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, OscMixAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, OscMixDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, OscMixEnvAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGoscMixLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGringActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGringNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, RingAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, RingDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, RingAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGringLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGwfActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGwfNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, WfAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, WfDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, WfEnvAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGwfLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGfiltActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGfiltNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FiltAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FiltDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FiltAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGfiltLoop),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGfilterLeakActive),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, EGfilterLeakNegative),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FilterLeakAttack),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FilterLeakDecay),
+        MK_PARAM_INT(ctagSoundProcessorBjorklund, FilterLeakEnvAmount),
+        MK_PARAM_BOOL(ctagSoundProcessorBjorklund, FilterLeakEnvLoop),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "Bjorklund";
     // sectionCpp0
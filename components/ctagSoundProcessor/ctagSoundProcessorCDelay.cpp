@@ -180,54 +180,33 @@ void ctagSoundProcessorCDelay::Process(const ProcessData &data) {
 void ctagSoundProcessorCDelay::knowYourself() {
 // autogenerated code here
 // sectionCpp0
-    pMapPar.emplace("dly_time", [&](const int val) { dly_time = val; });
-    pMapCv.emplace("dly_time", [&](const int val) { cv_dly_time = val; });
-    pMapPar.emplace("dly_time_bpm", [&](const int val) { dly_time_bpm = val; });
-    pMapCv.emplace("dly_time_bpm", [&](const int val) { cv_dly_time_bpm = val; });
-    pMapPar.emplace("dly_sync", [&](const int val) { dly_sync = val; });
-    pMapCv.emplace("dly_sync", [&](const int val) { cv_dly_sync = val; });
-    pMapPar.emplace("dly_feedback", [&](const int val) { dly_feedback = val; });
-    pMapCv.emplace("dly_feedback", [&](const int val) { cv_dly_feedback = val; });
-    pMapPar.emplace("freeze", [&](const int val) { freeze = val; });
-    pMapTrig.emplace("freeze", [&](const int val) { trig_freeze = val; });
-    pMapPar.emplace("dly_st_ofs", [&](const int val) { dly_st_ofs = val; });
-    pMapCv.emplace("dly_st_ofs", [&](const int val) { cv_dly_st_ofs = val; });
-    pMapPar.emplace("dly_pan_mode", [&](const int val) { dly_pan_mode = val; });
-    pMapCv.emplace("dly_pan_mode", [&](const int val) { cv_dly_pan_mode = val; });
-    pMapPar.emplace("dly_panning", [&](const int val) { dly_panning = val; });
-    pMapCv.emplace("dly_panning", [&](const int val) { cv_dly_panning = val; });
-    pMapPar.emplace("dly_mono", [&](const int val) { dly_mono = val; });
-    pMapTrig.emplace("dly_mono", [&](const int val) { trig_dly_mono = val; });
-    pMapPar.emplace("dly_wet", [&](const int val) { dly_wet = val; });
-    pMapCv.emplace("dly_wet", [&](const int val) { cv_dly_wet = val; });
-    pMapPar.emplace("dly_dry", [&](const int val) { dly_dry = val; });
-    pMapCv.emplace("dly_dry", [&](const int val) { cv_dly_dry = val; });
-    pMapPar.emplace("lfo_amt", [&](const int val) { lfo_amt = val; });
-    pMapCv.emplace("lfo_amt", [&](const int val) { cv_lfo_amt = val; });
-    pMapPar.emplace("lfo_frq", [&](const int val) { lfo_frq = val; });
-    pMapCv.emplace("lfo_frq", [&](const int val) { cv_lfo_frq = val; });
-    pMapPar.emplace("lfo_drift_amt", [&](const int val) { lfo_drift_amt = val; });
-    pMapCv.emplace("lfo_drift_amt", [&](const int val) { cv_lfo_drift_amt = val; });
-    pMapPar.emplace("lfo_drift_spd", [&](const int val) { lfo_drift_spd = val; });
-    pMapCv.emplace("lfo_drift_spd", [&](const int val) { cv_lfo_drift_spd = val; });
-    pMapPar.emplace("duck_amt", [&](const int val) { duck_amt = val; });
-    pMapCv.emplace("duck_amt", [&](const int val) { cv_duck_amt = val; });
-    pMapPar.emplace("duck_atck", [&](const int val) { duck_atck = val; });
-    pMapCv.emplace("duck_atck", [&](const int val) { cv_duck_atck = val; });
-    pMapPar.emplace("duck_rls", [&](const int val) { duck_rls = val; });
-    pMapCv.emplace("duck_rls", [&](const int val) { cv_duck_rls = val; });
-    pMapPar.emplace("flt_mode", [&](const int val) { flt_mode = val; });
-    pMapCv.emplace("flt_mode", [&](const int val) { cv_flt_mode = val; });
-    pMapPar.emplace("flt_co", [&](const int val) { flt_co = val; });
-    pMapCv.emplace("flt_co", [&](const int val) { cv_flt_co = val; });
-    pMapPar.emplace("flt_reso", [&](const int val) { flt_reso = val; });
-    pMapCv.emplace("flt_reso", [&](const int val) { cv_flt_reso = val; });
-    pMapPar.emplace("flt_lfo_freq", [&](const int val) { flt_lfo_freq = val; });
-    pMapCv.emplace("flt_lfo_freq", [&](const int val) { cv_flt_lfo_freq = val; });
-    pMapPar.emplace("flt_lfo_amt", [&](const int val) { flt_lfo_amt = val; });
-    pMapCv.emplace("flt_lfo_amt", [&](const int val) { cv_flt_lfo_amt = val; });
-    pMapPar.emplace("flt_mix", [&](const int val) { flt_mix = val; });
-    pMapCv.emplace("flt_mix", [&](const int val) { cv_flt_mix = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_time),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_time_bpm),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_sync),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_feedback),
+        MK_PARAM_BOOL(ctagSoundProcessorCDelay, freeze),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_st_ofs),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_pan_mode),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_panning),
+        MK_PARAM_BOOL(ctagSoundProcessorCDelay, dly_mono),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_wet),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, dly_dry),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, lfo_amt),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, lfo_frq),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, lfo_drift_amt),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, lfo_drift_spd),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, duck_amt),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, duck_atck),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, duck_rls),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_mode),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_co),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_reso),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_lfo_freq),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_lfo_amt),
+        MK_PARAM_INT(ctagSoundProcessorCDelay, flt_mix),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "CDelay";
     // sectionCpp0
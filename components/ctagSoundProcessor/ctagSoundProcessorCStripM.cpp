@@ -111,30 +111,21 @@ ctagSoundProcessorCStripM::~ctagSoundProcessorCStripM() {
 void ctagSoundProcessorCStripM::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("treble", [&](const int val){ treble = val;});
-	pMapCv.emplace("treble", [&](const int val){ cv_treble = val;});
-	pMapPar.emplace("mid", [&](const int val){ mid = val;});
-	pMapCv.emplace("mid", [&](const int val){ cv_mid = val;});
-	pMapPar.emplace("bass", [&](const int val){ bass = val;});
-	pMapCv.emplace("bass", [&](const int val){ cv_bass = val;});
-	pMapPar.emplace("lowpass", [&](const int val){ lowpass = val;});
-	pMapCv.emplace("lowpass", [&](const int val){ cv_lowpass = val;});
-	pMapPar.emplace("trebfreq", [&](const int val){ trebfreq = val;});
-	pMapCv.emplace("trebfreq", [&](const int val){ cv_trebfreq = val;});
-	pMapPar.emplace("bassfreq", [&](const int val){ bassfreq = val;});
-	pMapCv.emplace("bassfreq", [&](const int val){ cv_bassfreq = val;});
-	pMapPar.emplace("hipass", [&](const int val){ hipass = val;});
-	pMapCv.emplace("hipass", [&](const int val){ cv_hipass = val;});
-	pMapPar.emplace("gate", [&](const int val){ gate = val;});
-	pMapCv.emplace("gate", [&](const int val){ cv_gate = val;});
-	pMapPar.emplace("comp", [&](const int val){ comp = val;});
-	pMapCv.emplace("comp", [&](const int val){ cv_comp = val;});
-	pMapPar.emplace("compspd", [&](const int val){ compspd = val;});
-	pMapCv.emplace("compspd", [&](const int val){ cv_compspd = val;});
-	pMapPar.emplace("timelag", [&](const int val){ timelag = val;});
-	pMapCv.emplace("timelag", [&](const int val){ cv_timelag = val;});
-	pMapPar.emplace("outgain", [&](const int val){ outgain = val;});
-	pMapCv.emplace("outgain", [&](const int val){ cv_outgain = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorCStripM, treble),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, mid),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, bass),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, lowpass),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, trebfreq),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, bassfreq),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, hipass),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, gate),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, comp),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, compspd),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, timelag),
+		MK_PARAM_INT(ctagSoundProcessorCStripM, outgain),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "CStripM";
 	// sectionCpp0
@@ -20,7 +20,6 @@ respective component folders / files if different from this license.
 ***************/
 
 #include "ctagSoundProcessorClaude.hpp"
-#include "esp_heap_caps.h"
 #include <algorithm>
 
 using namespace CTAG::SP;
@@ -109,7 +108,11 @@ void ctagSoundProcessorClaude::Process(const ProcessData &data) {
     }
     p->reverb = fReverb;
 
-    processor.Process(data.buf, 32);
+    // clouds processes at most 32 frames per call (kMaxBlockSize)
+    constexpr int chunkSz = bufSz < 32 ? bufSz : 32;
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        processor.Process(data.buf + i * 2, chunkSz);
+    }
 
 }
 
@@ -120,7 +123,9 @@ void ctagSoundProcessorClaude::Init(std::size_t blockSize, void *blockPtr) {
     LoadPreset(0);
 
     // memallocs
-    block_mem = (uint8_t *) heap_caps_malloc(memLen, MALLOC_CAP_SPIRAM);
+    // granular sample buffer, only touched sparsely
+    block_mem = (uint8_t *) ctagSPAllocator::Allocate(memLen, alignof(std::max_align_t), ctagSPAllocator::Region::SPIRAM,
+                                                      ctagSPAllocator::Hint::COLD);
     if(block_mem == NULL){
         ESP_LOGE("Claude", "Cannot alloc ram!");
     }
@@ -134,40 +139,29 @@ void ctagSoundProcessorClaude::Init(std::size_t blockSize, void *blockPtr) {
 }
 
 ctagSoundProcessorClaude::~ctagSoundProcessorClaude() {
-    heap_caps_free(block_mem);
+    // no explicit freeing for block_mem needed, done by ctagSPAllocator
 }
 
 void ctagSoundProcessorClaude::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("trigger", [&](const int val){ trigger = val;});
-	pMapTrig.emplace("trigger", [&](const int val){ trig_trigger = val;});
-	pMapPar.emplace("freeze", [&](const int val){ freeze = val;});
-	pMapTrig.emplace("freeze", [&](const int val){ trig_freeze = val;});
-	pMapPar.emplace("reverse", [&](const int val){ reverse = val;});
-	pMapTrig.emplace("reverse", [&](const int val){ trig_reverse = val;});
-	pMapPar.emplace("mode", [&](const int val){ mode = val;});
-	pMapCv.emplace("mode", [&](const int val){ cv_mode = val;});
-	pMapPar.emplace("quality", [&](const int val){ quality = val;});
-	pMapCv.emplace("quality", [&](const int val){ cv_quality = val;});
-	pMapPar.emplace("position", [&](const int val){ position = val;});
-	pMapCv.emplace("position", [&](const int val){ cv_position = val;});
-	pMapPar.emplace("size", [&](const int val){ size = val;});
-	pMapCv.emplace("size", [&](const int val){ cv_size = val;});
-	pMapPar.emplace("pitch", [&](const int val){ pitch = val;});
-	pMapCv.emplace("pitch", [&](const int val){ cv_pitch = val;});
-	pMapPar.emplace("density", [&](const int val){ density = val;});
-	pMapCv.emplace("density", [&](const int val){ cv_density = val;});
-	pMapPar.emplace("texture", [&](const int val){ texture = val;});
-	pMapCv.emplace("texture", [&](const int val){ cv_texture = val;});
-	pMapPar.emplace("feedback", [&](const int val){ feedback = val;});
-	pMapCv.emplace("feedback", [&](const int val){ cv_feedback = val;});
-	pMapPar.emplace("width", [&](const int val){ width = val;});
-	pMapCv.emplace("width", [&](const int val){ cv_width = val;});
-	pMapPar.emplace("reverb", [&](const int val){ reverb = val;});
-	pMapCv.emplace("reverb", [&](const int val){ cv_reverb = val;});
-	pMapPar.emplace("drywet", [&](const int val){ drywet = val;});
-	pMapCv.emplace("drywet", [&](const int val){ cv_drywet = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorClaude, trigger),
+		MK_PARAM_BOOL(ctagSoundProcessorClaude, freeze),
+		MK_PARAM_BOOL(ctagSoundProcessorClaude, reverse),
+		MK_PARAM_INT(ctagSoundProcessorClaude, mode),
+		MK_PARAM_INT(ctagSoundProcessorClaude, quality),
+		MK_PARAM_INT(ctagSoundProcessorClaude, position),
+		MK_PARAM_INT(ctagSoundProcessorClaude, size),
+		MK_PARAM_INT(ctagSoundProcessorClaude, pitch),
+		MK_PARAM_INT(ctagSoundProcessorClaude, density),
+		MK_PARAM_INT(ctagSoundProcessorClaude, texture),
+		MK_PARAM_INT(ctagSoundProcessorClaude, feedback),
+		MK_PARAM_INT(ctagSoundProcessorClaude, width),
+		MK_PARAM_INT(ctagSoundProcessorClaude, reverb),
+		MK_PARAM_INT(ctagSoundProcessorClaude, drywet),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "Claude";
 	// sectionCpp0
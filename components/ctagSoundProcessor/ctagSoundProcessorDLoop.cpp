@@ -141,32 +141,22 @@ void ctagSoundProcessorDLoop::Process(const ProcessData &data) {
 
 void ctagSoundProcessorDLoop::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("reset", [&](const int val) { reset = val; });
-    pMapTrig.emplace("reset", [&](const int val) { trig_reset = val; });
-    pMapPar.emplace("loop", [&](const int val) { loop = val; });
-    pMapTrig.emplace("loop", [&](const int val) { trig_loop = val; });
-    pMapPar.emplace("seed", [&](const int val) { seed = val; });
-    pMapCv.emplace("seed", [&](const int val) { cv_seed = val; });
-    pMapPar.emplace("level", [&](const int val) { level = val; });
-    pMapCv.emplace("level", [&](const int val) { cv_level = val; });
-    pMapPar.emplace("density", [&](const int val) { density = val; });
-    pMapCv.emplace("density", [&](const int val) { cv_density = val; });
-    pMapPar.emplace("slen", [&](const int val) { slen = val; });
-    pMapCv.emplace("slen", [&](const int val) { cv_slen = val; });
-    pMapPar.emplace("sspread", [&](const int val) { sspread = val; });
-    pMapCv.emplace("sspread", [&](const int val) { cv_sspread = val; });
-    pMapPar.emplace("ofssspread", [&](const int val) { ofssspread = val; });
-    pMapCv.emplace("ofssspread", [&](const int val) { cv_ofssspread = val; });
-    pMapPar.emplace("vspread", [&](const int val) { vspread = val; });
-    pMapCv.emplace("vspread", [&](const int val) { cv_vspread = val; });
-    pMapPar.emplace("ofsvspread", [&](const int val) { ofsvspread = val; });
-    pMapCv.emplace("ofsvspread", [&](const int val) { cv_ofsvspread = val; });
-    pMapPar.emplace("s_enable", [&](const int val) { s_enable = val; });
-    pMapTrig.emplace("s_enable", [&](const int val) { trig_s_enable = val; });
-    pMapPar.emplace("s_rlevel", [&](const int val) { s_rlevel = val; });
-    pMapCv.emplace("s_rlevel", [&](const int val) { cv_s_rlevel = val; });
-    pMapPar.emplace("s_decay", [&](const int val) { s_decay = val; });
-    pMapCv.emplace("s_decay", [&](const int val) { cv_s_decay = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorDLoop, reset),
+        MK_PARAM_BOOL(ctagSoundProcessorDLoop, loop),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, seed),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, level),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, density),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, slen),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, sspread),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, ofssspread),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, vspread),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, ofsvspread),
+        MK_PARAM_BOOL(ctagSoundProcessorDLoop, s_enable),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, s_rlevel),
+        MK_PARAM_INT(ctagSoundProcessorDLoop, s_decay),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "DLoop";
     // sectionCpp0
@@ -33,7 +33,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             fABAfm,
             fABSfm,
             abd_out,
-            32);
+            bufSz);
         data_ptrs[0] = abd_out;
     }
     else{
@@ -70,7 +70,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             fASDecay,
             fASAspy,
             asd_out,
-            32);
+            bufSz);
         data_ptrs[1] = asd_out;
     }
     else{
@@ -110,7 +110,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             fDBFmEnv,
             fDBFmDcy,
             dbd_out,
-            32);
+            bufSz);
         data_ptrs[2] = dbd_out;
     }
     else{
@@ -147,7 +147,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             fDSDecay,
             fDSSpy,
             dsd_out,
-            32);
+            bufSz);
         data_ptrs[3] = dsd_out;
     }
     else{
@@ -186,7 +186,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             temp1_,
             temp2_,
             hh1_out,
-            32);
+            bufSz);
         data_ptrs[4] = hh1_out;
     }
     else{
@@ -225,7 +225,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             temp1_,
             temp2_,
             hh2_out,
-            32);
+            bufSz);
         data_ptrs[5] = hh2_out;
     }
     else{
@@ -261,7 +261,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             rs_trig_prev = false;
         }
 
-        rs.Process(rs_out, 32);
+        rs.Process(rs_out, bufSz);
         data_ptrs[6] = rs_out;
     }
     else{
@@ -304,7 +304,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
             cl_trig_prev = false;
         }
 
-        cl.Process(cl_out, 32);
+        cl.Process(cl_out, bufSz);
         data_ptrs[7] = cl_out;
     }
     else{
@@ -366,7 +366,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
         MK_INT_PAR_ABS(iS1FType, s1_ft, 4.f)
         CONSTRAIN(iS1FType, 0, 3);
         rompler[0].params.filterType = static_cast<CTAG::SYNTHESIS::RomplerVoiceMinimal::FilterType>(iS1FType);
-        rompler[0].Process(s1_out, 32);
+        rompler[0].Process(s1_out, bufSz);
         data_ptrs[8] = s1_out;
     }
     else{
@@ -425,7 +425,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
         MK_INT_PAR_ABS(iS2FType, s2_ft, 4.f)
         CONSTRAIN(iS2FType, 0, 3);
         rompler[1].params.filterType = static_cast<CTAG::SYNTHESIS::RomplerVoiceMinimal::FilterType>(iS2FType);
-        rompler[1].Process(s2_out, 32);
+        rompler[1].Process(s2_out, bufSz);
         data_ptrs[9] = s2_out;
     }
     else{
@@ -484,7 +484,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
         MK_INT_PAR_ABS(iS3FType, s3_ft, 4.f)
         CONSTRAIN(iS3FType, 0, 3);
         rompler[2].params.filterType = static_cast<CTAG::SYNTHESIS::RomplerVoiceMinimal::FilterType>(iS3FType);
-        rompler[2].Process(s3_out, 32);
+        rompler[2].Process(s3_out, bufSz);
         data_ptrs[10] = s3_out;
     }
     else{
@@ -543,7 +543,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
         MK_INT_PAR_ABS(iS4FType, s4_ft, 4.f)
         CONSTRAIN(iS4FType, 0, 3);
         rompler[3].params.filterType = static_cast<CTAG::SYNTHESIS::RomplerVoiceMinimal::FilterType>(iS4FType);
-        rompler[3].Process(s4_out, 32);
+        rompler[3].Process(s4_out, bufSz);
         data_ptrs[11] = s4_out;
     }
     else{
@@ -574,7 +574,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
     fMixLevel *= fMixLevel;
 
     if (bSumMute){
-        memset(data.buf, 0, 32 * 2 * sizeof(float));
+        memset(data.buf, 0, bufSz * 2 * sizeof(float));
         return;
     }
 
@@ -608,7 +608,7 @@ void ctagSoundProcessorDrumRack::Process(const ProcessData& data){
         fS3Lev * fS3Pan,
         fS4Lev * fS4Pan
     };
-    for (int i = 0; i < 32; i++){
+    for (int i = 0; i < bufSz; i++){
         float fVal_l = 0.f;
         float fVal_r = 0.f;
         fVal_l += data_ptrs[0][i] * lev_l[0];
@@ -683,7 +683,7 @@ void ctagSoundProcessorDrumRack::Init(std::size_t blockSize, void* blockPtr){
     rs.Init();
     cl.Init();
 
-    std::fill_n(silence, 32, 0.f);
+    std::fill_n(silence, bufSz, 0.f);
 
     // init romplers
     for (auto& r : rompler){
@@ -693,347 +693,186 @@ void ctagSoundProcessorDrumRack::Init(std::size_t blockSize, void* blockPtr){
     // check if blockMem is large enough
     // blockMem is used just like larger blocks of heap memory
     // assert(blockSize >= memLen);
-    // if memory larger than blockMem is needed, use heap_caps_malloc() instead with MALLOC_CAPS_SPIRAM
+    // if memory larger than blockMem is needed, use ctagSPAllocator::Allocate() instead with Region::SPIRAM
 }
 
 // no ctor, use Init() instead, is called from factory after successful creation
 // dtor
 ctagSoundProcessorDrumRack::~ctagSoundProcessorDrumRack(){
     // no explicit freeing for blockMem needed, done by ctagSPAllocator
-    // explicit free is only needed when using heap_caps_malloc() with MALLOC_CAPS_SPIRAM
+    // memory from ctagSPAllocator::Allocate() is released with the arena, too
 }
 
 void ctagSoundProcessorDrumRack::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("ab_trigger", [&](const int val){ ab_trigger = val; });
-    pMapTrig.emplace("ab_trigger", [&](const int val){ trig_ab_trigger = val; });
-    pMapPar.emplace("ab_mute", [&](const int val){ ab_mute = val; });
-    pMapTrig.emplace("ab_mute", [&](const int val){ trig_ab_mute = val; });
-    pMapPar.emplace("ab_lev", [&](const int val){ ab_lev = val; });
-    pMapCv.emplace("ab_lev", [&](const int val){ cv_ab_lev = val; });
-    pMapPar.emplace("ab_pan", [&](const int val){ ab_pan = val; });
-    pMapCv.emplace("ab_pan", [&](const int val){ cv_ab_pan = val; });
-    pMapPar.emplace("ab_accent", [&](const int val){ ab_accent = val; });
-    pMapCv.emplace("ab_accent", [&](const int val){ cv_ab_accent = val; });
-    pMapPar.emplace("ab_f0", [&](const int val){ ab_f0 = val; });
-    pMapCv.emplace("ab_f0", [&](const int val){ cv_ab_f0 = val; });
-    pMapPar.emplace("ab_tone", [&](const int val){ ab_tone = val; });
-    pMapCv.emplace("ab_tone", [&](const int val){ cv_ab_tone = val; });
-    pMapPar.emplace("ab_decay", [&](const int val){ ab_decay = val; });
-    pMapCv.emplace("ab_decay", [&](const int val){ cv_ab_decay = val; });
-    pMapPar.emplace("ab_a_fm", [&](const int val){ ab_a_fm = val; });
-    pMapCv.emplace("ab_a_fm", [&](const int val){ cv_ab_a_fm = val; });
-    pMapPar.emplace("ab_s_fm", [&](const int val){ ab_s_fm = val; });
-    pMapCv.emplace("ab_s_fm", [&](const int val){ cv_ab_s_fm = val; });
-    pMapPar.emplace("db_trigger", [&](const int val){ db_trigger = val; });
-    pMapTrig.emplace("db_trigger", [&](const int val){ trig_db_trigger = val; });
-    pMapPar.emplace("db_mute", [&](const int val){ db_mute = val; });
-    pMapTrig.emplace("db_mute", [&](const int val){ trig_db_mute = val; });
-    pMapPar.emplace("db_lev", [&](const int val){ db_lev = val; });
-    pMapCv.emplace("db_lev", [&](const int val){ cv_db_lev = val; });
-    pMapPar.emplace("db_pan", [&](const int val){ db_pan = val; });
-    pMapCv.emplace("db_pan", [&](const int val){ cv_db_pan = val; });
-    pMapPar.emplace("db_accent", [&](const int val){ db_accent = val; });
-    pMapCv.emplace("db_accent", [&](const int val){ cv_db_accent = val; });
-    pMapPar.emplace("db_f0", [&](const int val){ db_f0 = val; });
-    pMapCv.emplace("db_f0", [&](const int val){ cv_db_f0 = val; });
-    pMapPar.emplace("db_tone", [&](const int val){ db_tone = val; });
-    pMapCv.emplace("db_tone", [&](const int val){ cv_db_tone = val; });
-    pMapPar.emplace("db_decay", [&](const int val){ db_decay = val; });
-    pMapCv.emplace("db_decay", [&](const int val){ cv_db_decay = val; });
-    pMapPar.emplace("db_dirty", [&](const int val){ db_dirty = val; });
-    pMapCv.emplace("db_dirty", [&](const int val){ cv_db_dirty = val; });
-    pMapPar.emplace("db_fm_env", [&](const int val){ db_fm_env = val; });
-    pMapCv.emplace("db_fm_env", [&](const int val){ cv_db_fm_env = val; });
-    pMapPar.emplace("db_fm_dcy", [&](const int val){ db_fm_dcy = val; });
-    pMapCv.emplace("db_fm_dcy", [&](const int val){ cv_db_fm_dcy = val; });
-    pMapPar.emplace("as_trigger", [&](const int val){ as_trigger = val; });
-    pMapTrig.emplace("as_trigger", [&](const int val){ trig_as_trigger = val; });
-    pMapPar.emplace("as_mute", [&](const int val){ as_mute = val; });
-    pMapTrig.emplace("as_mute", [&](const int val){ trig_as_mute = val; });
-    pMapPar.emplace("as_lev", [&](const int val){ as_lev = val; });
-    pMapCv.emplace("as_lev", [&](const int val){ cv_as_lev = val; });
-    pMapPar.emplace("as_pan", [&](const int val){ as_pan = val; });
-    pMapCv.emplace("as_pan", [&](const int val){ cv_as_pan = val; });
-    pMapPar.emplace("as_accent", [&](const int val){ as_accent = val; });
-    pMapCv.emplace("as_accent", [&](const int val){ cv_as_accent = val; });
-    pMapPar.emplace("as_f0", [&](const int val){ as_f0 = val; });
-    pMapCv.emplace("as_f0", [&](const int val){ cv_as_f0 = val; });
-    pMapPar.emplace("as_tone", [&](const int val){ as_tone = val; });
-    pMapCv.emplace("as_tone", [&](const int val){ cv_as_tone = val; });
-    pMapPar.emplace("as_decay", [&](const int val){ as_decay = val; });
-    pMapCv.emplace("as_decay", [&](const int val){ cv_as_decay = val; });
-    pMapPar.emplace("as_a_spy", [&](const int val){ as_a_spy = val; });
-    pMapCv.emplace("as_a_spy", [&](const int val){ cv_as_a_spy = val; });
-    pMapPar.emplace("ds_trigger", [&](const int val){ ds_trigger = val; });
-    pMapTrig.emplace("ds_trigger", [&](const int val){ trig_ds_trigger = val; });
-    pMapPar.emplace("ds_mute", [&](const int val){ ds_mute = val; });
-    pMapTrig.emplace("ds_mute", [&](const int val){ trig_ds_mute = val; });
-    pMapPar.emplace("ds_lev", [&](const int val){ ds_lev = val; });
-    pMapCv.emplace("ds_lev", [&](const int val){ cv_ds_lev = val; });
-    pMapPar.emplace("ds_pan", [&](const int val){ ds_pan = val; });
-    pMapCv.emplace("ds_pan", [&](const int val){ cv_ds_pan = val; });
-    pMapPar.emplace("ds_accent", [&](const int val){ ds_accent = val; });
-    pMapCv.emplace("ds_accent", [&](const int val){ cv_ds_accent = val; });
-    pMapPar.emplace("ds_f0", [&](const int val){ ds_f0 = val; });
-    pMapCv.emplace("ds_f0", [&](const int val){ cv_ds_f0 = val; });
-    pMapPar.emplace("ds_fm_amt", [&](const int val){ ds_fm_amt = val; });
-    pMapCv.emplace("ds_fm_amt", [&](const int val){ cv_ds_fm_amt = val; });
-    pMapPar.emplace("ds_decay", [&](const int val){ ds_decay = val; });
-    pMapCv.emplace("ds_decay", [&](const int val){ cv_ds_decay = val; });
-    pMapPar.emplace("ds_spy", [&](const int val){ ds_spy = val; });
-    pMapCv.emplace("ds_spy", [&](const int val){ cv_ds_spy = val; });
-    pMapPar.emplace("hh1_trigger", [&](const int val){ hh1_trigger = val; });
-    pMapTrig.emplace("hh1_trigger", [&](const int val){ trig_hh1_trigger = val; });
-    pMapPar.emplace("hh1_mute", [&](const int val){ hh1_mute = val; });
-    pMapTrig.emplace("hh1_mute", [&](const int val){ trig_hh1_mute = val; });
-    pMapPar.emplace("hh1_lev", [&](const int val){ hh1_lev = val; });
-    pMapCv.emplace("hh1_lev", [&](const int val){ cv_hh1_lev = val; });
-    pMapPar.emplace("hh1_pan", [&](const int val){ hh1_pan = val; });
-    pMapCv.emplace("hh1_pan", [&](const int val){ cv_hh1_pan = val; });
-    pMapPar.emplace("hh1_accent", [&](const int val){ hh1_accent = val; });
-    pMapCv.emplace("hh1_accent", [&](const int val){ cv_hh1_accent = val; });
-    pMapPar.emplace("hh1_f0", [&](const int val){ hh1_f0 = val; });
-    pMapCv.emplace("hh1_f0", [&](const int val){ cv_hh1_f0 = val; });
-    pMapPar.emplace("hh1_tone", [&](const int val){ hh1_tone = val; });
-    pMapCv.emplace("hh1_tone", [&](const int val){ cv_hh1_tone = val; });
-    pMapPar.emplace("hh1_decay", [&](const int val){ hh1_decay = val; });
-    pMapCv.emplace("hh1_decay", [&](const int val){ cv_hh1_decay = val; });
-    pMapPar.emplace("hh1_noise", [&](const int val){ hh1_noise = val; });
-    pMapCv.emplace("hh1_noise", [&](const int val){ cv_hh1_noise = val; });
-    pMapPar.emplace("hh2_trigger", [&](const int val){ hh2_trigger = val; });
-    pMapTrig.emplace("hh2_trigger", [&](const int val){ trig_hh2_trigger = val; });
-    pMapPar.emplace("hh2_mute", [&](const int val){ hh2_mute = val; });
-    pMapTrig.emplace("hh2_mute", [&](const int val){ trig_hh2_mute = val; });
-    pMapPar.emplace("hh2_lev", [&](const int val){ hh2_lev = val; });
-    pMapCv.emplace("hh2_lev", [&](const int val){ cv_hh2_lev = val; });
-    pMapPar.emplace("hh2_pan", [&](const int val){ hh2_pan = val; });
-    pMapCv.emplace("hh2_pan", [&](const int val){ cv_hh2_pan = val; });
-    pMapPar.emplace("hh2_accent", [&](const int val){ hh2_accent = val; });
-    pMapCv.emplace("hh2_accent", [&](const int val){ cv_hh2_accent = val; });
-    pMapPar.emplace("hh2_f0", [&](const int val){ hh2_f0 = val; });
-    pMapCv.emplace("hh2_f0", [&](const int val){ cv_hh2_f0 = val; });
-    pMapPar.emplace("hh2_tone", [&](const int val){ hh2_tone = val; });
-    pMapCv.emplace("hh2_tone", [&](const int val){ cv_hh2_tone = val; });
-    pMapPar.emplace("hh2_decay", [&](const int val){ hh2_decay = val; });
-    pMapCv.emplace("hh2_decay", [&](const int val){ cv_hh2_decay = val; });
-    pMapPar.emplace("hh2_noise", [&](const int val){ hh2_noise = val; });
-    pMapCv.emplace("hh2_noise", [&](const int val){ cv_hh2_noise = val; });
-    pMapPar.emplace("rs_trigger", [&](const int val){ rs_trigger = val; });
-    pMapTrig.emplace("rs_trigger", [&](const int val){ trig_rs_trigger = val; });
-    pMapPar.emplace("rs_mute", [&](const int val){ rs_mute = val; });
-    pMapTrig.emplace("rs_mute", [&](const int val){ trig_rs_mute = val; });
-    pMapPar.emplace("rs_lev", [&](const int val){ rs_lev = val; });
-    pMapCv.emplace("rs_lev", [&](const int val){ cv_rs_lev = val; });
-    pMapPar.emplace("rs_pan", [&](const int val){ rs_pan = val; });
-    pMapCv.emplace("rs_pan", [&](const int val){ cv_rs_pan = val; });
-    pMapPar.emplace("rs_accent", [&](const int val){ rs_accent = val; });
-    pMapCv.emplace("rs_accent", [&](const int val){ cv_rs_accent = val; });
-    pMapPar.emplace("rs_f0", [&](const int val){ rs_f0 = val; });
-    pMapCv.emplace("rs_f0", [&](const int val){ cv_rs_f0 = val; });
-    pMapPar.emplace("rs_tone", [&](const int val){ rs_tone = val; });
-    pMapCv.emplace("rs_tone", [&](const int val){ cv_rs_tone = val; });
-    pMapPar.emplace("rs_decay", [&](const int val){ rs_decay = val; });
-    pMapCv.emplace("rs_decay", [&](const int val){ cv_rs_decay = val; });
-    pMapPar.emplace("rs_noise", [&](const int val){ rs_noise = val; });
-    pMapCv.emplace("rs_noise", [&](const int val){ cv_rs_noise = val; });
-    pMapPar.emplace("cl_trigger", [&](const int val){ cl_trigger = val; });
-    pMapTrig.emplace("cl_trigger", [&](const int val){ trig_cl_trigger = val; });
-    pMapPar.emplace("cl_mute", [&](const int val){ cl_mute = val; });
-    pMapTrig.emplace("cl_mute", [&](const int val){ trig_cl_mute = val; });
-    pMapPar.emplace("cl_lev", [&](const int val){ cl_lev = val; });
-    pMapCv.emplace("cl_lev", [&](const int val){ cv_cl_lev = val; });
-    pMapPar.emplace("cl_pan", [&](const int val){ cl_pan = val; });
-    pMapCv.emplace("cl_pan", [&](const int val){ cv_cl_pan = val; });
-    pMapPar.emplace("cl_f0", [&](const int val){ cl_f0 = val; });
-    pMapCv.emplace("cl_f0", [&](const int val){ cv_cl_f0 = val; });
-    pMapPar.emplace("cl_tone", [&](const int val){ cl_tone = val; });
-    pMapCv.emplace("cl_tone", [&](const int val){ cv_cl_tone = val; });
-    pMapPar.emplace("cl_decay", [&](const int val){ cl_decay = val; });
-    pMapCv.emplace("cl_decay", [&](const int val){ cv_cl_decay = val; });
-    pMapPar.emplace("cl_scale", [&](const int val){ cl_scale = val; });
-    pMapCv.emplace("cl_scale", [&](const int val){ cv_cl_scale = val; });
-    pMapPar.emplace("cl_transient", [&](const int val){ cl_transient = val; });
-    pMapCv.emplace("cl_transient", [&](const int val){ cv_cl_transient = val; });
-    pMapPar.emplace("s1_gate", [&](const int val){ s1_gate = val; });
-    pMapTrig.emplace("s1_gate", [&](const int val){ trig_s1_gate = val; });
-    pMapPar.emplace("s1_mute", [&](const int val){ s1_mute = val; });
-    pMapTrig.emplace("s1_mute", [&](const int val){ trig_s1_mute = val; });
-    pMapPar.emplace("s1_lev", [&](const int val){ s1_lev = val; });
-    pMapCv.emplace("s1_lev", [&](const int val){ cv_s1_lev = val; });
-    pMapPar.emplace("s1_pan", [&](const int val){ s1_pan = val; });
-    pMapCv.emplace("s1_pan", [&](const int val){ cv_s1_pan = val; });
-    pMapPar.emplace("s1_speed", [&](const int val){ s1_speed = val; });
-    pMapCv.emplace("s1_speed", [&](const int val){ cv_s1_speed = val; });
-    pMapPar.emplace("s1_pitch", [&](const int val){ s1_pitch = val; });
-    pMapCv.emplace("s1_pitch", [&](const int val){ cv_s1_pitch = val; });
-    pMapPar.emplace("s1_bank", [&](const int val){ s1_bank = val; });
-    pMapCv.emplace("s1_bank", [&](const int val){ cv_s1_bank = val; });
-    pMapPar.emplace("s1_slice", [&](const int val){ s1_slice = val; });
-    pMapCv.emplace("s1_slice", [&](const int val){ cv_s1_slice = val; });
-    pMapPar.emplace("s1_start", [&](const int val){ s1_start = val; });
-    pMapCv.emplace("s1_start", [&](const int val){ cv_s1_start = val; });
-    pMapPar.emplace("s1_end", [&](const int val){ s1_end = val; });
-    pMapCv.emplace("s1_end", [&](const int val){ cv_s1_end = val; });
-    pMapPar.emplace("s1_lp", [&](const int val){ s1_lp = val; });
-    pMapTrig.emplace("s1_lp", [&](const int val){ trig_s1_lp = val; });
-    pMapPar.emplace("s1_lp_pp", [&](const int val){ s1_lp_pp = val; });
-    pMapTrig.emplace("s1_lp_pp", [&](const int val){ trig_s1_lp_pp = val; });
-    pMapPar.emplace("s1_lp_pos", [&](const int val){ s1_lp_pos = val; });
-    pMapCv.emplace("s1_lp_pos", [&](const int val){ cv_s1_lp_pos = val; });
-    pMapPar.emplace("s1_atk", [&](const int val){ s1_atk = val; });
-    pMapCv.emplace("s1_atk", [&](const int val){ cv_s1_atk = val; });
-    pMapPar.emplace("s1_dcy", [&](const int val){ s1_dcy = val; });
-    pMapCv.emplace("s1_dcy", [&](const int val){ cv_s1_dcy = val; });
-    pMapPar.emplace("s1_eg2fm", [&](const int val){ s1_eg2fm = val; });
-    pMapCv.emplace("s1_eg2fm", [&](const int val){ cv_s1_eg2fm = val; });
-    pMapPar.emplace("s1_brr", [&](const int val){ s1_brr = val; });
-    pMapCv.emplace("s1_brr", [&](const int val){ cv_s1_brr = val; });
-    pMapPar.emplace("s1_ft", [&](const int val){ s1_ft = val; });
-    pMapCv.emplace("s1_ft", [&](const int val){ cv_s1_ft = val; });
-    pMapPar.emplace("s1_fc", [&](const int val){ s1_fc = val; });
-    pMapCv.emplace("s1_fc", [&](const int val){ cv_s1_fc = val; });
-    pMapPar.emplace("s1_fq", [&](const int val){ s1_fq = val; });
-    pMapCv.emplace("s1_fq", [&](const int val){ cv_s1_fq = val; });
-    pMapPar.emplace("s2_gate", [&](const int val){ s2_gate = val; });
-    pMapTrig.emplace("s2_gate", [&](const int val){ trig_s2_gate = val; });
-    pMapPar.emplace("s2_mute", [&](const int val){ s2_mute = val; });
-    pMapTrig.emplace("s2_mute", [&](const int val){ trig_s2_mute = val; });
-    pMapPar.emplace("s2_lev", [&](const int val){ s2_lev = val; });
-    pMapCv.emplace("s2_lev", [&](const int val){ cv_s2_lev = val; });
-    pMapPar.emplace("s2_pan", [&](const int val){ s2_pan = val; });
-    pMapCv.emplace("s2_pan", [&](const int val){ cv_s2_pan = val; });
-    pMapPar.emplace("s2_speed", [&](const int val){ s2_speed = val; });
-    pMapCv.emplace("s2_speed", [&](const int val){ cv_s2_speed = val; });
-    pMapPar.emplace("s2_pitch", [&](const int val){ s2_pitch = val; });
-    pMapCv.emplace("s2_pitch", [&](const int val){ cv_s2_pitch = val; });
-    pMapPar.emplace("s2_bank", [&](const int val){ s2_bank = val; });
-    pMapCv.emplace("s2_bank", [&](const int val){ cv_s2_bank = val; });
-    pMapPar.emplace("s2_slice", [&](const int val){ s2_slice = val; });
-    pMapCv.emplace("s2_slice", [&](const int val){ cv_s2_slice = val; });
-    pMapPar.emplace("s2_start", [&](const int val){ s2_start = val; });
-    pMapCv.emplace("s2_start", [&](const int val){ cv_s2_start = val; });
-    pMapPar.emplace("s2_end", [&](const int val){ s2_end = val; });
-    pMapCv.emplace("s2_end", [&](const int val){ cv_s2_end = val; });
-    pMapPar.emplace("s2_lp", [&](const int val){ s2_lp = val; });
-    pMapTrig.emplace("s2_lp", [&](const int val){ trig_s2_lp = val; });
-    pMapPar.emplace("s2_lp_pp", [&](const int val){ s2_lp_pp = val; });
-    pMapTrig.emplace("s2_lp_pp", [&](const int val){ trig_s2_lp_pp = val; });
-    pMapPar.emplace("s2_lp_pos", [&](const int val){ s2_lp_pos = val; });
-    pMapCv.emplace("s2_lp_pos", [&](const int val){ cv_s2_lp_pos = val; });
-    pMapPar.emplace("s2_atk", [&](const int val){ s2_atk = val; });
-    pMapCv.emplace("s2_atk", [&](const int val){ cv_s2_atk = val; });
-    pMapPar.emplace("s2_dcy", [&](const int val){ s2_dcy = val; });
-    pMapCv.emplace("s2_dcy", [&](const int val){ cv_s2_dcy = val; });
-    pMapPar.emplace("s2_eg2fm", [&](const int val){ s2_eg2fm = val; });
-    pMapCv.emplace("s2_eg2fm", [&](const int val){ cv_s2_eg2fm = val; });
-    pMapPar.emplace("s2_brr", [&](const int val){ s2_brr = val; });
-    pMapCv.emplace("s2_brr", [&](const int val){ cv_s2_brr = val; });
-    pMapPar.emplace("s2_ft", [&](const int val){ s2_ft = val; });
-    pMapCv.emplace("s2_ft", [&](const int val){ cv_s2_ft = val; });
-    pMapPar.emplace("s2_fc", [&](const int val){ s2_fc = val; });
-    pMapCv.emplace("s2_fc", [&](const int val){ cv_s2_fc = val; });
-    pMapPar.emplace("s2_fq", [&](const int val){ s2_fq = val; });
-    pMapCv.emplace("s2_fq", [&](const int val){ cv_s2_fq = val; });
-    pMapPar.emplace("s3_gate", [&](const int val){ s3_gate = val; });
-    pMapTrig.emplace("s3_gate", [&](const int val){ trig_s3_gate = val; });
-    pMapPar.emplace("s3_mute", [&](const int val){ s3_mute = val; });
-    pMapTrig.emplace("s3_mute", [&](const int val){ trig_s3_mute = val; });
-    pMapPar.emplace("s3_lev", [&](const int val){ s3_lev = val; });
-    pMapCv.emplace("s3_lev", [&](const int val){ cv_s3_lev = val; });
-    pMapPar.emplace("s3_pan", [&](const int val){ s3_pan = val; });
-    pMapCv.emplace("s3_pan", [&](const int val){ cv_s3_pan = val; });
-    pMapPar.emplace("s3_speed", [&](const int val){ s3_speed = val; });
-    pMapCv.emplace("s3_speed", [&](const int val){ cv_s3_speed = val; });
-    pMapPar.emplace("s3_pitch", [&](const int val){ s3_pitch = val; });
-    pMapCv.emplace("s3_pitch", [&](const int val){ cv_s3_pitch = val; });
-    pMapPar.emplace("s3_bank", [&](const int val){ s3_bank = val; });
-    pMapCv.emplace("s3_bank", [&](const int val){ cv_s3_bank = val; });
-    pMapPar.emplace("s3_slice", [&](const int val){ s3_slice = val; });
-    pMapCv.emplace("s3_slice", [&](const int val){ cv_s3_slice = val; });
-    pMapPar.emplace("s3_start", [&](const int val){ s3_start = val; });
-    pMapCv.emplace("s3_start", [&](const int val){ cv_s3_start = val; });
-    pMapPar.emplace("s3_end", [&](const int val){ s3_end = val; });
-    pMapCv.emplace("s3_end", [&](const int val){ cv_s3_end = val; });
-    pMapPar.emplace("s3_lp", [&](const int val){ s3_lp = val; });
-    pMapTrig.emplace("s3_lp", [&](const int val){ trig_s3_lp = val; });
-    pMapPar.emplace("s3_lp_pp", [&](const int val){ s3_lp_pp = val; });
-    pMapTrig.emplace("s3_lp_pp", [&](const int val){ trig_s3_lp_pp = val; });
-    pMapPar.emplace("s3_lp_pos", [&](const int val){ s3_lp_pos = val; });
-    pMapCv.emplace("s3_lp_pos", [&](const int val){ cv_s3_lp_pos = val; });
-    pMapPar.emplace("s3_atk", [&](const int val){ s3_atk = val; });
-    pMapCv.emplace("s3_atk", [&](const int val){ cv_s3_atk = val; });
-    pMapPar.emplace("s3_dcy", [&](const int val){ s3_dcy = val; });
-    pMapCv.emplace("s3_dcy", [&](const int val){ cv_s3_dcy = val; });
-    pMapPar.emplace("s3_eg2fm", [&](const int val){ s3_eg2fm = val; });
-    pMapCv.emplace("s3_eg2fm", [&](const int val){ cv_s3_eg2fm = val; });
-    pMapPar.emplace("s3_brr", [&](const int val){ s3_brr = val; });
-    pMapCv.emplace("s3_brr", [&](const int val){ cv_s3_brr = val; });
-    pMapPar.emplace("s3_ft", [&](const int val){ s3_ft = val; });
-    pMapCv.emplace("s3_ft", [&](const int val){ cv_s3_ft = val; });
-    pMapPar.emplace("s3_fc", [&](const int val){ s3_fc = val; });
-    pMapCv.emplace("s3_fc", [&](const int val){ cv_s3_fc = val; });
-    pMapPar.emplace("s3_fq", [&](const int val){ s3_fq = val; });
-    pMapCv.emplace("s3_fq", [&](const int val){ cv_s3_fq = val; });
-    pMapPar.emplace("s4_gate", [&](const int val){ s4_gate = val; });
-    pMapTrig.emplace("s4_gate", [&](const int val){ trig_s4_gate = val; });
-    pMapPar.emplace("s4_mute", [&](const int val){ s4_mute = val; });
-    pMapTrig.emplace("s4_mute", [&](const int val){ trig_s4_mute = val; });
-    pMapPar.emplace("s4_lev", [&](const int val){ s4_lev = val; });
-    pMapCv.emplace("s4_lev", [&](const int val){ cv_s4_lev = val; });
-    pMapPar.emplace("s4_pan", [&](const int val){ s4_pan = val; });
-    pMapCv.emplace("s4_pan", [&](const int val){ cv_s4_pan = val; });
-    pMapPar.emplace("s4_speed", [&](const int val){ s4_speed = val; });
-    pMapCv.emplace("s4_speed", [&](const int val){ cv_s4_speed = val; });
-    pMapPar.emplace("s4_pitch", [&](const int val){ s4_pitch = val; });
-    pMapCv.emplace("s4_pitch", [&](const int val){ cv_s4_pitch = val; });
-    pMapPar.emplace("s4_bank", [&](const int val){ s4_bank = val; });
-    pMapCv.emplace("s4_bank", [&](const int val){ cv_s4_bank = val; });
-    pMapPar.emplace("s4_slice", [&](const int val){ s4_slice = val; });
-    pMapCv.emplace("s4_slice", [&](const int val){ cv_s4_slice = val; });
-    pMapPar.emplace("s4_start", [&](const int val){ s4_start = val; });
-    pMapCv.emplace("s4_start", [&](const int val){ cv_s4_start = val; });
-    pMapPar.emplace("s4_end", [&](const int val){ s4_end = val; });
-    pMapCv.emplace("s4_end", [&](const int val){ cv_s4_end = val; });
-    pMapPar.emplace("s4_lp", [&](const int val){ s4_lp = val; });
-    pMapTrig.emplace("s4_lp", [&](const int val){ trig_s4_lp = val; });
-    pMapPar.emplace("s4_lp_pp", [&](const int val){ s4_lp_pp = val; });
-    pMapTrig.emplace("s4_lp_pp", [&](const int val){ trig_s4_lp_pp = val; });
-    pMapPar.emplace("s4_lp_pos", [&](const int val){ s4_lp_pos = val; });
-    pMapCv.emplace("s4_lp_pos", [&](const int val){ cv_s4_lp_pos = val; });
-    pMapPar.emplace("s4_atk", [&](const int val){ s4_atk = val; });
-    pMapCv.emplace("s4_atk", [&](const int val){ cv_s4_atk = val; });
-    pMapPar.emplace("s4_dcy", [&](const int val){ s4_dcy = val; });
-    pMapCv.emplace("s4_dcy", [&](const int val){ cv_s4_dcy = val; });
-    pMapPar.emplace("s4_eg2fm", [&](const int val){ s4_eg2fm = val; });
-    pMapCv.emplace("s4_eg2fm", [&](const int val){ cv_s4_eg2fm = val; });
-    pMapPar.emplace("s4_brr", [&](const int val){ s4_brr = val; });
-    pMapCv.emplace("s4_brr", [&](const int val){ cv_s4_brr = val; });
-    pMapPar.emplace("s4_ft", [&](const int val){ s4_ft = val; });
-    pMapCv.emplace("s4_ft", [&](const int val){ cv_s4_ft = val; });
-    pMapPar.emplace("s4_fc", [&](const int val){ s4_fc = val; });
-    pMapCv.emplace("s4_fc", [&](const int val){ cv_s4_fc = val; });
-    pMapPar.emplace("s4_fq", [&](const int val){ s4_fq = val; });
-    pMapCv.emplace("s4_fq", [&](const int val){ cv_s4_fq = val; });
-    pMapPar.emplace("c_thres", [&](const int val){ c_thres = val; });
-    pMapCv.emplace("c_thres", [&](const int val){ cv_c_thres = val; });
-    pMapPar.emplace("c_ratio", [&](const int val){ c_ratio = val; });
-    pMapCv.emplace("c_ratio", [&](const int val){ cv_c_ratio = val; });
-    pMapPar.emplace("c_atk", [&](const int val){ c_atk = val; });
-    pMapCv.emplace("c_atk", [&](const int val){ cv_c_atk = val; });
-    pMapPar.emplace("c_rel", [&](const int val){ c_rel = val; });
-    pMapCv.emplace("c_rel", [&](const int val){ cv_c_rel = val; });
-    pMapPar.emplace("c_lpf", [&](const int val){ c_lpf = val; });
-    pMapTrig.emplace("c_lpf", [&](const int val){ trig_c_lpf = val; });
-    pMapPar.emplace("c_gain", [&](const int val){ c_gain = val; });
-    pMapCv.emplace("c_gain", [&](const int val){ cv_c_gain = val; });
-    pMapPar.emplace("c_mix", [&](const int val){ c_mix = val; });
-    pMapCv.emplace("c_mix", [&](const int val){ cv_c_mix = val; });
-    pMapPar.emplace("sum_mute", [&](const int val){ sum_mute = val; });
-    pMapTrig.emplace("sum_mute", [&](const int val){ trig_sum_mute = val; });
-    pMapPar.emplace("sum_lev", [&](const int val){ sum_lev = val; });
-    pMapCv.emplace("sum_lev", [&](const int val){ cv_sum_lev = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, ab_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, ab_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_a_fm),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ab_s_fm),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, db_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, db_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_dirty),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_fm_env),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, db_fm_dcy),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, as_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, as_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, as_a_spy),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, ds_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, ds_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_fm_amt),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, ds_spy),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, hh1_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, hh1_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh1_noise),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, hh2_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, hh2_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, hh2_noise),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, rs_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, rs_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_accent),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, rs_noise),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, cl_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, cl_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_f0),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_tone),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_decay),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_scale),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, cl_transient),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s1_gate),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s1_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_speed),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_pitch),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_bank),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_slice),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_start),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_end),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s1_lp),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s1_lp_pp),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_lp_pos),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_atk),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_dcy),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_eg2fm),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_brr),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_ft),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_fc),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s1_fq),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s2_gate),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s2_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_speed),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_pitch),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_bank),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_slice),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_start),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_end),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s2_lp),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s2_lp_pp),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_lp_pos),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_atk),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_dcy),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_eg2fm),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_brr),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_ft),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_fc),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s2_fq),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s3_gate),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s3_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_speed),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_pitch),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_bank),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_slice),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_start),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_end),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s3_lp),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s3_lp_pp),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_lp_pos),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_atk),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_dcy),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_eg2fm),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_brr),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_ft),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_fc),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s3_fq),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s4_gate),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s4_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_lev),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_pan),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_speed),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_pitch),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_bank),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_slice),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_start),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_end),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s4_lp),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, s4_lp_pp),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_lp_pos),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_atk),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_dcy),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_eg2fm),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_brr),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_ft),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_fc),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, s4_fq),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_thres),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_ratio),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_atk),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_rel),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, c_lpf),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_gain),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, c_mix),
+        MK_PARAM_BOOL(ctagSoundProcessorDrumRack, sum_mute),
+        MK_PARAM_INT(ctagSoundProcessorDrumRack, sum_lev),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "DrumRack";
     // sectionCpp0
@@ -41,21 +41,21 @@ namespace CTAG {
         	CTAG::SYNTHESIS::Clap cl;
         	CTAG::SYNTHESIS::Rimshot rs;
 
-            float abd_out[32];
-            float asd_out[32];
-            float dbd_out[32];
-            float dsd_out[32];
-            float hh1_out[32];
-            float hh2_out[32];
-        	float rs_out[32];
-        	float cl_out[32];
-            float temp1_[32];
-            float temp2_[32];
-            float s1_out[32];
-            float s2_out[32];
-        	float s3_out[32];
-        	float s4_out[32];
-        	float silence[32];
+            float abd_out[bufSz];
+            float asd_out[bufSz];
+            float dbd_out[bufSz];
+            float dsd_out[bufSz];
+            float hh1_out[bufSz];
+            float hh2_out[bufSz];
+        	float rs_out[bufSz];
+        	float cl_out[bufSz];
+            float temp1_[bufSz];
+            float temp2_[bufSz];
+            float s1_out[bufSz];
+            float s2_out[bufSz];
+        	float s3_out[bufSz];
+        	float s4_out[bufSz];
+        	float silence[bufSz];
         	float *data_ptrs[12] = {silence, silence, silence, silence, silence, silence, silence, silence, silence, silence, silence, silence};
 
             bool abd_trig_prev {false};
@@ -113,22 +113,17 @@ void ctagSoundProcessorDust::Process(const ProcessData &data) {
 
 void ctagSoundProcessorDust::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("bipolar", [&](const int val) { bipolar = val; });
-    pMapTrig.emplace("bipolar", [&](const int val) { trig_bipolar = val; });
-    pMapPar.emplace("rate", [&](const int val) { rate = val; });
-    pMapCv.emplace("rate", [&](const int val) { cv_rate = val; });
-    pMapPar.emplace("level", [&](const int val) { level = val; });
-    pMapCv.emplace("level", [&](const int val) { cv_level = val; });
-    pMapPar.emplace("width", [&](const int val) { width = val; });
-    pMapCv.emplace("width", [&](const int val) { cv_width = val; });
-    pMapPar.emplace("smooth", [&](const int val) { smooth = val; });
-    pMapCv.emplace("smooth", [&](const int val) { cv_smooth = val; });
-    pMapPar.emplace("bp_enable", [&](const int val) { bp_enable = val; });
-    pMapTrig.emplace("bp_enable", [&](const int val) { trig_bp_enable = val; });
-    pMapPar.emplace("bp_fcut", [&](const int val) { bp_fcut = val; });
-    pMapCv.emplace("bp_fcut", [&](const int val) { cv_bp_fcut = val; });
-    pMapPar.emplace("bp_q", [&](const int val) { bp_q = val; });
-    pMapCv.emplace("bp_q", [&](const int val) { cv_bp_q = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorDust, bipolar),
+        MK_PARAM_INT(ctagSoundProcessorDust, rate),
+        MK_PARAM_INT(ctagSoundProcessorDust, level),
+        MK_PARAM_INT(ctagSoundProcessorDust, width),
+        MK_PARAM_INT(ctagSoundProcessorDust, smooth),
+        MK_PARAM_BOOL(ctagSoundProcessorDust, bp_enable),
+        MK_PARAM_INT(ctagSoundProcessorDust, bp_fcut),
+        MK_PARAM_INT(ctagSoundProcessorDust, bp_q),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "Dust";
     // sectionCpp0
@@ -78,20 +78,16 @@ ctagSoundProcessorEChorus::~ctagSoundProcessorEChorus() {
 void ctagSoundProcessorEChorus::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("bypass", [&](const int val) { bypass = val; });
-    pMapTrig.emplace("bypass", [&](const int val) { trig_bypass = val; });
-    pMapPar.emplace("pdepth", [&](const int val) { pdepth = val; });
-    pMapCv.emplace("pdepth", [&](const int val) { cv_pdepth = val; });
-    pMapPar.emplace("stages", [&](const int val) { stages = val; });
-    pMapCv.emplace("stages", [&](const int val) { cv_stages = val; });
-    pMapPar.emplace("prate", [&](const int val) { prate = val; });
-    pMapCv.emplace("prate", [&](const int val) { cv_prate = val; });
-    pMapPar.emplace("pwidth", [&](const int val) { pwidth = val; });
-    pMapCv.emplace("pwidth", [&](const int val) { cv_pwidth = val; });
-    pMapPar.emplace("pwet", [&](const int val) { pwet = val; });
-    pMapCv.emplace("pwet", [&](const int val) { cv_pwet = val; });
-    pMapPar.emplace("mono", [&](const int val) { mono = val; });
-    pMapTrig.emplace("mono", [&](const int val) { trig_mono = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorEChorus, bypass),
+        MK_PARAM_INT(ctagSoundProcessorEChorus, pdepth),
+        MK_PARAM_INT(ctagSoundProcessorEChorus, stages),
+        MK_PARAM_INT(ctagSoundProcessorEChorus, prate),
+        MK_PARAM_INT(ctagSoundProcessorEChorus, pwidth),
+        MK_PARAM_INT(ctagSoundProcessorEChorus, pwet),
+        MK_PARAM_BOOL(ctagSoundProcessorEChorus, mono),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "EChorus";
     // sectionCpp0
@@ -75,16 +75,14 @@ ctagSoundProcessorEveryTrim::~ctagSoundProcessorEveryTrim() {
 void ctagSoundProcessorEveryTrim::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("left", [&](const int val){ left = val;});
-	pMapCv.emplace("left", [&](const int val){ cv_left = val;});
-	pMapPar.emplace("right", [&](const int val){ right = val;});
-	pMapCv.emplace("right", [&](const int val){ cv_right = val;});
-	pMapPar.emplace("mid", [&](const int val){ mid = val;});
-	pMapCv.emplace("mid", [&](const int val){ cv_mid = val;});
-	pMapPar.emplace("side", [&](const int val){ side = val;});
-	pMapCv.emplace("side", [&](const int val){ cv_side = val;});
-	pMapPar.emplace("master", [&](const int val){ master = val;});
-	pMapCv.emplace("master", [&](const int val){ cv_master = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorEveryTrim, left),
+		MK_PARAM_INT(ctagSoundProcessorEveryTrim, right),
+		MK_PARAM_INT(ctagSoundProcessorEveryTrim, mid),
+		MK_PARAM_INT(ctagSoundProcessorEveryTrim, side),
+		MK_PARAM_INT(ctagSoundProcessorEveryTrim, master),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "EveryTrim";
 	// sectionCpp0
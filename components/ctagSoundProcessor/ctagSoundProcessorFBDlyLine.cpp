@@ -57,7 +57,7 @@ void ctagSoundProcessorFBDlyLine::Process(const ProcessData &data) {
     dlyLine.SetDryWet(fDryWet);
     dlyLine.SetLength((uint32_t) fLength);
     dlyLine.SetFeedback(fb);
-    dlyLine.Process(data.buf, this->processCh, 2, 32 * 2);
+    dlyLine.Process(data.buf, this->processCh, 2, bufSz * 2);
 
     fLevel = (float) level / 4095.f;
     if (cv_level != -1) {
@@ -73,16 +73,14 @@ void ctagSoundProcessorFBDlyLine::Process(const ProcessData &data) {
 
 void ctagSoundProcessorFBDlyLine::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("length", [&](const int val) { length = val; });
-    pMapCv.emplace("length", [&](const int val) { cv_length = val; });
-    pMapPar.emplace("feedback", [&](const int val) { feedback = val; });
-    pMapCv.emplace("feedback", [&](const int val) { cv_feedback = val; });
-    pMapPar.emplace("drywet", [&](const int val) { drywet = val; });
-    pMapCv.emplace("drywet", [&](const int val) { cv_drywet = val; });
-    pMapPar.emplace("level", [&](const int val) { level = val; });
-    pMapCv.emplace("level", [&](const int val) { cv_level = val; });
-    pMapPar.emplace("enable", [&](const int val) { enable = val; });
-    pMapTrig.emplace("enable", [&](const int val) { trig_enable = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorFBDlyLine, length),
+        MK_PARAM_INT(ctagSoundProcessorFBDlyLine, feedback),
+        MK_PARAM_INT(ctagSoundProcessorFBDlyLine, drywet),
+        MK_PARAM_INT(ctagSoundProcessorFBDlyLine, level),
+        MK_PARAM_BOOL(ctagSoundProcessorFBDlyLine, enable),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "FBDlyLine";
     // sectionCpp0
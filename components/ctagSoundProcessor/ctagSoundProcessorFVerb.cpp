@@ -66,20 +66,16 @@ void ctagSoundProcessorFVerb::Process(const ProcessData &data) {
 
 void ctagSoundProcessorFVerb::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("roomsize", [&](const int val) { roomsize = val; });
-    pMapCv.emplace("roomsize", [&](const int val) { cv_roomsize = val; });
-    pMapPar.emplace("damp", [&](const int val) { damp = val; });
-    pMapCv.emplace("damp", [&](const int val) { cv_damp = val; });
-    pMapPar.emplace("dry", [&](const int val) { dry = val; });
-    pMapCv.emplace("dry", [&](const int val) { cv_dry = val; });
-    pMapPar.emplace("wet", [&](const int val) { wet = val; });
-    pMapCv.emplace("wet", [&](const int val) { cv_wet = val; });
-    pMapPar.emplace("width", [&](const int val) { width = val; });
-    pMapCv.emplace("width", [&](const int val) { cv_width = val; });
-    pMapPar.emplace("mode", [&](const int val) { mode = val; });
-    pMapTrig.emplace("mode", [&](const int val) { trig_mode = val; });
-    pMapPar.emplace("mono", [&](const int val) { mono = val; });
-    pMapTrig.emplace("mono", [&](const int val) { trig_mono = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorFVerb, roomsize),
+        MK_PARAM_INT(ctagSoundProcessorFVerb, damp),
+        MK_PARAM_INT(ctagSoundProcessorFVerb, dry),
+        MK_PARAM_INT(ctagSoundProcessorFVerb, wet),
+        MK_PARAM_INT(ctagSoundProcessorFVerb, width),
+        MK_PARAM_BOOL(ctagSoundProcessorFVerb, mode),
+        MK_PARAM_BOOL(ctagSoundProcessorFVerb, mono),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "FVerb";
     // sectionCpp0
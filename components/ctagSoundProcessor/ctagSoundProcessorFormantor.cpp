@@ -551,106 +551,59 @@ void ctagSoundProcessorFormantor::knowYourself()
 {
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("Gate", [&](const int val){ Gate = val;});
-	pMapTrig.emplace("Gate", [&](const int val){ trig_Gate = val;});
-	pMapPar.emplace("MasterPitch", [&](const int val){ MasterPitch = val;});
-	pMapCv.emplace("MasterPitch", [&](const int val){ cv_MasterPitch = val;});
-	pMapPar.emplace("MasterTune", [&](const int val){ MasterTune = val;});
-	pMapCv.emplace("MasterTune", [&](const int val){ cv_MasterTune = val;});
-	pMapPar.emplace("QuantizePitch", [&](const int val){ QuantizePitch = val;});
-	pMapTrig.emplace("QuantizePitch", [&](const int val){ trig_QuantizePitch = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("VoicesDirectOut", [&](const int val){ VoicesDirectOut = val;});
-	pMapTrig.emplace("VoicesDirectOut", [&](const int val){ trig_VoicesDirectOut = val;});
-	pMapPar.emplace("PDPitch", [&](const int val){ PDPitch = val;});
-	pMapCv.emplace("PDPitch", [&](const int val){ cv_PDPitch = val;});
-	pMapPar.emplace("PDTune", [&](const int val){ PDTune = val;});
-	pMapCv.emplace("PDTune", [&](const int val){ cv_PDTune = val;});
-	pMapPar.emplace("PDpitchMod", [&](const int val){ PDpitchMod = val;});
-	pMapCv.emplace("PDpitchMod", [&](const int val){ cv_PDpitchMod = val;});
-	pMapPar.emplace("PDamount", [&](const int val){ PDamount = val;});
-	pMapCv.emplace("PDamount", [&](const int val){ cv_PDamount = val;});
-	pMapPar.emplace("WaveFolder", [&](const int val){ WaveFolder = val;});
-	pMapCv.emplace("WaveFolder", [&](const int val){ cv_WaveFolder = val;});
-	pMapPar.emplace("SQWPitch", [&](const int val){ SQWPitch = val;});
-	pMapCv.emplace("SQWPitch", [&](const int val){ cv_SQWPitch = val;});
-	pMapPar.emplace("SQWTune", [&](const int val){ SQWTune = val;});
-	pMapCv.emplace("SQWTune", [&](const int val){ cv_SQWTune = val;});
-	pMapPar.emplace("PWMspeed", [&](const int val){ PWMspeed = val;});
-	pMapCv.emplace("PWMspeed", [&](const int val){ cv_PWMspeed = val;});
-	pMapPar.emplace("PWMintensity", [&](const int val){ PWMintensity = val;});
-	pMapCv.emplace("PWMintensity", [&](const int val){ cv_PWMintensity = val;});
-	pMapPar.emplace("AMon", [&](const int val){ AMon = val;});
-	pMapTrig.emplace("AMon", [&](const int val){ trig_AMon = val;});
-	pMapPar.emplace("PDaMod", [&](const int val){ PDaMod = val;});
-	pMapCv.emplace("PDaMod", [&](const int val){ cv_PDaMod = val;});
-	pMapPar.emplace("SQWaMod", [&](const int val){ SQWaMod = val;});
-	pMapCv.emplace("SQWaMod", [&](const int val){ cv_SQWaMod = val;});
-	pMapPar.emplace("PDvol", [&](const int val){ PDvol = val;});
-	pMapCv.emplace("PDvol", [&](const int val){ cv_PDvol = val;});
-	pMapPar.emplace("SQWvol", [&](const int val){ SQWvol = val;});
-	pMapCv.emplace("SQWvol", [&](const int val){ cv_SQWvol = val;});
-	pMapPar.emplace("FormantFilterOn", [&](const int val){ FormantFilterOn = val;});
-	pMapTrig.emplace("FormantFilterOn", [&](const int val){ trig_FormantFilterOn = val;});
-	pMapPar.emplace("KeyLogic", [&](const int val){ KeyLogic = val;});
-	pMapTrig.emplace("KeyLogic", [&](const int val){ trig_KeyLogic = val;});
-	pMapPar.emplace("FormantSelect", [&](const int val){ FormantSelect = val;});
-	pMapCv.emplace("FormantSelect", [&](const int val){ cv_FormantSelect = val;});
-	pMapPar.emplace("FormantRndNew", [&](const int val){ FormantRndNew = val;});
-	pMapTrig.emplace("FormantRndNew", [&](const int val){ trig_FormantRndNew = val;});
-	pMapPar.emplace("FormantAmount", [&](const int val){ FormantAmount = val;});
-	pMapCv.emplace("FormantAmount", [&](const int val){ cv_FormantAmount = val;});
-	pMapPar.emplace("ResCombOn", [&](const int val){ ResCombOn = val;});
-	pMapTrig.emplace("ResCombOn", [&](const int val){ trig_ResCombOn = val;});
-	pMapPar.emplace("ResFreq", [&](const int val){ ResFreq = val;});
-	pMapCv.emplace("ResFreq", [&](const int val){ cv_ResFreq = val;});
-	pMapPar.emplace("ResTone", [&](const int val){ ResTone = val;});
-	pMapCv.emplace("ResTone", [&](const int val){ cv_ResTone = val;});
-	pMapPar.emplace("ResQ", [&](const int val){ ResQ = val;});
-	pMapCv.emplace("ResQ", [&](const int val){ cv_ResQ = val;});
-	pMapPar.emplace("ResAmount", [&](const int val){ ResAmount = val;});
-	pMapCv.emplace("ResAmount", [&](const int val){ cv_ResAmount = val;});
-	pMapPar.emplace("TremoloActive", [&](const int val){ TremoloActive = val;});
-	pMapTrig.emplace("TremoloActive", [&](const int val){ trig_TremoloActive = val;});
-	pMapPar.emplace("TremoloGateTrigger", [&](const int val){ TremoloGateTrigger = val;});
-	pMapTrig.emplace("TremoloGateTrigger", [&](const int val){ trig_TremoloGateTrigger = val;});
-	pMapPar.emplace("TremoloAttack", [&](const int val){ TremoloAttack = val;});
-	pMapCv.emplace("TremoloAttack", [&](const int val){ cv_TremoloAttack = val;});
-	pMapPar.emplace("TremoloRelease", [&](const int val){ TremoloRelease = val;});
-	pMapCv.emplace("TremoloRelease", [&](const int val){ cv_TremoloRelease = val;});
-	pMapPar.emplace("TremoloIsSQW", [&](const int val){ TremoloIsSQW = val;});
-	pMapTrig.emplace("TremoloIsSQW", [&](const int val){ trig_TremoloIsSQW = val;});
-	pMapPar.emplace("TremoloSpeed", [&](const int val){ TremoloSpeed = val;});
-	pMapCv.emplace("TremoloSpeed", [&](const int val){ cv_TremoloSpeed = val;});
-	pMapPar.emplace("TremoloAmount", [&](const int val){ TremoloAmount = val;});
-	pMapCv.emplace("TremoloAmount", [&](const int val){ cv_TremoloAmount = val;});
-	pMapPar.emplace("TremoloAfterResonator", [&](const int val){ TremoloAfterResonator = val;});
-	pMapTrig.emplace("TremoloAfterResonator", [&](const int val){ trig_TremoloAfterResonator = val;});
-	pMapPar.emplace("TremoloPDisSQW", [&](const int val){ TremoloPDisSQW = val;});
-	pMapTrig.emplace("TremoloPDisSQW", [&](const int val){ trig_TremoloPDisSQW = val;});
-	pMapPar.emplace("TremoloPDAmount", [&](const int val){ TremoloPDAmount = val;});
-	pMapCv.emplace("TremoloPDAmount", [&](const int val){ cv_TremoloPDAmount = val;});
-	pMapPar.emplace("TremoloResAmount", [&](const int val){ TremoloResAmount = val;});
-	pMapCv.emplace("TremoloResAmount", [&](const int val){ cv_TremoloResAmount = val;});
-	pMapPar.emplace("TremoloSnHpd", [&](const int val){ TremoloSnHpd = val;});
-	pMapCv.emplace("TremoloSnHpd", [&](const int val){ cv_TremoloSnHpd = val;});
-	pMapPar.emplace("EGvolActive", [&](const int val){ EGvolActive = val;});
-	pMapTrig.emplace("EGvolActive", [&](const int val){ trig_EGvolActive = val;});
-	pMapPar.emplace("Attack", [&](const int val){ Attack = val;});
-	pMapCv.emplace("Attack", [&](const int val){ cv_Attack = val;});
-	pMapPar.emplace("Decay", [&](const int val){ Decay = val;});
-	pMapCv.emplace("Decay", [&](const int val){ cv_Decay = val;});
-	pMapPar.emplace("ADSRon", [&](const int val){ ADSRon = val;});
-	pMapTrig.emplace("ADSRon", [&](const int val){ trig_ADSRon = val;});
-	pMapPar.emplace("Sustain", [&](const int val){ Sustain = val;});
-	pMapCv.emplace("Sustain", [&](const int val){ cv_Sustain = val;});
-	pMapPar.emplace("Release", [&](const int val){ Release = val;});
-	pMapCv.emplace("Release", [&](const int val){ cv_Release = val;});
-	pMapPar.emplace("EGvolSlow", [&](const int val){ EGvolSlow = val;});
-	pMapTrig.emplace("EGvolSlow", [&](const int val){ trig_EGvolSlow = val;});
-	pMapPar.emplace("EnvPDamount", [&](const int val){ EnvPDamount = val;});
-	pMapCv.emplace("EnvPDamount", [&](const int val){ cv_EnvPDamount = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, Gate),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, MasterPitch),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, MasterTune),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, QuantizePitch),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, Volume),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, VoicesDirectOut),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDPitch),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDTune),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDpitchMod),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDamount),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, WaveFolder),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, SQWPitch),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, SQWTune),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PWMspeed),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PWMintensity),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, AMon),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDaMod),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, SQWaMod),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, PDvol),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, SQWvol),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, FormantFilterOn),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, KeyLogic),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, FormantSelect),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, FormantRndNew),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, FormantAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, ResCombOn),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, ResFreq),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, ResTone),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, ResQ),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, ResAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, TremoloActive),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, TremoloGateTrigger),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloAttack),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloRelease),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, TremoloIsSQW),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloSpeed),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, TremoloAfterResonator),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, TremoloPDisSQW),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloPDAmount),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloResAmount),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, TremoloSnHpd),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, EGvolActive),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, Attack),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, Decay),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, ADSRon),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, Sustain),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, Release),
+		MK_PARAM_BOOL(ctagSoundProcessorFormantor, EGvolSlow),
+		MK_PARAM_INT(ctagSoundProcessorFormantor, EnvPDamount),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "Formantor";
 	// sectionCpp0
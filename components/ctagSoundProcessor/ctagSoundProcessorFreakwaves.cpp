@@ -714,9 +714,9 @@ void ctagSoundProcessorFreakwaves::Process(const ProcessData &data) {
     dlyLine.SetFeedback(f_DelayFeedback);
 
     // === Main DSP output loop[s] ===
-    float wave_osc_buf[32] = {0.f}; // Beware: for Plaits Wavetable rendering the buffer must be "empty"!
-    float wave_osc_buf_c[32] = {0.f}; // Seperate output for OSC C is selected via GUI
-    float delay_buf[32] = {0.f};    // Delaybuffer
+    float wave_osc_buf[bufSz] = {0.f}; // Beware: for Plaits Wavetable rendering the buffer must be "empty"!
+    float wave_osc_buf_c[bufSz] = {0.f}; // Seperate output for OSC C is selected via GUI
+    float delay_buf[bufSz] = {0.f};    // Delaybuffer
 
     // --- Process oscillators and apply MGs and EGs to them if required ---
     if (isWaveTableGood_A)
@@ -739,12 +739,12 @@ void ctagSoundProcessorFreakwaves::Process(const ProcessData &data) {
 
     // --- Additional data and processing for resonator ---
     f_ResonatorFreq /= 44100.f;
-    float reso_buf[32]{0};
+    float reso_buf[bufSz]{0};
     if (t_AddDelayAfterResonator) {
         float external_signal_wet = 0.f;
         float oscillators_signal = 0.f;
         // --- Output oscillators with delay, processed by resonator now! ---
-        for (uint32_t i = 0; i < 32; i++) {
+        for (uint32_t i = 0; i < bufSz; i++) {
             external_signal_wet = data.buf[i * 2] * f_ExternalWet;
             oscillators_signal = wave_osc_buf[i];
             reso_buf[i] = Fold_do(oscillators_signal + external_signal_wet, f_WaveShaperDryWet);
@@ -753,7 +753,7 @@ void ctagSoundProcessorFreakwaves::Process(const ProcessData &data) {
         }
         resonator.Process(f_ResonatorFreq, f_ResonatorStructure, f_ResonatorBrightness, f_ResonatorDamping, reso_buf,
                           reso_buf, bufSz);
-        for (uint32_t i = 0; i < 32; i++)
+        for (uint32_t i = 0; i < bufSz; i++)
             wave_osc_buf[i] = wave_osc_buf[i] + reso_buf[i] *
                                                 resonator_wet;   // Apply Resonator now and let original signal through partly if activated
 
@@ -899,246 +899,129 @@ ctagSoundProcessorFreakwaves::~ctagSoundProcessorFreakwaves() {
 void ctagSoundProcessorFreakwaves::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("GateA", [&](const int val) { GateA = val; });
-    pMapTrig.emplace("GateA", [&](const int val) { trig_GateA = val; });
-    pMapPar.emplace("GateB", [&](const int val) { GateB = val; });
-    pMapTrig.emplace("GateB", [&](const int val) { trig_GateB = val; });
-    pMapPar.emplace("MasterPitch", [&](const int val) { MasterPitch = val; });
-    pMapCv.emplace("MasterPitch", [&](const int val) { cv_MasterPitch = val; });
-    pMapPar.emplace("MasterTune", [&](const int val) { MasterTune = val; });
-    pMapCv.emplace("MasterTune", [&](const int val) { cv_MasterTune = val; });
-    pMapPar.emplace("CoutOnRightCh", [&](const int val) { CoutOnRightCh = val; });
-    pMapTrig.emplace("CoutOnRightCh", [&](const int val) { trig_CoutOnRightCh = val; });
-    pMapPar.emplace("QuantInputA", [&](const int val) { QuantInputA = val; });
-    pMapTrig.emplace("QuantInputA", [&](const int val) { trig_QuantInputA = val; });
-    pMapPar.emplace("Qscale_A", [&](const int val) { Qscale_A = val; });
-    pMapCv.emplace("Qscale_A", [&](const int val) { cv_Qscale_A = val; });
-    pMapPar.emplace("QuantInputB", [&](const int val) { QuantInputB = val; });
-    pMapTrig.emplace("QuantInputB", [&](const int val) { trig_QuantInputB = val; });
-    pMapPar.emplace("Qscale_B", [&](const int val) { Qscale_B = val; });
-    pMapCv.emplace("Qscale_B", [&](const int val) { cv_Qscale_B = val; });
-    pMapPar.emplace("Qscale_C", [&](const int val) { Qscale_C = val; });
-    pMapCv.emplace("Qscale_C", [&](const int val) { cv_Qscale_C = val; });
-    pMapPar.emplace("PortaA", [&](const int val) { PortaA = val; });
-    pMapTrig.emplace("PortaA", [&](const int val) { trig_PortaA = val; });
-    pMapPar.emplace("PortamentoTimeA", [&](const int val) { PortamentoTimeA = val; });
-    pMapCv.emplace("PortamentoTimeA", [&](const int val) { cv_PortamentoTimeA = val; });
-    pMapPar.emplace("PortaB", [&](const int val) { PortaB = val; });
-    pMapTrig.emplace("PortaB", [&](const int val) { trig_PortaB = val; });
-    pMapPar.emplace("PortamentoTimeB", [&](const int val) { PortamentoTimeB = val; });
-    pMapCv.emplace("PortamentoTimeB", [&](const int val) { cv_PortamentoTimeB = val; });
-    pMapPar.emplace("PortaC", [&](const int val) { PortaC = val; });
-    pMapTrig.emplace("PortaC", [&](const int val) { trig_PortaC = val; });
-    pMapPar.emplace("PortamentoTimeC", [&](const int val) { PortamentoTimeC = val; });
-    pMapCv.emplace("PortamentoTimeC", [&](const int val) { cv_PortamentoTimeC = val; });
-    pMapPar.emplace("Vol_A", [&](const int val) { Vol_A = val; });
-    pMapCv.emplace("Vol_A", [&](const int val) { cv_Vol_A = val; });
-    pMapPar.emplace("Vol_B", [&](const int val) { Vol_B = val; });
-    pMapCv.emplace("Vol_B", [&](const int val) { cv_Vol_B = val; });
-    pMapPar.emplace("Vol_C", [&](const int val) { Vol_C = val; });
-    pMapCv.emplace("Vol_C", [&](const int val) { cv_Vol_C = val; });
-    pMapPar.emplace("Vol_Ext", [&](const int val) { Vol_Ext = val; });
-    pMapCv.emplace("Vol_Ext", [&](const int val) { cv_Vol_Ext = val; });
-    pMapPar.emplace("ExternalWet", [&](const int val) { ExternalWet = val; });
-    pMapCv.emplace("ExternalWet", [&](const int val) { cv_ExternalWet = val; });
-    pMapPar.emplace("BalanceAB_C", [&](const int val) { BalanceAB_C = val; });
-    pMapCv.emplace("BalanceAB_C", [&](const int val) { cv_BalanceAB_C = val; });
-    pMapPar.emplace("Volume", [&](const int val) { Volume = val; });
-    pMapCv.emplace("Volume", [&](const int val) { cv_Volume = val; });
-    pMapPar.emplace("WaveTblA", [&](const int val) { WaveTblA = val; });
-    pMapCv.emplace("WaveTblA", [&](const int val) { cv_WaveTblA = val; });
-    pMapPar.emplace("ScanWavTblA", [&](const int val) { ScanWavTblA = val; });
-    pMapCv.emplace("ScanWavTblA", [&](const int val) { cv_ScanWavTblA = val; });
-    pMapPar.emplace("pitch_A", [&](const int val) { pitch_A = val; });
-    pMapCv.emplace("pitch_A", [&](const int val) { cv_pitch_A = val; });
-    pMapPar.emplace("tune_A", [&](const int val) { tune_A = val; });
-    pMapCv.emplace("tune_A", [&](const int val) { cv_tune_A = val; });
-    pMapPar.emplace("WaveTblB", [&](const int val) { WaveTblB = val; });
-    pMapCv.emplace("WaveTblB", [&](const int val) { cv_WaveTblB = val; });
-    pMapPar.emplace("ScanWavTblB", [&](const int val) { ScanWavTblB = val; });
-    pMapCv.emplace("ScanWavTblB", [&](const int val) { cv_ScanWavTblB = val; });
-    pMapPar.emplace("pitch_B", [&](const int val) { pitch_B = val; });
-    pMapCv.emplace("pitch_B", [&](const int val) { cv_pitch_B = val; });
-    pMapPar.emplace("tune_B", [&](const int val) { tune_B = val; });
-    pMapCv.emplace("tune_B", [&](const int val) { cv_tune_B = val; });
-    pMapPar.emplace("WaveTblC", [&](const int val) { WaveTblC = val; });
-    pMapCv.emplace("WaveTblC", [&](const int val) { cv_WaveTblC = val; });
-    pMapPar.emplace("ScanWavTblC", [&](const int val) { ScanWavTblC = val; });
-    pMapCv.emplace("ScanWavTblC", [&](const int val) { cv_ScanWavTblC = val; });
-    pMapPar.emplace("relative_tune_C", [&](const int val) { relative_tune_C = val; });
-    pMapCv.emplace("relative_tune_C", [&](const int val) { cv_relative_tune_C = val; });
-    pMapPar.emplace("GeneratePitchC", [&](const int val) { GeneratePitchC = val; });
-    pMapTrig.emplace("GeneratePitchC", [&](const int val) { trig_GeneratePitchC = val; });
-    pMapPar.emplace("CnotAorB", [&](const int val) { CnotAorB = val; });
-    pMapTrig.emplace("CnotAorB", [&](const int val) { trig_CnotAorB = val; });
-    pMapPar.emplace("ChooseBforNot", [&](const int val) { ChooseBforNot = val; });
-    pMapTrig.emplace("ChooseBforNot", [&](const int val) { trig_ChooseBforNot = val; });
-    pMapPar.emplace("UseABGate", [&](const int val) { UseABGate = val; });
-    pMapTrig.emplace("UseABGate", [&](const int val) { trig_UseABGate = val; });
-    pMapPar.emplace("GateForCisB", [&](const int val) { GateForCisB = val; });
-    pMapTrig.emplace("GateForCisB", [&](const int val) { trig_GateForCisB = val; });
-    pMapPar.emplace("LFOspeedC", [&](const int val) { LFOspeedC = val; });
-    pMapCv.emplace("LFOspeedC", [&](const int val) { cv_LFOspeedC = val; });
-    pMapPar.emplace("LFOamountC", [&](const int val) { LFOamountC = val; });
-    pMapCv.emplace("LFOamountC", [&](const int val) { cv_LFOamountC = val; });
-    pMapPar.emplace("ExtModCisOn", [&](const int val) { ExtModCisOn = val; });
-    pMapTrig.emplace("ExtModCisOn", [&](const int val) { trig_ExtModCisOn = val; });
-    pMapPar.emplace("ExtModGain", [&](const int val) { ExtModGain = val; });
-    pMapCv.emplace("ExtModGain", [&](const int val) { cv_ExtModGain = val; });
-    pMapPar.emplace("AmountForExternalMod", [&](const int val) { AmountForExternalMod = val; });
-    pMapCv.emplace("AmountForExternalMod", [&](const int val) { cv_AmountForExternalMod = val; });
-    pMapPar.emplace("ExternalDetectToRelease", [&](const int val) { ExternalDetectToRelease = val; });
-    pMapTrig.emplace("ExternalDetectToRelease", [&](const int val) { trig_ExternalDetectToRelease = val; });
-    pMapPar.emplace("AccentModCisOn", [&](const int val) { AccentModCisOn = val; });
-    pMapTrig.emplace("AccentModCisOn", [&](const int val) { trig_AccentModCisOn = val; });
-    pMapPar.emplace("DetectAccentLevel", [&](const int val) { DetectAccentLevel = val; });
-    pMapCv.emplace("DetectAccentLevel", [&](const int val) { cv_DetectAccentLevel = val; });
-    pMapPar.emplace("AmountForAccentMod", [&](const int val) { AmountForAccentMod = val; });
-    pMapCv.emplace("AmountForAccentMod", [&](const int val) { cv_AmountForAccentMod = val; });
-    pMapPar.emplace("AccentToScanC", [&](const int val) { AccentToScanC = val; });
-    pMapTrig.emplace("AccentToScanC", [&](const int val) { trig_AccentToScanC = val; });
-    pMapPar.emplace("KeytrackModCisOn", [&](const int val) { KeytrackModCisOn = val; });
-    pMapTrig.emplace("KeytrackModCisOn", [&](const int val) { trig_KeytrackModCisOn = val; });
-    pMapPar.emplace("KeytrackingLevel", [&](const int val) { KeytrackingLevel = val; });
-    pMapCv.emplace("KeytrackingLevel", [&](const int val) { cv_KeytrackingLevel = val; });
-    pMapPar.emplace("KeytrackSlew", [&](const int val) { KeytrackSlew = val; });
-    pMapTrig.emplace("KeytrackSlew", [&](const int val) { trig_KeytrackSlew = val; });
-    pMapPar.emplace("KeytrackingToEcho", [&](const int val) { KeytrackingToEcho = val; });
-    pMapTrig.emplace("KeytrackingToEcho", [&](const int val) { trig_KeytrackingToEcho = val; });
-    pMapPar.emplace("EGvolActive_A", [&](const int val) { EGvolActive_A = val; });
-    pMapTrig.emplace("EGvolActive_A", [&](const int val) { trig_EGvolActive_A = val; });
-    pMapPar.emplace("EGvolSlow_A", [&](const int val) { EGvolSlow_A = val; });
-    pMapTrig.emplace("EGvolSlow_A", [&](const int val) { trig_EGvolSlow_A = val; });
-    pMapPar.emplace("AttackVol_A", [&](const int val) { AttackVol_A = val; });
-    pMapCv.emplace("AttackVol_A", [&](const int val) { cv_AttackVol_A = val; });
-    pMapPar.emplace("DecayVol_A", [&](const int val) { DecayVol_A = val; });
-    pMapCv.emplace("DecayVol_A", [&](const int val) { cv_DecayVol_A = val; });
-    pMapPar.emplace("SustainVol_A", [&](const int val) { SustainVol_A = val; });
-    pMapCv.emplace("SustainVol_A", [&](const int val) { cv_SustainVol_A = val; });
-    pMapPar.emplace("ReleaseVol_A", [&](const int val) { ReleaseVol_A = val; });
-    pMapCv.emplace("ReleaseVol_A", [&](const int val) { cv_ReleaseVol_A = val; });
-    pMapPar.emplace("EGvolActive_B", [&](const int val) { EGvolActive_B = val; });
-    pMapTrig.emplace("EGvolActive_B", [&](const int val) { trig_EGvolActive_B = val; });
-    pMapPar.emplace("EGvolSlow_B", [&](const int val) { EGvolSlow_B = val; });
-    pMapTrig.emplace("EGvolSlow_B", [&](const int val) { trig_EGvolSlow_B = val; });
-    pMapPar.emplace("AttackVol_B", [&](const int val) { AttackVol_B = val; });
-    pMapCv.emplace("AttackVol_B", [&](const int val) { cv_AttackVol_B = val; });
-    pMapPar.emplace("DecayVol_B", [&](const int val) { DecayVol_B = val; });
-    pMapCv.emplace("DecayVol_B", [&](const int val) { cv_DecayVol_B = val; });
-    pMapPar.emplace("SustainVol_B", [&](const int val) { SustainVol_B = val; });
-    pMapCv.emplace("SustainVol_B", [&](const int val) { cv_SustainVol_B = val; });
-    pMapPar.emplace("ReleaseVol_B", [&](const int val) { ReleaseVol_B = val; });
-    pMapCv.emplace("ReleaseVol_B", [&](const int val) { cv_ReleaseVol_B = val; });
-    pMapPar.emplace("EGvolActive_C", [&](const int val) { EGvolActive_C = val; });
-    pMapTrig.emplace("EGvolActive_C", [&](const int val) { trig_EGvolActive_C = val; });
-    pMapPar.emplace("EGvolSlow_C", [&](const int val) { EGvolSlow_C = val; });
-    pMapTrig.emplace("EGvolSlow_C", [&](const int val) { trig_EGvolSlow_C = val; });
-    pMapPar.emplace("AttackVol_C", [&](const int val) { AttackVol_C = val; });
-    pMapCv.emplace("AttackVol_C", [&](const int val) { cv_AttackVol_C = val; });
-    pMapPar.emplace("DecayVol_C", [&](const int val) { DecayVol_C = val; });
-    pMapCv.emplace("DecayVol_C", [&](const int val) { cv_DecayVol_C = val; });
-    pMapPar.emplace("SustainVol_C", [&](const int val) { SustainVol_C = val; });
-    pMapCv.emplace("SustainVol_C", [&](const int val) { cv_SustainVol_C = val; });
-    pMapPar.emplace("ReleaseVol_C", [&](const int val) { ReleaseVol_C = val; });
-    pMapCv.emplace("ReleaseVol_C", [&](const int val) { cv_ReleaseVol_C = val; });
-    pMapPar.emplace("DelayEnable", [&](const int val) { DelayEnable = val; });
-    pMapTrig.emplace("DelayEnable", [&](const int val) { trig_DelayEnable = val; });
-    pMapPar.emplace("AddDelayAfterResonator", [&](const int val) { AddDelayAfterResonator = val; });
-    pMapTrig.emplace("AddDelayAfterResonator", [&](const int val) { trig_AddDelayAfterResonator = val; });
-    pMapPar.emplace("DelayDryWet", [&](const int val) { DelayDryWet = val; });
-    pMapCv.emplace("DelayDryWet", [&](const int val) { cv_DelayDryWet = val; });
-    pMapPar.emplace("DelayTimeShortened", [&](const int val) { DelayTimeShortened = val; });
-    pMapTrig.emplace("DelayTimeShortened", [&](const int val) { trig_DelayTimeShortened = val; });
-    pMapPar.emplace("DelayTime", [&](const int val) { DelayTime = val; });
-    pMapCv.emplace("DelayTime", [&](const int val) { cv_DelayTime = val; });
-    pMapPar.emplace("DelayFeedback", [&](const int val) { DelayFeedback = val; });
-    pMapCv.emplace("DelayFeedback", [&](const int val) { cv_DelayFeedback = val; });
-    pMapPar.emplace("ResonatorOn", [&](const int val) { ResonatorOn = val; });
-    pMapTrig.emplace("ResonatorOn", [&](const int val) { trig_ResonatorOn = val; });
-    pMapPar.emplace("ResonatorDryWet", [&](const int val) { ResonatorDryWet = val; });
-    pMapCv.emplace("ResonatorDryWet", [&](const int val) { cv_ResonatorDryWet = val; });
-    pMapPar.emplace("WaveShaperDryWet", [&](const int val) { WaveShaperDryWet = val; });
-    pMapCv.emplace("WaveShaperDryWet", [&](const int val) { cv_WaveShaperDryWet = val; });
-    pMapPar.emplace("ResonatorPosition", [&](const int val) { ResonatorPosition = val; });
-    pMapCv.emplace("ResonatorPosition", [&](const int val) { cv_ResonatorPosition = val; });
-    pMapPar.emplace("ResonatorFreq", [&](const int val) { ResonatorFreq = val; });
-    pMapCv.emplace("ResonatorFreq", [&](const int val) { cv_ResonatorFreq = val; });
-    pMapPar.emplace("ResonatorStructure", [&](const int val) { ResonatorStructure = val; });
-    pMapCv.emplace("ResonatorStructure", [&](const int val) { cv_ResonatorStructure = val; });
-    pMapPar.emplace("ResonatorBrightness", [&](const int val) { ResonatorBrightness = val; });
-    pMapCv.emplace("ResonatorBrightness", [&](const int val) { cv_ResonatorBrightness = val; });
-    pMapPar.emplace("ResonatorDamping", [&](const int val) { ResonatorDamping = val; });
-    pMapCv.emplace("ResonatorDamping", [&](const int val) { cv_ResonatorDamping = val; });
-    pMapPar.emplace("lfoActive_1", [&](const int val) { lfoActive_1 = val; });
-    pMapTrig.emplace("lfoActive_1", [&](const int val) { trig_lfoActive_1 = val; });
-    pMapPar.emplace("lfoDestination_1", [&](const int val) { lfoDestination_1 = val; });
-    pMapCv.emplace("lfoDestination_1", [&](const int val) { cv_lfoDestination_1 = val; });
-    pMapPar.emplace("lfoType_1", [&](const int val) { lfoType_1 = val; });
-    pMapCv.emplace("lfoType_1", [&](const int val) { cv_lfoType_1 = val; });
-    pMapPar.emplace("lfoSpeed_1", [&](const int val) { lfoSpeed_1 = val; });
-    pMapCv.emplace("lfoSpeed_1", [&](const int val) { cv_lfoSpeed_1 = val; });
-    pMapPar.emplace("lfoAmnt_1", [&](const int val) { lfoAmnt_1 = val; });
-    pMapCv.emplace("lfoAmnt_1", [&](const int val) { cv_lfoAmnt_1 = val; });
-    pMapPar.emplace("lfoActive_2", [&](const int val) { lfoActive_2 = val; });
-    pMapTrig.emplace("lfoActive_2", [&](const int val) { trig_lfoActive_2 = val; });
-    pMapPar.emplace("lfoDestination_2", [&](const int val) { lfoDestination_2 = val; });
-    pMapCv.emplace("lfoDestination_2", [&](const int val) { cv_lfoDestination_2 = val; });
-    pMapPar.emplace("lfoType_2", [&](const int val) { lfoType_2 = val; });
-    pMapCv.emplace("lfoType_2", [&](const int val) { cv_lfoType_2 = val; });
-    pMapPar.emplace("lfoSpeed_2", [&](const int val) { lfoSpeed_2 = val; });
-    pMapCv.emplace("lfoSpeed_2", [&](const int val) { cv_lfoSpeed_2 = val; });
-    pMapPar.emplace("lfoAmnt_2", [&](const int val) { lfoAmnt_2 = val; });
-    pMapCv.emplace("lfoAmnt_2", [&](const int val) { cv_lfoAmnt_2 = val; });
-    pMapPar.emplace("lfoActive_3", [&](const int val) { lfoActive_3 = val; });
-    pMapTrig.emplace("lfoActive_3", [&](const int val) { trig_lfoActive_3 = val; });
-    pMapPar.emplace("lfoDestination_3", [&](const int val) { lfoDestination_3 = val; });
-    pMapCv.emplace("lfoDestination_3", [&](const int val) { cv_lfoDestination_3 = val; });
-    pMapPar.emplace("lfoType_3", [&](const int val) { lfoType_3 = val; });
-    pMapCv.emplace("lfoType_3", [&](const int val) { cv_lfoType_3 = val; });
-    pMapPar.emplace("lfoSpeed_3", [&](const int val) { lfoSpeed_3 = val; });
-    pMapCv.emplace("lfoSpeed_3", [&](const int val) { cv_lfoSpeed_3 = val; });
-    pMapPar.emplace("lfoAmnt_3", [&](const int val) { lfoAmnt_3 = val; });
-    pMapCv.emplace("lfoAmnt_3", [&](const int val) { cv_lfoAmnt_3 = val; });
-    pMapPar.emplace("lfoActive_4", [&](const int val) { lfoActive_4 = val; });
-    pMapTrig.emplace("lfoActive_4", [&](const int val) { trig_lfoActive_4 = val; });
-    pMapPar.emplace("lfoDestination_4", [&](const int val) { lfoDestination_4 = val; });
-    pMapCv.emplace("lfoDestination_4", [&](const int val) { cv_lfoDestination_4 = val; });
-    pMapPar.emplace("lfoType_4", [&](const int val) { lfoType_4 = val; });
-    pMapCv.emplace("lfoType_4", [&](const int val) { cv_lfoType_4 = val; });
-    pMapPar.emplace("lfoSpeed_4", [&](const int val) { lfoSpeed_4 = val; });
-    pMapCv.emplace("lfoSpeed_4", [&](const int val) { cv_lfoSpeed_4 = val; });
-    pMapPar.emplace("lfoAmnt_4", [&](const int val) { lfoAmnt_4 = val; });
-    pMapCv.emplace("lfoAmnt_4", [&](const int val) { cv_lfoAmnt_4 = val; });
-    pMapPar.emplace("lfoActive_5", [&](const int val) { lfoActive_5 = val; });
-    pMapTrig.emplace("lfoActive_5", [&](const int val) { trig_lfoActive_5 = val; });
-    pMapPar.emplace("lfoDestination_5", [&](const int val) { lfoDestination_5 = val; });
-    pMapCv.emplace("lfoDestination_5", [&](const int val) { cv_lfoDestination_5 = val; });
-    pMapPar.emplace("lfoType_5", [&](const int val) { lfoType_5 = val; });
-    pMapCv.emplace("lfoType_5", [&](const int val) { cv_lfoType_5 = val; });
-    pMapPar.emplace("lfoSpeed_5", [&](const int val) { lfoSpeed_5 = val; });
-    pMapCv.emplace("lfoSpeed_5", [&](const int val) { cv_lfoSpeed_5 = val; });
-    pMapPar.emplace("lfoAmnt_5", [&](const int val) { lfoAmnt_5 = val; });
-    pMapCv.emplace("lfoAmnt_5", [&](const int val) { cv_lfoAmnt_5 = val; });
-    pMapPar.emplace("lfoActive_6", [&](const int val) { lfoActive_6 = val; });
-    pMapTrig.emplace("lfoActive_6", [&](const int val) { trig_lfoActive_6 = val; });
-    pMapPar.emplace("lfoDestination_6", [&](const int val) { lfoDestination_6 = val; });
-    pMapCv.emplace("lfoDestination_6", [&](const int val) { cv_lfoDestination_6 = val; });
-    pMapPar.emplace("lfoType_6", [&](const int val) { lfoType_6 = val; });
-    pMapCv.emplace("lfoType_6", [&](const int val) { cv_lfoType_6 = val; });
-    pMapPar.emplace("lfoSpeed_6", [&](const int val) { lfoSpeed_6 = val; });
-    pMapCv.emplace("lfoSpeed_6", [&](const int val) { cv_lfoSpeed_6 = val; });
-    pMapPar.emplace("lfoAmnt_6", [&](const int val) { lfoAmnt_6 = val; });
-    pMapCv.emplace("lfoAmnt_6", [&](const int val) { cv_lfoAmnt_6 = val; });
-    pMapPar.emplace("lfoActive_7", [&](const int val) { lfoActive_7 = val; });
-    pMapTrig.emplace("lfoActive_7", [&](const int val) { trig_lfoActive_7 = val; });
-    pMapPar.emplace("lfoDestination_7", [&](const int val) { lfoDestination_7 = val; });
-    pMapCv.emplace("lfoDestination_7", [&](const int val) { cv_lfoDestination_7 = val; });
-    pMapPar.emplace("lfoType_7", [&](const int val) { lfoType_7 = val; });
-    pMapCv.emplace("lfoType_7", [&](const int val) { cv_lfoType_7 = val; });
-    pMapPar.emplace("lfoSpeed_7", [&](const int val) { lfoSpeed_7 = val; });
-    pMapCv.emplace("lfoSpeed_7", [&](const int val) { cv_lfoSpeed_7 = val; });
-    pMapPar.emplace("lfoAmnt_7", [&](const int val) { lfoAmnt_7 = val; });
-    pMapCv.emplace("lfoAmnt_7", [&](const int val) { cv_lfoAmnt_7 = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, GateA),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, GateB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, MasterPitch),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, MasterTune),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, CoutOnRightCh),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, QuantInputA),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Qscale_A),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, QuantInputB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Qscale_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Qscale_C),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, PortaA),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, PortamentoTimeA),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, PortaB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, PortamentoTimeB),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, PortaC),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, PortamentoTimeC),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Vol_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Vol_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Vol_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Vol_Ext),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ExternalWet),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, BalanceAB_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, Volume),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, WaveTblA),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ScanWavTblA),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, pitch_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, tune_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, WaveTblB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ScanWavTblB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, pitch_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, tune_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, WaveTblC),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ScanWavTblC),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, relative_tune_C),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, GeneratePitchC),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, CnotAorB),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, ChooseBforNot),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, UseABGate),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, GateForCisB),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, LFOspeedC),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, LFOamountC),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, ExtModCisOn),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ExtModGain),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, AmountForExternalMod),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, ExternalDetectToRelease),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, AccentModCisOn),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DetectAccentLevel),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, AmountForAccentMod),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, AccentToScanC),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, KeytrackModCisOn),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, KeytrackingLevel),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, KeytrackSlew),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, KeytrackingToEcho),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolActive_A),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolSlow_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, AttackVol_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DecayVol_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, SustainVol_A),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ReleaseVol_A),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolActive_B),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolSlow_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, AttackVol_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DecayVol_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, SustainVol_B),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ReleaseVol_B),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolActive_C),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, EGvolSlow_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, AttackVol_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DecayVol_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, SustainVol_C),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ReleaseVol_C),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, DelayEnable),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, AddDelayAfterResonator),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DelayDryWet),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, DelayTimeShortened),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DelayTime),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, DelayFeedback),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, ResonatorOn),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorDryWet),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, WaveShaperDryWet),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorPosition),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorFreq),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorStructure),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorBrightness),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, ResonatorDamping),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_1),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_1),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_1),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_1),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_1),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_2),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_2),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_2),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_2),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_2),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_3),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_3),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_3),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_3),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_3),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_4),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_4),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_4),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_4),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_4),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_5),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_5),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_5),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_5),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_5),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_6),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_6),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_6),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_6),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_6),
+        MK_PARAM_BOOL(ctagSoundProcessorFreakwaves, lfoActive_7),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoDestination_7),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoType_7),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoSpeed_7),
+        MK_PARAM_INT(ctagSoundProcessorFreakwaves, lfoAmnt_7),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "Freakwaves";
     // sectionCpp0
@@ -100,46 +100,29 @@ void ctagSoundProcessorGDVerb::Process(const ProcessData &data) {
 
 void ctagSoundProcessorGDVerb::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("revtime", [&](const int val) { revtime = val; });
-    pMapCv.emplace("revtime", [&](const int val) { cv_revtime = val; });
-    pMapPar.emplace("dccut", [&](const int val) { dccut = val; });
-    pMapCv.emplace("dccut", [&](const int val) { cv_dccut = val; });
-    pMapPar.emplace("idiffusion1", [&](const int val) { idiffusion1 = val; });
-    pMapCv.emplace("idiffusion1", [&](const int val) { cv_idiffusion1 = val; });
-    pMapPar.emplace("idiffusion2", [&](const int val) { idiffusion2 = val; });
-    pMapCv.emplace("idiffusion2", [&](const int val) { cv_idiffusion2 = val; });
-    pMapPar.emplace("diffusion1", [&](const int val) { diffusion1 = val; });
-    pMapCv.emplace("diffusion1", [&](const int val) { cv_diffusion1 = val; });
-    pMapPar.emplace("diffusion2", [&](const int val) { diffusion2 = val; });
-    pMapCv.emplace("diffusion2", [&](const int val) { cv_diffusion2 = val; });
-    pMapPar.emplace("inputdamp", [&](const int val) { inputdamp = val; });
-    pMapCv.emplace("inputdamp", [&](const int val) { cv_inputdamp = val; });
-    pMapPar.emplace("damp", [&](const int val) { damp = val; });
-    pMapCv.emplace("damp", [&](const int val) { cv_damp = val; });
-    pMapPar.emplace("outputdamp", [&](const int val) { outputdamp = val; });
-    pMapCv.emplace("outputdamp", [&](const int val) { cv_outputdamp = val; });
-    pMapPar.emplace("spin", [&](const int val) { spin = val; });
-    pMapCv.emplace("spin", [&](const int val) { cv_spin = val; });
-    pMapPar.emplace("spindiff", [&](const int val) { spindiff = val; });
-    pMapCv.emplace("spindiff", [&](const int val) { cv_spindiff = val; });
-    pMapPar.emplace("spinlimit", [&](const int val) { spinlimit = val; });
-    pMapCv.emplace("spinlimit", [&](const int val) { cv_spinlimit = val; });
-    pMapPar.emplace("wander", [&](const int val) { wander = val; });
-    pMapCv.emplace("wander", [&](const int val) { cv_wander = val; });
-    pMapPar.emplace("modnoise1", [&](const int val) { modnoise1 = val; });
-    pMapCv.emplace("modnoise1", [&](const int val) { cv_modnoise1 = val; });
-    pMapPar.emplace("modnoise2", [&](const int val) { modnoise2 = val; });
-    pMapCv.emplace("modnoise2", [&](const int val) { cv_modnoise2 = val; });
-    pMapPar.emplace("autodiff", [&](const int val) { autodiff = val; });
-    pMapTrig.emplace("autodiff", [&](const int val) { trig_autodiff = val; });
-    pMapPar.emplace("dry", [&](const int val) { dry = val; });
-    pMapCv.emplace("dry", [&](const int val) { cv_dry = val; });
-    pMapPar.emplace("wet", [&](const int val) { wet = val; });
-    pMapCv.emplace("wet", [&](const int val) { cv_wet = val; });
-    pMapPar.emplace("width", [&](const int val) { width = val; });
-    pMapCv.emplace("width", [&](const int val) { cv_width = val; });
-    pMapPar.emplace("mono", [&](const int val) { mono = val; });
-    pMapTrig.emplace("mono", [&](const int val) { trig_mono = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, revtime),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, dccut),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, idiffusion1),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, idiffusion2),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, diffusion1),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, diffusion2),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, inputdamp),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, damp),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, outputdamp),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, spin),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, spindiff),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, spinlimit),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, wander),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, modnoise1),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, modnoise2),
+        MK_PARAM_BOOL(ctagSoundProcessorGDVerb, autodiff),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, dry),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, wet),
+        MK_PARAM_INT(ctagSoundProcessorGDVerb, width),
+        MK_PARAM_BOOL(ctagSoundProcessorGDVerb, mono),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "GDVerb";
     // sectionCpp0
@@ -191,72 +191,42 @@ void ctagSoundProcessorGDVerb2::Process(const ProcessData &data) {
 
 void ctagSoundProcessorGDVerb2::knowYourself() {
     // sectionCpp0
-	pMapPar.emplace("exprtdecay", [&](const int val){ exprtdecay = val;});
-	pMapTrig.emplace("exprtdecay", [&](const int val){ trig_exprtdecay = val;});
-	pMapPar.emplace("revtime", [&](const int val){ revtime = val;});
-	pMapCv.emplace("revtime", [&](const int val){ cv_revtime = val;});
-	pMapPar.emplace("decay0", [&](const int val){ decay0 = val;});
-	pMapCv.emplace("decay0", [&](const int val){ cv_decay0 = val;});
-	pMapPar.emplace("decay1", [&](const int val){ decay1 = val;});
-	pMapCv.emplace("decay1", [&](const int val){ cv_decay1 = val;});
-	pMapPar.emplace("decay2", [&](const int val){ decay2 = val;});
-	pMapCv.emplace("decay2", [&](const int val){ cv_decay2 = val;});
-	pMapPar.emplace("decay3", [&](const int val){ decay3 = val;});
-	pMapCv.emplace("decay3", [&](const int val){ cv_decay3 = val;});
-	pMapPar.emplace("decayf", [&](const int val){ decayf = val;});
-	pMapCv.emplace("decayf", [&](const int val){ cv_decayf = val;});
-	pMapPar.emplace("exprtdiffu", [&](const int val){ exprtdiffu = val;});
-	pMapTrig.emplace("exprtdiffu", [&](const int val){ trig_exprtdiffu = val;});
-	pMapPar.emplace("diffusion1", [&](const int val){ diffusion1 = val;});
-	pMapCv.emplace("diffusion1", [&](const int val){ cv_diffusion1 = val;});
-	pMapPar.emplace("diffusion2", [&](const int val){ diffusion2 = val;});
-	pMapCv.emplace("diffusion2", [&](const int val){ cv_diffusion2 = val;});
-	pMapPar.emplace("diffusion3", [&](const int val){ diffusion3 = val;});
-	pMapCv.emplace("diffusion3", [&](const int val){ cv_diffusion3 = val;});
-	pMapPar.emplace("diffusion4", [&](const int val){ diffusion4 = val;});
-	pMapCv.emplace("diffusion4", [&](const int val){ cv_diffusion4 = val;});
-	pMapPar.emplace("exprtdamp", [&](const int val){ exprtdamp = val;});
-	pMapTrig.emplace("exprtdamp", [&](const int val){ trig_exprtdamp = val;});
-	pMapPar.emplace("dccut", [&](const int val){ dccut = val;});
-	pMapCv.emplace("dccut", [&](const int val){ cv_dccut = val;});
-	pMapPar.emplace("inputdamp", [&](const int val){ inputdamp = val;});
-	pMapCv.emplace("inputdamp", [&](const int val){ cv_inputdamp = val;});
-	pMapPar.emplace("damp", [&](const int val){ damp = val;});
-	pMapCv.emplace("damp", [&](const int val){ cv_damp = val;});
-	pMapPar.emplace("outputdamp", [&](const int val){ outputdamp = val;});
-	pMapCv.emplace("outputdamp", [&](const int val){ cv_outputdamp = val;});
-	pMapPar.emplace("outputdampbw", [&](const int val){ outputdampbw = val;});
-	pMapCv.emplace("outputdampbw", [&](const int val){ cv_outputdampbw = val;});
-	pMapPar.emplace("bassboost", [&](const int val){ bassboost = val;});
-	pMapCv.emplace("bassboost", [&](const int val){ cv_bassboost = val;});
-	pMapPar.emplace("damp2", [&](const int val){ damp2 = val;});
-	pMapCv.emplace("damp2", [&](const int val){ cv_damp2 = val;});
-	pMapPar.emplace("bassbw", [&](const int val){ bassbw = val;});
-	pMapCv.emplace("bassbw", [&](const int val){ cv_bassbw = val;});
-	pMapPar.emplace("exprtmod", [&](const int val){ exprtmod = val;});
-	pMapTrig.emplace("exprtmod", [&](const int val){ trig_exprtmod = val;});
-	pMapPar.emplace("spin", [&](const int val){ spin = val;});
-	pMapCv.emplace("spin", [&](const int val){ cv_spin = val;});
-	pMapPar.emplace("spinlimit", [&](const int val){ spinlimit = val;});
-	pMapCv.emplace("spinlimit", [&](const int val){ cv_spinlimit = val;});
-	pMapPar.emplace("wander", [&](const int val){ wander = val;});
-	pMapCv.emplace("wander", [&](const int val){ cv_wander = val;});
-	pMapPar.emplace("spin2", [&](const int val){ spin2 = val;});
-	pMapCv.emplace("spin2", [&](const int val){ cv_spin2 = val;});
-	pMapPar.emplace("spinlimit2", [&](const int val){ spinlimit2 = val;});
-	pMapCv.emplace("spinlimit2", [&](const int val){ cv_spinlimit2 = val;});
-	pMapPar.emplace("wander2", [&](const int val){ wander2 = val;});
-	pMapCv.emplace("wander2", [&](const int val){ cv_wander2 = val;});
-	pMapPar.emplace("spin2wander", [&](const int val){ spin2wander = val;});
-	pMapCv.emplace("spin2wander", [&](const int val){ cv_spin2wander = val;});
-	pMapPar.emplace("dry", [&](const int val){ dry = val;});
-	pMapCv.emplace("dry", [&](const int val){ cv_dry = val;});
-	pMapPar.emplace("wet", [&](const int val){ wet = val;});
-	pMapCv.emplace("wet", [&](const int val){ cv_wet = val;});
-	pMapPar.emplace("width", [&](const int val){ width = val;});
-	pMapCv.emplace("width", [&](const int val){ cv_width = val;});
-	pMapPar.emplace("mono", [&](const int val){ mono = val;});
-	pMapTrig.emplace("mono", [&](const int val){ trig_mono = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorGDVerb2, exprtdecay),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, revtime),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, decay0),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, decay1),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, decay2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, decay3),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, decayf),
+		MK_PARAM_BOOL(ctagSoundProcessorGDVerb2, exprtdiffu),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, diffusion1),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, diffusion2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, diffusion3),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, diffusion4),
+		MK_PARAM_BOOL(ctagSoundProcessorGDVerb2, exprtdamp),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, dccut),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, inputdamp),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, damp),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, outputdamp),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, outputdampbw),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, bassboost),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, damp2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, bassbw),
+		MK_PARAM_BOOL(ctagSoundProcessorGDVerb2, exprtmod),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, spin),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, spinlimit),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, wander),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, spin2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, spinlimit2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, wander2),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, spin2wander),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, dry),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, wet),
+		MK_PARAM_INT(ctagSoundProcessorGDVerb2, width),
+		MK_PARAM_BOOL(ctagSoundProcessorGDVerb2, mono),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "GDVerb2";
 	// sectionCpp0
@@ -84,22 +84,17 @@ ctagSoundProcessorGVerb::~ctagSoundProcessorGVerb() {
 
 void ctagSoundProcessorGVerb::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("roomsize", [&](const int val) { roomsize = val; });
-    pMapCv.emplace("roomsize", [&](const int val) { cv_roomsize = val; });
-    pMapPar.emplace("revtime", [&](const int val) { revtime = val; });
-    pMapCv.emplace("revtime", [&](const int val) { cv_revtime = val; });
-    pMapPar.emplace("damping", [&](const int val) { damping = val; });
-    pMapCv.emplace("damping", [&](const int val) { cv_damping = val; });
-    pMapPar.emplace("inputbw", [&](const int val) { inputbw = val; });
-    pMapCv.emplace("inputbw", [&](const int val) { cv_inputbw = val; });
-    pMapPar.emplace("earlylvl", [&](const int val) { earlylvl = val; });
-    pMapCv.emplace("earlylvl", [&](const int val) { cv_earlylvl = val; });
-    pMapPar.emplace("taillvl", [&](const int val) { taillvl = val; });
-    pMapCv.emplace("taillvl", [&](const int val) { cv_taillvl = val; });
-    pMapPar.emplace("drywet", [&](const int val) { drywet = val; });
-    pMapCv.emplace("drywet", [&](const int val) { cv_drywet = val; });
-    pMapPar.emplace("mono", [&](const int val) { mono = val; });
-    pMapTrig.emplace("mono", [&](const int val) { trig_mono = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorGVerb, roomsize),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, revtime),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, damping),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, inputbw),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, earlylvl),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, taillvl),
+        MK_PARAM_INT(ctagSoundProcessorGVerb, drywet),
+        MK_PARAM_BOOL(ctagSoundProcessorGVerb, mono),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "GVerb";
     // sectionCpp0
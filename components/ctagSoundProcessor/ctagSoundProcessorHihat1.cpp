@@ -140,32 +140,22 @@ void ctagSoundProcessorHihat1::Process(const ProcessData &data) {
 
 void ctagSoundProcessorHihat1::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("ntype", [&](const int val) { ntype = val; });
-    pMapTrig.emplace("ntype", [&](const int val) { trig_ntype = val; });
-    pMapPar.emplace("frequency", [&](const int val) { frequency = val; });
-    pMapCv.emplace("frequency", [&](const int val) { cv_frequency = val; });
-    pMapPar.emplace("qfac", [&](const int val) { qfac = val; });
-    pMapCv.emplace("qfac", [&](const int val) { cv_qfac = val; });
-    pMapPar.emplace("loudness", [&](const int val) { loudness = val; });
-    pMapCv.emplace("loudness", [&](const int val) { cv_loudness = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("loopEG", [&](const int val) { loopEG = val; });
-    pMapTrig.emplace("loopEG", [&](const int val) { trig_loopEG = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
-    pMapPar.emplace("enableEG_p", [&](const int val) { enableEG_p = val; });
-    pMapTrig.emplace("enableEG_p", [&](const int val) { trig_enableEG_p = val; });
-    pMapPar.emplace("loopEG_p", [&](const int val) { loopEG_p = val; });
-    pMapTrig.emplace("loopEG_p", [&](const int val) { trig_loopEG_p = val; });
-    pMapPar.emplace("amount_p", [&](const int val) { amount_p = val; });
-    pMapCv.emplace("amount_p", [&](const int val) { cv_amount_p = val; });
-    pMapPar.emplace("attack_p", [&](const int val) { attack_p = val; });
-    pMapCv.emplace("attack_p", [&](const int val) { cv_attack_p = val; });
-    pMapPar.emplace("decay_p", [&](const int val) { decay_p = val; });
-    pMapCv.emplace("decay_p", [&](const int val) { cv_decay_p = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorHihat1, ntype),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, frequency),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, qfac),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, loudness),
+        MK_PARAM_BOOL(ctagSoundProcessorHihat1, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorHihat1, loopEG),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, attack),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, decay),
+        MK_PARAM_BOOL(ctagSoundProcessorHihat1, enableEG_p),
+        MK_PARAM_BOOL(ctagSoundProcessorHihat1, loopEG_p),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, amount_p),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, attack_p),
+        MK_PARAM_INT(ctagSoundProcessorHihat1, decay_p),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "Hihat1";
     // sectionCpp0
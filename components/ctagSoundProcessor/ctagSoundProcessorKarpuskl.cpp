@@ -423,56 +423,34 @@ ctagSoundProcessorKarpuskl::~ctagSoundProcessorKarpuskl()
 void ctagSoundProcessorKarpuskl::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-  pMapPar.emplace("SingleNotes", [&](const int val){ SingleNotes = val;});
-  pMapTrig.emplace("SingleNotes", [&](const int val){ trig_SingleNotes = val;});
-  pMapPar.emplace("PowerChords", [&](const int val){ PowerChords = val;});
-  pMapTrig.emplace("PowerChords", [&](const int val){ trig_PowerChords = val;});
-  pMapPar.emplace("FourNoteChords", [&](const int val){ FourNoteChords = val;});
-  pMapTrig.emplace("FourNoteChords", [&](const int val){ trig_FourNoteChords = val;});
-  pMapPar.emplace("OctUp", [&](const int val){ OctUp = val;});
-  pMapTrig.emplace("OctUp", [&](const int val){ trig_OctUp = val;});
-  pMapPar.emplace("OctDown", [&](const int val){ OctDown = val;});
-  pMapTrig.emplace("OctDown", [&](const int val){ trig_OctDown = val;});
-  pMapPar.emplace("KarpusklTrigger", [&](const int val){ KarpusklTrigger = val;});
-  pMapTrig.emplace("KarpusklTrigger", [&](const int val){ trig_KarpusklTrigger = val;});
-  pMapPar.emplace("KarpusklFrequ", [&](const int val){ KarpusklFrequ = val;});
-  pMapCv.emplace("KarpusklFrequ", [&](const int val){ cv_KarpusklFrequ = val;});
-  pMapPar.emplace("Damping", [&](const int val){ Damping = val;});
-  pMapCv.emplace("Damping", [&](const int val){ cv_Damping = val;});
-  pMapPar.emplace("Brightness", [&](const int val){ Brightness = val;});
-  pMapCv.emplace("Brightness", [&](const int val){ cv_Brightness = val;});
-  pMapPar.emplace("DrivePost", [&](const int val){ DrivePost = val;});
-  pMapTrig.emplace("DrivePost", [&](const int val){ trig_DrivePost = val;});
-  pMapPar.emplace("DriveChar", [&](const int val){ DriveChar = val;});
-  pMapCv.emplace("DriveChar", [&](const int val){ cv_DriveChar = val;});
-  pMapPar.emplace("DriveAmnt", [&](const int val){ DriveAmnt = val;});
-  pMapCv.emplace("DriveAmnt", [&](const int val){ cv_DriveAmnt = val;});
-  pMapPar.emplace("ModMix", [&](const int val){ ModMix = val;});
-  pMapCv.emplace("ModMix", [&](const int val){ cv_ModMix = val;});
-  pMapPar.emplace("ModFreq", [&](const int val){ ModFreq = val;});
-  pMapCv.emplace("ModFreq", [&](const int val){ cv_ModFreq = val;});
-  pMapPar.emplace("ModFreqLoHi", [&](const int val){ ModFreqLoHi = val;});
-  pMapTrig.emplace("ModFreqLoHi", [&](const int val){ trig_ModFreqLoHi = val;});
-  pMapPar.emplace("LFOamnt", [&](const int val){ LFOamnt = val;});
-  pMapCv.emplace("LFOamnt", [&](const int val){ cv_LFOamnt = val;});
-  pMapPar.emplace("LFOrate", [&](const int val){ LFOrate = val;});
-  pMapCv.emplace("LFOrate", [&](const int val){ cv_LFOrate = val;});
-  pMapPar.emplace("LFOsquare", [&](const int val){ LFOsquare = val;});
-  pMapTrig.emplace("LFOsquare", [&](const int val){ trig_LFOsquare = val;});
-  pMapPar.emplace("MasterGain", [&](const int val){ MasterGain = val;});
-  pMapCv.emplace("MasterGain", [&](const int val){ cv_MasterGain = val;});
-  pMapPar.emplace("EnvActive", [&](const int val){ EnvActive = val;});
-  pMapTrig.emplace("EnvActive", [&](const int val){ trig_EnvActive = val;});
-  pMapPar.emplace("VolAttack", [&](const int val){ VolAttack = val;});
-  pMapCv.emplace("VolAttack", [&](const int val){ cv_VolAttack = val;});
-  pMapPar.emplace("VolDecay", [&](const int val){ VolDecay = val;});
-  pMapCv.emplace("VolDecay", [&](const int val){ cv_VolDecay = val;});
-  pMapPar.emplace("EnvLoop", [&](const int val){ EnvLoop = val;});
-  pMapTrig.emplace("EnvLoop", [&](const int val){ trig_EnvLoop = val;});
-  pMapPar.emplace("MasterPitch", [&](const int val){ MasterPitch = val;});
-  pMapCv.emplace("MasterPitch", [&](const int val){ cv_MasterPitch = val;});
-  pMapPar.emplace("QuantizeOn", [&](const int val){ QuantizeOn = val;});
-  pMapTrig.emplace("QuantizeOn", [&](const int val){ trig_QuantizeOn = val;});
+  static constexpr ctagParamDesc params[] {
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, SingleNotes),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, PowerChords),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, FourNoteChords),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, OctUp),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, OctDown),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, KarpusklTrigger),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, KarpusklFrequ),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, Damping),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, Brightness),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, DrivePost),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, DriveChar),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, DriveAmnt),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, ModMix),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, ModFreq),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, ModFreqLoHi),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, LFOamnt),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, LFOrate),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, LFOsquare),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, MasterGain),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, EnvActive),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, VolAttack),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, VolDecay),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, EnvLoop),
+      MK_PARAM_INT(ctagSoundProcessorKarpuskl, MasterPitch),
+      MK_PARAM_BOOL(ctagSoundProcessorKarpuskl, QuantizeOn),
+  };
+  setParamTable(params);
   isStereo = false;
   id = "Karpuskl";
 	// sectionCpp0
@@ -30,7 +30,7 @@ void ctagSoundProcessorMIDifu::Init(std::size_t blockSize, void *blockPtr) {
     model = std::make_unique<ctagSPDataModel>(id, isStereo);
     LoadPreset(0);
 
-    assert(blockSize >= 8192 * sizeof(float));
+    assert(blockSize >= blockMemSize);
     fx_buffer = (float *) blockPtr;
     fx.Init(fx_buffer);
     fx.Clear();
@@ -62,10 +62,11 @@ ctagSoundProcessorMIDifu::~ctagSoundProcessorMIDifu() {
 
 void ctagSoundProcessorMIDifu::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("amount", [&](const int val) { amount = val; });
-    pMapCv.emplace("amount", [&](const int val) { cv_amount = val; });
-    pMapPar.emplace("time", [&](const int val) { time = val; });
-    pMapCv.emplace("time", [&](const int val) { cv_time = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMIDifu, amount),
+        MK_PARAM_INT(ctagSoundProcessorMIDifu, time),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "MIDifu";
     // sectionCpp0
@@ -32,6 +32,7 @@ namespace CTAG {
             virtual ~ctagSoundProcessorMIDifu();
 
            virtual void Init(std::size_t blockSize, void *blockPtr) override;
+           static constexpr std::size_t blockMemSize = 8192 * sizeof(float);
 
         private:
             virtual void knowYourself() override;
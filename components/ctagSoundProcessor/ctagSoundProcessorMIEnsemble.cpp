@@ -67,10 +67,11 @@ ctagSoundProcessorMIEnsemble::~ctagSoundProcessorMIEnsemble() {
 
 void ctagSoundProcessorMIEnsemble::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("depth", [&](const int val) { depth = val; });
-    pMapCv.emplace("depth", [&](const int val) { cv_depth = val; });
-    pMapPar.emplace("amount", [&](const int val) { amount = val; });
-    pMapCv.emplace("amount", [&](const int val) { cv_amount = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMIEnsemble, depth),
+        MK_PARAM_INT(ctagSoundProcessorMIEnsemble, amount),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "MIEnsemble";
     // sectionCpp0
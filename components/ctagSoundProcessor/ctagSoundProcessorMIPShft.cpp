@@ -68,10 +68,11 @@ ctagSoundProcessorMIPShft::~ctagSoundProcessorMIPShft() {
 
 void ctagSoundProcessorMIPShft::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("ratio", [&](const int val) { ratio = val; });
-    pMapCv.emplace("ratio", [&](const int val) { cv_ratio = val; });
-    pMapPar.emplace("size", [&](const int val) { size = val; });
-    pMapCv.emplace("size", [&](const int val) { cv_size = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMIPShft, ratio),
+        MK_PARAM_INT(ctagSoundProcessorMIPShft, size),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "MIPShft";
     // sectionCpp0
@@ -85,24 +85,18 @@ void ctagSoundProcessorMISVF::Process(const ProcessData &data) {
 
 void ctagSoundProcessorMISVF::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("flt_mode", [&](const int val) { flt_mode = val; });
-    pMapCv.emplace("flt_mode", [&](const int val) { cv_flt_mode = val; });
-    pMapPar.emplace("gain", [&](const int val) { gain = val; });
-    pMapCv.emplace("gain", [&](const int val) { cv_gain = val; });
-    pMapPar.emplace("cutoff", [&](const int val) { cutoff = val; });
-    pMapCv.emplace("cutoff", [&](const int val) { cv_cutoff = val; });
-    pMapPar.emplace("resonance", [&](const int val) { resonance = val; });
-    pMapCv.emplace("resonance", [&](const int val) { cv_resonance = val; });
-    pMapPar.emplace("fm_amt", [&](const int val) { fm_amt = val; });
-    pMapCv.emplace("fm_amt", [&](const int val) { cv_fm_amt = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("loopEG", [&](const int val) { loopEG = val; });
-    pMapTrig.emplace("loopEG", [&](const int val) { trig_loopEG = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMISVF, flt_mode),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, gain),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, cutoff),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, resonance),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, fm_amt),
+        MK_PARAM_BOOL(ctagSoundProcessorMISVF, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorMISVF, loopEG),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, attack),
+        MK_PARAM_INT(ctagSoundProcessorMISVF, decay),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "MISVF";
     // sectionCpp0
@@ -21,10 +21,8 @@ respective component folders / files if different from this license.
 
 #include "ctagSoundProcessorMIVerb.hpp"
 #include <iostream>
-#include "esp_heap_caps.h"
 #include "helpers/ctagFastMath.hpp"
 #include "esp_log.h"
-#include "esp_heap_caps.h"
 
 using namespace CTAG::SP;
 
@@ -33,8 +31,8 @@ void ctagSoundProcessorMIVerb::Init(std::size_t blockSize, void *blockPtr) {
     model = std::make_unique<ctagSPDataModel>(id, isStereo);
     LoadPreset(0);
 
-    reverb_buffer = (float *) heap_caps_malloc(32768 * sizeof(float),
-                                               MALLOC_CAP_SPIRAM);//MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    reverb_buffer = (float *) ctagSPAllocator::Allocate(32768 * sizeof(float), alignof(float),
+                                                        ctagSPAllocator::Region::SPIRAM);
     if (reverb_buffer == NULL) {
         ESP_LOGE("MIVerb", "Could not allocate shared buffer!");
     }
@@ -103,25 +101,21 @@ void ctagSoundProcessorMIVerb::Process(const ProcessData &data) {
 }
 
 ctagSoundProcessorMIVerb::~ctagSoundProcessorMIVerb() {
-    heap_caps_free(reverb_buffer);
+    // no explicit freeing for reverb_buffer needed, done by ctagSPAllocator
 }
 
 void ctagSoundProcessorMIVerb::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("time", [&](const int val) { time = val; });
-    pMapCv.emplace("time", [&](const int val) { cv_time = val; });
-    pMapPar.emplace("amount", [&](const int val) { amount = val; });
-    pMapCv.emplace("amount", [&](const int val) { cv_amount = val; });
-    pMapPar.emplace("in_gain", [&](const int val) { in_gain = val; });
-    pMapCv.emplace("in_gain", [&](const int val) { cv_in_gain = val; });
-    pMapPar.emplace("diffusion", [&](const int val) { diffusion = val; });
-    pMapCv.emplace("diffusion", [&](const int val) { cv_diffusion = val; });
-    pMapPar.emplace("lp", [&](const int val) { lp = val; });
-    pMapCv.emplace("lp", [&](const int val) { cv_lp = val; });
-    pMapPar.emplace("lfo1_f", [&](const int val) { lfo1_f = val; });
-    pMapCv.emplace("lfo1_f", [&](const int val) { cv_lfo1_f = val; });
-    pMapPar.emplace("lfo2_f", [&](const int val) { lfo2_f = val; });
-    pMapCv.emplace("lfo2_f", [&](const int val) { cv_lfo2_f = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, time),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, amount),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, in_gain),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, diffusion),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, lp),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, lfo1_f),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb, lfo2_f),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "MIVerb";
     // sectionCpp0
@@ -24,7 +24,6 @@ respective component folders / files if different from this license.
 #include "clouds/dsp/frame.h"
 #include "helpers/ctagFastMath.hpp"
 #include "esp_log.h"
-#include "esp_heap_caps.h"
 
 using namespace CTAG::SP;
 
@@ -33,8 +32,8 @@ void ctagSoundProcessorMIVerb2::Init(std::size_t blockSize, void *blockPtr) {
     model = std::make_unique<ctagSPDataModel>(id, isStereo);
     LoadPreset(0);
 
-    reverb_buffer = (float *) heap_caps_malloc(32768 * sizeof(float),
-                                               MALLOC_CAP_SPIRAM);//MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    reverb_buffer = (float *) ctagSPAllocator::Allocate(32768 * sizeof(float), alignof(float),
+                                                        ctagSPAllocator::Region::SPIRAM);
     if (reverb_buffer == NULL) {
         ESP_LOGE("MIVerb", "Could not allocate shared buffer!");
     }
@@ -116,34 +115,26 @@ void ctagSoundProcessorMIVerb2::Process(const ProcessData &data) {
 }
 
 ctagSoundProcessorMIVerb2::~ctagSoundProcessorMIVerb2() {
-    heap_caps_free(reverb_buffer);
+    // no explicit freeing for reverb_buffer needed, done by ctagSPAllocator
 }
 
 void ctagSoundProcessorMIVerb2::knowYourself() {
     // autogenerated code here
 // sectionCpp0
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
-    pMapPar.emplace("amount", [&](const int val) { amount = val; });
-    pMapCv.emplace("amount", [&](const int val) { cv_amount = val; });
-    pMapPar.emplace("size", [&](const int val) { size = val; });
-    pMapCv.emplace("size", [&](const int val) { cv_size = val; });
-    pMapPar.emplace("in_gain", [&](const int val) { in_gain = val; });
-    pMapCv.emplace("in_gain", [&](const int val) { cv_in_gain = val; });
-    pMapPar.emplace("diffusion", [&](const int val) { diffusion = val; });
-    pMapCv.emplace("diffusion", [&](const int val) { cv_diffusion = val; });
-    pMapPar.emplace("lp", [&](const int val) { lp = val; });
-    pMapCv.emplace("lp", [&](const int val) { cv_lp = val; });
-    pMapPar.emplace("hp", [&](const int val) { hp = val; });
-    pMapCv.emplace("hp", [&](const int val) { cv_hp = val; });
-    pMapPar.emplace("mod_amount", [&](const int val) { mod_amount = val; });
-    pMapCv.emplace("mod_amount", [&](const int val) { cv_mod_amount = val; });
-    pMapPar.emplace("mod_rate", [&](const int val) { mod_rate = val; });
-    pMapCv.emplace("mod_rate", [&](const int val) { cv_mod_rate = val; });
-    pMapPar.emplace("ratio", [&](const int val) { ratio = val; });
-    pMapCv.emplace("ratio", [&](const int val) { cv_ratio = val; });
-    pMapPar.emplace("p_shift_amt", [&](const int val) { p_shift_amt = val; });
-    pMapCv.emplace("p_shift_amt", [&](const int val) { cv_p_shift_amt = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, decay),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, amount),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, size),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, in_gain),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, diffusion),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, lp),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, hp),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, mod_amount),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, mod_rate),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, ratio),
+        MK_PARAM_INT(ctagSoundProcessorMIVerb2, p_shift_amt),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "MIVerb2";
     // sectionCpp0
@@ -169,50 +169,31 @@ ctagSoundProcessorMSxxNoise::~ctagSoundProcessorMSxxNoise()
 void ctagSoundProcessorMSxxNoise::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("ExternalActive", [&](const int val){ ExternalActive = val;});
-	pMapTrig.emplace("ExternalActive", [&](const int val){ trig_ExternalActive = val;});
-	pMapPar.emplace("NoiseExternalBalance", [&](const int val){ NoiseExternalBalance = val;});
-	pMapCv.emplace("NoiseExternalBalance", [&](const int val){ cv_NoiseExternalBalance = val;});
-	pMapPar.emplace("PinkActive", [&](const int val){ PinkActive = val;});
-	pMapTrig.emplace("PinkActive", [&](const int val){ trig_PinkActive = val;});
-	pMapPar.emplace("WhiteActive", [&](const int val){ WhiteActive = val;});
-	pMapTrig.emplace("WhiteActive", [&](const int val){ trig_WhiteActive = val;});
-	pMapPar.emplace("PinkWhiteBalance", [&](const int val){ PinkWhiteBalance = val;});
-	pMapCv.emplace("PinkWhiteBalance", [&](const int val){ cv_PinkWhiteBalance = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("FilterBypass", [&](const int val){ FilterBypass = val;});
-	pMapTrig.emplace("FilterBypass", [&](const int val){ trig_FilterBypass = val;});
-	pMapPar.emplace("SaturationActive", [&](const int val){ SaturationActive = val;});
-	pMapTrig.emplace("SaturationActive", [&](const int val){ trig_SaturationActive = val;});
-	pMapPar.emplace("Saturation", [&](const int val){ Saturation = val;});
-	pMapCv.emplace("Saturation", [&](const int val){ cv_Saturation = val;});
-	pMapPar.emplace("Cutoff", [&](const int val){ Cutoff = val;});
-	pMapCv.emplace("Cutoff", [&](const int val){ cv_Cutoff = val;});
-	pMapPar.emplace("Resonance", [&](const int val){ Resonance = val;});
-	pMapCv.emplace("Resonance", [&](const int val){ cv_Resonance = val;});
-	pMapPar.emplace("MGactive", [&](const int val){ MGactive = val;});
-	pMapTrig.emplace("MGactive", [&](const int val){ trig_MGactive = val;});
-	pMapPar.emplace("MGisSquare", [&](const int val){ MGisSquare = val;});
-	pMapTrig.emplace("MGisSquare", [&](const int val){ trig_MGisSquare = val;});
-	pMapPar.emplace("MGspeed", [&](const int val){ MGspeed = val;});
-	pMapCv.emplace("MGspeed", [&](const int val){ cv_MGspeed = val;});
-	pMapPar.emplace("MGamnt", [&](const int val){ MGamnt = val;});
-	pMapCv.emplace("MGamnt", [&](const int val){ cv_MGamnt = val;});
-	pMapPar.emplace("PhaserBypass", [&](const int val){ PhaserBypass = val;});
-	pMapTrig.emplace("PhaserBypass", [&](const int val){ trig_PhaserBypass = val;});
-	pMapPar.emplace("PhaserDryWet", [&](const int val){ PhaserDryWet = val;});
-	pMapCv.emplace("PhaserDryWet", [&](const int val){ cv_PhaserDryWet = val;});
-	pMapPar.emplace("PhaserPreset", [&](const int val){ PhaserPreset = val;});
-	pMapTrig.emplace("PhaserPreset", [&](const int val){ trig_PhaserPreset = val;});
-	pMapPar.emplace("PhaserColor", [&](const int val){ PhaserColor = val;});
-	pMapCv.emplace("PhaserColor", [&](const int val){ cv_PhaserColor = val;});
-	pMapPar.emplace("PhaserLFOfrequency", [&](const int val){ PhaserLFOfrequency = val;});
-	pMapCv.emplace("PhaserLFOfrequency", [&](const int val){ cv_PhaserLFOfrequency = val;});
-	pMapPar.emplace("PhaserFeedbackDepth", [&](const int val){ PhaserFeedbackDepth = val;});
-	pMapCv.emplace("PhaserFeedbackDepth", [&](const int val){ cv_PhaserFeedbackDepth = val;});
-	pMapPar.emplace("PhaserFeedbackBassCut", [&](const int val){ PhaserFeedbackBassCut = val;});
-	pMapCv.emplace("PhaserFeedbackBassCut", [&](const int val){ cv_PhaserFeedbackBassCut = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, ExternalActive),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, NoiseExternalBalance),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, PinkActive),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, WhiteActive),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PinkWhiteBalance),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, Volume),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, FilterBypass),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, SaturationActive),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, Saturation),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, Cutoff),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, Resonance),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, MGactive),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, MGisSquare),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, MGspeed),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, MGamnt),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, PhaserBypass),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PhaserDryWet),
+		MK_PARAM_BOOL(ctagSoundProcessorMSxxNoise, PhaserPreset),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PhaserColor),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PhaserLFOfrequency),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PhaserFeedbackDepth),
+		MK_PARAM_INT(ctagSoundProcessorMSxxNoise, PhaserFeedbackBassCut),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "MSxxNoise";
 	// sectionCpp0
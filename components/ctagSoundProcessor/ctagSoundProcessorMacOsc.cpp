@@ -36,7 +36,7 @@ void ctagSoundProcessorMacOsc::Init(std::size_t blockSize, void *blockPtr) {
     osc.set_shape(braids::MacroOscillatorShape::MACRO_OSC_SHAPE_CSAW);
     ws.Init(0xcafe);
     //envelope.Init();
-    envelope.SetSampleRate(44100.f / 32.f);
+    envelope.SetSampleRate(44100.f / bufSz);
     envelope.SetModeExp();
     quantizer.Init();
 }
@@ -144,8 +144,12 @@ void ctagSoundProcessorMacOsc::Process(const ProcessData &data) {
     osc.set_pitch(ipitch);
 
     // render audio data
-    int16_t buffer[32];
-    osc.Render(sync, buffer, bufSz);
+    int16_t buffer[bufSz];
+    // braids renders at most 32 frames per call
+    constexpr int chunkSz = bufSz < 32 ? bufSz : 32;
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        osc.Render(sync, &buffer[i], chunkSz);
+    }
 
     // calculate amplitude modulation
     int32_t am = am_amt;
@@ -172,7 +176,7 @@ void ctagSoundProcessorMacOsc::Process(const ProcessData &data) {
     }
     int16_t bit_mask = bit_reduction_masks[6 - br];
     float fGain = gain / 4095.f * 1.5f;
-    for (int i = 0; i < 32; i++) {
+    for (int i = 0; i < bufSz; i++) {
         if ((i % dfactor) == 0) {
             sample = buffer[i] & bit_mask;
         }
@@ -186,40 +190,26 @@ void ctagSoundProcessorMacOsc::Process(const ProcessData &data) {
 void ctagSoundProcessorMacOsc::knowYourself() {
     // autogenerated code here
 // sectionCpp0
-    pMapPar.emplace("shape", [&](const int val) { shape = val; });
-    pMapCv.emplace("shape", [&](const int val) { cv_shape = val; });
-    pMapPar.emplace("gain", [&](const int val) { gain = val; });
-    pMapCv.emplace("gain", [&](const int val) { cv_gain = val; });
-    pMapPar.emplace("pitch", [&](const int val) { pitch = val; });
-    pMapCv.emplace("pitch", [&](const int val) { cv_pitch = val; });
-    pMapPar.emplace("decimation", [&](const int val) { decimation = val; });
-    pMapCv.emplace("decimation", [&](const int val) { cv_decimation = val; });
-    pMapPar.emplace("bit_reduction", [&](const int val) { bit_reduction = val; });
-    pMapCv.emplace("bit_reduction", [&](const int val) { cv_bit_reduction = val; });
-    pMapPar.emplace("q_scale", [&](const int val) { q_scale = val; });
-    pMapCv.emplace("q_scale", [&](const int val) { cv_q_scale = val; });
-    pMapPar.emplace("param_0", [&](const int val) { param_0 = val; });
-    pMapCv.emplace("param_0", [&](const int val) { cv_param_0 = val; });
-    pMapPar.emplace("param_1", [&](const int val) { param_1 = val; });
-    pMapCv.emplace("param_1", [&](const int val) { cv_param_1 = val; });
-    pMapPar.emplace("waveshaping", [&](const int val) { waveshaping = val; });
-    pMapCv.emplace("waveshaping", [&](const int val) { cv_waveshaping = val; });
-    pMapPar.emplace("fm_amt", [&](const int val) { fm_amt = val; });
-    pMapCv.emplace("fm_amt", [&](const int val) { cv_fm_amt = val; });
-    pMapPar.emplace("am_amt", [&](const int val) { am_amt = val; });
-    pMapCv.emplace("am_amt", [&](const int val) { cv_am_amt = val; });
-    pMapPar.emplace("p0_amt", [&](const int val) { p0_amt = val; });
-    pMapCv.emplace("p0_amt", [&](const int val) { cv_p0_amt = val; });
-    pMapPar.emplace("p1_amt", [&](const int val) { p1_amt = val; });
-    pMapCv.emplace("p1_amt", [&](const int val) { cv_p1_amt = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("loopEG", [&](const int val) { loopEG = val; });
-    pMapTrig.emplace("loopEG", [&](const int val) { trig_loopEG = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, shape),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, gain),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, pitch),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, decimation),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, bit_reduction),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, q_scale),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, param_0),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, param_1),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, waveshaping),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, fm_amt),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, am_amt),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, p0_amt),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, p1_amt),
+        MK_PARAM_BOOL(ctagSoundProcessorMacOsc, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorMacOsc, loopEG),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, attack),
+        MK_PARAM_INT(ctagSoundProcessorMacOsc, decay),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "MacOsc";
     // sectionCpp0
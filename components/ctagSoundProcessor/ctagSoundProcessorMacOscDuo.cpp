@@ -188,10 +188,14 @@ void ctagSoundProcessorMacOscDuo::Process(const ProcessData &data) {
     }
 
     // render audio data
-    int16_t buffer1[32];
-    int16_t buffer2[32];
-    osc[0].Render(sync1, buffer1, bufSz);
-    osc[1].Render(sync2, buffer2, bufSz);
+    int16_t buffer1[bufSz];
+    int16_t buffer2[bufSz];
+    // braids renders at most 32 frames per call
+    constexpr int chunkSz = bufSz < 32 ? bufSz : 32;
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        osc[0].Render(sync1, &buffer1[i], chunkSz);
+        osc[1].Render(sync2, &buffer2[i], chunkSz);
+    }
 
     //  amplitude modulation
     MK_FLT_PAR_ABS(fAM, am_amt, 64.f, 1.f)
@@ -252,14 +256,14 @@ void ctagSoundProcessorMacOscDuo::Init(std::size_t blockSize, void *blockPtr) {
         osc[i].set_shape(braids::MacroOscillatorShape::MACRO_OSC_SHAPE_CSAW);
         ws[i].Init(0xcafe);
         //envelope[i].Init();
-        envelope[i].SetSampleRate(44100.f / 32.f);
+        envelope[i].SetSampleRate(44100.f / bufSz);
         envelope[i].SetModeExp();
         envelope[i].Reset();
         envelopeHighRes[i].SetSampleRate(44100.f);
         envelopeHighRes[i].SetModeExp();
         envelopeHighRes[i].Reset();
         quantizer[i].Init();
-        lfo.SetSampleRate(44100.f / 32.f);
+        lfo.SetSampleRate(44100.f / bufSz);
         lfo.SetFrequency(1.f);
         lfoHighRes.SetSampleRate(44100.f);
         lfoHighRes.SetFrequency(1.f);
@@ -272,56 +276,34 @@ ctagSoundProcessorMacOscDuo::~ctagSoundProcessorMacOscDuo() {
 void ctagSoundProcessorMacOscDuo::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("shape", [&](const int val){ shape = val;});
-	pMapCv.emplace("shape", [&](const int val){ cv_shape = val;});
-	pMapPar.emplace("gain1", [&](const int val){ gain1 = val;});
-	pMapCv.emplace("gain1", [&](const int val){ cv_gain1 = val;});
-	pMapPar.emplace("gain2", [&](const int val){ gain2 = val;});
-	pMapCv.emplace("gain2", [&](const int val){ cv_gain2 = val;});
-	pMapPar.emplace("pitch1", [&](const int val){ pitch1 = val;});
-	pMapCv.emplace("pitch1", [&](const int val){ cv_pitch1 = val;});
-	pMapPar.emplace("pitch2", [&](const int val){ pitch2 = val;});
-	pMapCv.emplace("pitch2", [&](const int val){ cv_pitch2 = val;});
-	pMapPar.emplace("tune1", [&](const int val){ tune1 = val;});
-	pMapCv.emplace("tune1", [&](const int val){ cv_tune1 = val;});
-	pMapPar.emplace("tune2", [&](const int val){ tune2 = val;});
-	pMapCv.emplace("tune2", [&](const int val){ cv_tune2 = val;});
-	pMapPar.emplace("decimation", [&](const int val){ decimation = val;});
-	pMapCv.emplace("decimation", [&](const int val){ cv_decimation = val;});
-	pMapPar.emplace("bit_reduction", [&](const int val){ bit_reduction = val;});
-	pMapCv.emplace("bit_reduction", [&](const int val){ cv_bit_reduction = val;});
-	pMapPar.emplace("q_scale", [&](const int val){ q_scale = val;});
-	pMapCv.emplace("q_scale", [&](const int val){ cv_q_scale = val;});
-	pMapPar.emplace("param_0", [&](const int val){ param_0 = val;});
-	pMapCv.emplace("param_0", [&](const int val){ cv_param_0 = val;});
-	pMapPar.emplace("param_1", [&](const int val){ param_1 = val;});
-	pMapCv.emplace("param_1", [&](const int val){ cv_param_1 = val;});
-	pMapPar.emplace("waveshaping", [&](const int val){ waveshaping = val;});
-	pMapCv.emplace("waveshaping", [&](const int val){ cv_waveshaping = val;});
-	pMapPar.emplace("enableEG1", [&](const int val){ enableEG1 = val;});
-	pMapTrig.emplace("enableEG1", [&](const int val){ trig_enableEG1 = val;});
-	pMapPar.emplace("enableEG2", [&](const int val){ enableEG2 = val;});
-	pMapTrig.emplace("enableEG2", [&](const int val){ trig_enableEG2 = val;});
-	pMapPar.emplace("attack", [&](const int val){ attack = val;});
-	pMapCv.emplace("attack", [&](const int val){ cv_attack = val;});
-	pMapPar.emplace("decay", [&](const int val){ decay = val;});
-	pMapCv.emplace("decay", [&](const int val){ cv_decay = val;});
-	pMapPar.emplace("sustain", [&](const int val){ sustain = val;});
-	pMapCv.emplace("sustain", [&](const int val){ cv_sustain = val;});
-	pMapPar.emplace("release", [&](const int val){ release = val;});
-	pMapCv.emplace("release", [&](const int val){ cv_release = val;});
-	pMapPar.emplace("lfo_f", [&](const int val){ lfo_f = val;});
-	pMapCv.emplace("lfo_f", [&](const int val){ cv_lfo_f = val;});
-	pMapPar.emplace("fm_amt1", [&](const int val){ fm_amt1 = val;});
-	pMapCv.emplace("fm_amt1", [&](const int val){ cv_fm_amt1 = val;});
-	pMapPar.emplace("fm_amt2", [&](const int val){ fm_amt2 = val;});
-	pMapCv.emplace("fm_amt2", [&](const int val){ cv_fm_amt2 = val;});
-	pMapPar.emplace("am_amt", [&](const int val){ am_amt = val;});
-	pMapCv.emplace("am_amt", [&](const int val){ cv_am_amt = val;});
-	pMapPar.emplace("p0_amt", [&](const int val){ p0_amt = val;});
-	pMapCv.emplace("p0_amt", [&](const int val){ cv_p0_amt = val;});
-	pMapPar.emplace("p1_amt", [&](const int val){ p1_amt = val;});
-	pMapCv.emplace("p1_amt", [&](const int val){ cv_p1_amt = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, shape),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, gain1),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, gain2),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, pitch1),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, pitch2),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, tune1),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, tune2),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, decimation),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, bit_reduction),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, q_scale),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, param_0),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, param_1),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, waveshaping),
+		MK_PARAM_BOOL(ctagSoundProcessorMacOscDuo, enableEG1),
+		MK_PARAM_BOOL(ctagSoundProcessorMacOscDuo, enableEG2),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, attack),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, decay),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, sustain),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, release),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, lfo_f),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, fm_amt1),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, fm_amt2),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, am_amt),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, p0_amt),
+		MK_PARAM_INT(ctagSoundProcessorMacOscDuo, p1_amt),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "MacOscDuo";
 	// sectionCpp0
@@ -1,5 +1,4 @@
 #include "ctagSoundProcessorMonoDelay.hpp"
-#include "esp_heap_caps.h"
 #include "stmlib/stmlib.h"
 #include "stmlib/dsp/dsp.h"
 #include "helpers/ctagFastMath.hpp"
@@ -26,7 +25,7 @@ void ctagSoundProcessorMonoDelay::Process(const ProcessData &data) {
 	E::Context c;
 
 	// simple echo effect
-	for(int i=0;i<32;i++){
+	for(int i=0;i<bufSz;i++){
 		if(delayOffset != ofs){
 			delayOffset = ONE_POLE(delayOffset, ofs, 0.00001f);
 		}
@@ -78,7 +77,7 @@ void ctagSoundProcessorMonoDelay::Process(const ProcessData &data) {
 		if(bSyncTrig && bSync){
 			int delta = timer - pre_timer;
 			if(std::abs(delta) > 1){
-				fDelayTime = static_cast<float>(timer) * 32.f / 44.1f;
+				fDelayTime = static_cast<float>(timer) * bufSz / 44.1f;
 			}
 			pre_timer = timer;
 			timer = 0;
@@ -90,7 +89,7 @@ void ctagSoundProcessorMonoDelay::Process(const ProcessData &data) {
 	CONSTRAIN(fDelayTime, 0.0001, 2000.f)
 	float ofs = fDelayTime * 44.1f;
 	if(fabsf(ofs - delayOffset) < 16) ofs = delayOffset;
-	for(int i=0; i<32; i++){
+	for(int i=0; i<bufSz; i++){
 		// Calculate the delay offset in samples
 		if(delayOffset != ofs){
 			if(bTapeDigital){
@@ -146,9 +145,9 @@ void ctagSoundProcessorMonoDelay::Init(std::size_t blockSize, void *blockPtr) {
     // check if blockMem is large enough
     // blockMem is used just like larger blocks of heap memory
     // assert(blockSize >= memLen);
-    // if memory larger than blockMem is needed, use heap_caps_malloc() instead with MALLOC_CAPS_SPIRAM
+    // if memory larger than blockMem is needed, use ctagSPAllocator::Allocate() instead with Region::SPIRAM
 
-	delayBuffer = static_cast<float*>(heap_caps_malloc(88200 * sizeof(float), MALLOC_CAP_SPIRAM));
+	delayBuffer = static_cast<float*>(ctagSPAllocator::Allocate(88200 * sizeof(float), alignof(float), ctagSPAllocator::Region::SPIRAM));
 	assert(delayBuffer != nullptr);
 	// engine.Init(delayBuffer);
 
@@ -157,10 +156,7 @@ void ctagSoundProcessorMonoDelay::Init(std::size_t blockSize, void *blockPtr) {
 // no ctor, use Init() instead, is called from factory after successful creation
 // dtor
 ctagSoundProcessorMonoDelay::~ctagSoundProcessorMonoDelay() {
-    // no explicit freeing for blockMem needed, done by ctagSPAllocator
-    // explicit free is only needed when using heap_caps_malloc() with MALLOC_CAPS_SPIRAM
-
-	heap_caps_free(delayBuffer);
+    // no explicit freeing for blockMem and delayBuffer needed, done by ctagSPAllocator
 	lp.Init();
 	hp.Init();
 }
@@ -168,22 +164,17 @@ ctagSoundProcessorMonoDelay::~ctagSoundProcessorMonoDelay() {
 void ctagSoundProcessorMonoDelay::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("time_ms", [&](const int val){ time_ms = val;});
-	pMapCv.emplace("time_ms", [&](const int val){ cv_time_ms = val;});
-	pMapPar.emplace("sync", [&](const int val){ sync = val;});
-	pMapTrig.emplace("sync", [&](const int val){ trig_sync = val;});
-	pMapPar.emplace("freeze", [&](const int val){ freeze = val;});
-	pMapTrig.emplace("freeze", [&](const int val){ trig_freeze = val;});
-	pMapPar.emplace("tape_digital", [&](const int val){ tape_digital = val;});
-	pMapTrig.emplace("tape_digital", [&](const int val){ trig_tape_digital = val;});
-	pMapPar.emplace("feedback", [&](const int val){ feedback = val;});
-	pMapCv.emplace("feedback", [&](const int val){ cv_feedback = val;});
-	pMapPar.emplace("base", [&](const int val){ base = val;});
-	pMapCv.emplace("base", [&](const int val){ cv_base = val;});
-	pMapPar.emplace("width", [&](const int val){ width = val;});
-	pMapCv.emplace("width", [&](const int val){ cv_width = val;});
-	pMapPar.emplace("mix", [&](const int val){ mix = val;});
-	pMapCv.emplace("mix", [&](const int val){ cv_mix = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorMonoDelay, time_ms),
+		MK_PARAM_BOOL(ctagSoundProcessorMonoDelay, sync),
+		MK_PARAM_BOOL(ctagSoundProcessorMonoDelay, freeze),
+		MK_PARAM_BOOL(ctagSoundProcessorMonoDelay, tape_digital),
+		MK_PARAM_INT(ctagSoundProcessorMonoDelay, feedback),
+		MK_PARAM_INT(ctagSoundProcessorMonoDelay, base),
+		MK_PARAM_INT(ctagSoundProcessorMonoDelay, width),
+		MK_PARAM_INT(ctagSoundProcessorMonoDelay, mix),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "MonoDelay";
 	// sectionCpp0
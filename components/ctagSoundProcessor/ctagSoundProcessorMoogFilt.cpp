@@ -121,24 +121,18 @@ void ctagSoundProcessorMoogFilt::Process(const ProcessData &data) {
 
 void ctagSoundProcessorMoogFilt::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("flt_model", [&](const int val) { flt_model = val; });
-    pMapCv.emplace("flt_model", [&](const int val) { cv_flt_model = val; });
-    pMapPar.emplace("gain", [&](const int val) { gain = val; });
-    pMapCv.emplace("gain", [&](const int val) { cv_gain = val; });
-    pMapPar.emplace("cutoff", [&](const int val) { cutoff = val; });
-    pMapCv.emplace("cutoff", [&](const int val) { cv_cutoff = val; });
-    pMapPar.emplace("resonance", [&](const int val) { resonance = val; });
-    pMapCv.emplace("resonance", [&](const int val) { cv_resonance = val; });
-    pMapPar.emplace("fm_amt", [&](const int val) { fm_amt = val; });
-    pMapCv.emplace("fm_amt", [&](const int val) { cv_fm_amt = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("loopEG", [&](const int val) { loopEG = val; });
-    pMapTrig.emplace("loopEG", [&](const int val) { trig_loopEG = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, flt_model),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, gain),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, cutoff),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, resonance),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, fm_amt),
+        MK_PARAM_BOOL(ctagSoundProcessorMoogFilt, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorMoogFilt, loopEG),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, attack),
+        MK_PARAM_INT(ctagSoundProcessorMoogFilt, decay),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "MoogFilt";
     // sectionCpp0
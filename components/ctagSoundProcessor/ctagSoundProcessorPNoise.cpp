@@ -50,10 +50,11 @@ void ctagSoundProcessorPNoise::Process(const ProcessData &data) {
 
 void ctagSoundProcessorPNoise::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("enable", [&](const int val) { enable = val; });
-    pMapTrig.emplace("enable", [&](const int val) { trig_enable = val; });
-    pMapPar.emplace("factor", [&](const int val) { factor = val; });
-    pMapCv.emplace("factor", [&](const int val) { cv_factor = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorPNoise, enable),
+        MK_PARAM_INT(ctagSoundProcessorPNoise, factor),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "PNoise";
     // sectionCpp0
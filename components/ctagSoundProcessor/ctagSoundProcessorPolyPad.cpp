@@ -33,17 +33,20 @@ void ctagSoundProcessorPolyPad::Init(std::size_t blockSize, void *blockPtr) {
     knowYourself();
     model = std::make_unique<ctagSPDataModel>(id, isStereo);
     LoadPreset(0);
+    usesAudioRateCV = true; // gain cv acts as vca at audio rate
 
     for(auto &s:v_voices){
         s.Reset();
     }
 
     quantizer.Init();
+    gainSmoother.Init(HELPERS::ctagSmoothedParam::LINEAR, 0.f, bufSz);
+    gainSmoother.Reset(gain / 4095.f * 2.f);
 }
 
 void ctagSoundProcessorPolyPad::Process(const ProcessData &data) {
     // zero input
-    for (int i = 0; i < 32; i++) {
+    for (int i = 0; i < bufSz; i++) {
         data.buf[i * 2 + processCh] = 0.f;
     }
 
@@ -210,12 +213,9 @@ void ctagSoundProcessorPolyPad::Process(const ProcessData &data) {
     }
 
     // apply gain
-    float fGain = gain / 4095.f * 2.f;
-    if (cv_gain != -1) {
-        fGain = fabsf(data.cv[cv_gain]) * 2.f;
-    }
+    MK_FLT_PAR_ABS_SMOOTH(fGain, gain, 4095.f, 2.f, gainSmoother)
     for (int i = 0; i < bufSz; i++) {
-        data.buf[i * 2 + processCh] *= fGain;
+        data.buf[i * 2 + processCh] *= fGain[i];
     }
 
     // note off including latched mode
@@ -254,56 +254,34 @@ void ctagSoundProcessorPolyPad::PrintParams(ChordSynth::ChordParams &params) {
 
 void ctagSoundProcessorPolyPad::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("gain", [&](const int val) { gain = val; });
-    pMapCv.emplace("gain", [&](const int val) { cv_gain = val; });
-    pMapPar.emplace("pitch", [&](const int val) { pitch = val; });
-    pMapCv.emplace("pitch", [&](const int val) { cv_pitch = val; });
-    pMapPar.emplace("q_scale", [&](const int val) { q_scale = val; });
-    pMapCv.emplace("q_scale", [&](const int val) { cv_q_scale = val; });
-    pMapPar.emplace("chord", [&](const int val) { chord = val; });
-    pMapCv.emplace("chord", [&](const int val) { cv_chord = val; });
-    pMapPar.emplace("inversion", [&](const int val) { inversion = val; });
-    pMapCv.emplace("inversion", [&](const int val) { cv_inversion = val; });
-    pMapPar.emplace("detune", [&](const int val) { detune = val; });
-    pMapCv.emplace("detune", [&](const int val) { cv_detune = val; });
-    pMapPar.emplace("nnotes", [&](const int val) { nnotes = val; });
-    pMapCv.emplace("nnotes", [&](const int val) { cv_nnotes = val; });
-    pMapPar.emplace("ncvoices", [&](const int val) { ncvoices = val; });
-    pMapCv.emplace("ncvoices", [&](const int val) { cv_ncvoices = val; });
-    pMapPar.emplace("voicehold", [&](const int val) { voicehold = val; });
-    pMapTrig.emplace("voicehold", [&](const int val) { trig_voicehold = val; });
-    pMapPar.emplace("lfo1_freq", [&](const int val) { lfo1_freq = val; });
-    pMapCv.emplace("lfo1_freq", [&](const int val) { cv_lfo1_freq = val; });
-    pMapPar.emplace("lfo1_amt", [&](const int val) { lfo1_amt = val; });
-    pMapCv.emplace("lfo1_amt", [&](const int val) { cv_lfo1_amt = val; });
-    pMapPar.emplace("filter_type", [&](const int val) { filter_type = val; });
-    pMapCv.emplace("filter_type", [&](const int val) { cv_filter_type = val; });
-    pMapPar.emplace("cutoff", [&](const int val) { cutoff = val; });
-    pMapCv.emplace("cutoff", [&](const int val) { cv_cutoff = val; });
-    pMapPar.emplace("resonance", [&](const int val) { resonance = val; });
-    pMapCv.emplace("resonance", [&](const int val) { cv_resonance = val; });
-    pMapPar.emplace("lfo2_freq", [&](const int val) { lfo2_freq = val; });
-    pMapCv.emplace("lfo2_freq", [&](const int val) { cv_lfo2_freq = val; });
-    pMapPar.emplace("lfo2_amt", [&](const int val) { lfo2_amt = val; });
-    pMapCv.emplace("lfo2_amt", [&](const int val) { cv_lfo2_amt = val; });
-    pMapPar.emplace("lfo2_rphase", [&](const int val) { lfo2_rphase = val; });
-    pMapTrig.emplace("lfo2_rphase", [&](const int val) { trig_lfo2_rphase = val; });
-    pMapPar.emplace("eg_filt_amt", [&](const int val) { eg_filt_amt = val; });
-    pMapCv.emplace("eg_filt_amt", [&](const int val) { cv_eg_filt_amt = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("latchEG", [&](const int val) { latchEG = val; });
-    pMapTrig.emplace("latchEG", [&](const int val) { trig_latchEG = val; });
-    pMapPar.emplace("eg_slow_fast", [&](const int val) { eg_slow_fast = val; });
-    pMapTrig.emplace("eg_slow_fast", [&](const int val) { trig_eg_slow_fast = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
-    pMapPar.emplace("sustain", [&](const int val) { sustain = val; });
-    pMapCv.emplace("sustain", [&](const int val) { cv_sustain = val; });
-    pMapPar.emplace("release", [&](const int val) { release = val; });
-    pMapCv.emplace("release", [&](const int val) { cv_release = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, gain),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, pitch),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, q_scale),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, chord),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, inversion),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, detune),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, nnotes),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, ncvoices),
+        MK_PARAM_BOOL(ctagSoundProcessorPolyPad, voicehold),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, lfo1_freq),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, lfo1_amt),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, filter_type),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, cutoff),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, resonance),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, lfo2_freq),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, lfo2_amt),
+        MK_PARAM_BOOL(ctagSoundProcessorPolyPad, lfo2_rphase),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, eg_filt_amt),
+        MK_PARAM_BOOL(ctagSoundProcessorPolyPad, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorPolyPad, latchEG),
+        MK_PARAM_BOOL(ctagSoundProcessorPolyPad, eg_slow_fast),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, attack),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, decay),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, sustain),
+        MK_PARAM_INT(ctagSoundProcessorPolyPad, release),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "PolyPad";
     // sectionCpp0
@@ -76,6 +76,7 @@ namespace CTAG {
             bool toggle = false;
             int32_t preNCVoices = 0;
             braids::Quantizer quantizer;
+            HELPERS::ctagSmoothedParam gainSmoother;
         };
     }
 }
\ No newline at end of file
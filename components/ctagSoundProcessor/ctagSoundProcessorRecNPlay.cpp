@@ -323,46 +323,29 @@ ctagSoundProcessorRecNPlay::~ctagSoundProcessorRecNPlay()
 void ctagSoundProcessorRecNPlay::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("EGactiv", [&](const int val){ EGactiv = val;});
-	pMapTrig.emplace("EGactiv", [&](const int val){ trig_EGactiv = val;});
-	pMapPar.emplace("Attack", [&](const int val){ Attack = val;});
-	pMapCv.emplace("Attack", [&](const int val){ cv_Attack = val;});
-	pMapPar.emplace("Decay", [&](const int val){ Decay = val;});
-	pMapCv.emplace("Decay", [&](const int val){ cv_Decay = val;});
-	pMapPar.emplace("StepAndEGtrigger", [&](const int val){ StepAndEGtrigger = val;});
-	pMapTrig.emplace("StepAndEGtrigger", [&](const int val){ trig_StepAndEGtrigger = val;});
-	pMapPar.emplace("VoiceVol", [&](const int val){ VoiceVol = val;});
-	pMapCv.emplace("VoiceVol", [&](const int val){ cv_VoiceVol = val;});
-	pMapPar.emplace("PitchSaw", [&](const int val){ PitchSaw = val;});
-	pMapCv.emplace("PitchSaw", [&](const int val){ cv_PitchSaw = val;});
-	pMapPar.emplace("ExtSawMix", [&](const int val){ ExtSawMix = val;});
-	pMapCv.emplace("ExtSawMix", [&](const int val){ cv_ExtSawMix = val;});
-	pMapPar.emplace("SawNoiseMix", [&](const int val){ SawNoiseMix = val;});
-	pMapCv.emplace("SawNoiseMix", [&](const int val){ cv_SawNoiseMix = val;});
-	pMapPar.emplace("Cutoff", [&](const int val){ Cutoff = val;});
-	pMapCv.emplace("Cutoff", [&](const int val){ cv_Cutoff = val;});
-	pMapPar.emplace("Resonance", [&](const int val){ Resonance = val;});
-	pMapCv.emplace("Resonance", [&](const int val){ cv_Resonance = val;});
-	pMapPar.emplace("Drive", [&](const int val){ Drive = val;});
-	pMapCv.emplace("Drive", [&](const int val){ cv_Drive = val;});
-	pMapPar.emplace("BitsToCrush", [&](const int val){ BitsToCrush = val;});
-	pMapCv.emplace("BitsToCrush", [&](const int val){ cv_BitsToCrush = val;});
-	pMapPar.emplace("DownsampleFactor", [&](const int val){ DownsampleFactor = val;});
-	pMapCv.emplace("DownsampleFactor", [&](const int val){ cv_DownsampleFactor = val;});
-	pMapPar.emplace("SnHamount", [&](const int val){ SnHamount = val;});
-	pMapCv.emplace("SnHamount", [&](const int val){ cv_SnHamount = val;});
-	pMapPar.emplace("StepperActive", [&](const int val){ StepperActive = val;});
-	pMapTrig.emplace("StepperActive", [&](const int val){ trig_StepperActive = val;});
-	pMapPar.emplace("RecPlay", [&](const int val){ RecPlay = val;});
-	pMapTrig.emplace("RecPlay", [&](const int val){ trig_RecPlay = val;});
-	pMapPar.emplace("CurrentStep", [&](const int val){ CurrentStep = val;});
-	pMapCv.emplace("CurrentStep", [&](const int val){ cv_CurrentStep = val;});
-	pMapPar.emplace("NumberOfSteps", [&](const int val){ NumberOfSteps = val;});
-	pMapCv.emplace("NumberOfSteps", [&](const int val){ cv_NumberOfSteps = val;});
-	pMapPar.emplace("BPMint", [&](const int val){ BPMint = val;});
-	pMapCv.emplace("BPMint", [&](const int val){ cv_BPMint = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Volume),
+		MK_PARAM_BOOL(ctagSoundProcessorRecNPlay, EGactiv),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Attack),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Decay),
+		MK_PARAM_BOOL(ctagSoundProcessorRecNPlay, StepAndEGtrigger),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, VoiceVol),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, PitchSaw),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, ExtSawMix),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, SawNoiseMix),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Cutoff),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Resonance),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, Drive),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, BitsToCrush),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, DownsampleFactor),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, SnHamount),
+		MK_PARAM_BOOL(ctagSoundProcessorRecNPlay, StepperActive),
+		MK_PARAM_BOOL(ctagSoundProcessorRecNPlay, RecPlay),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, CurrentStep),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, NumberOfSteps),
+		MK_PARAM_INT(ctagSoundProcessorRecNPlay, BPMint),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "RecNPlay";
 	// sectionCpp0
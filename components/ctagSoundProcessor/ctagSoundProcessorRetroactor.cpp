@@ -310,54 +310,33 @@ ctagSoundProcessorRetroactor::~ctagSoundProcessorRetroactor()
 void ctagSoundProcessorRetroactor::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("MasterPitch", [&](const int val){ MasterPitch = val;});
-	pMapCv.emplace("MasterPitch", [&](const int val){ cv_MasterPitch = val;});
-	pMapPar.emplace("MasterTune", [&](const int val){ MasterTune = val;});
-	pMapCv.emplace("MasterTune", [&](const int val){ cv_MasterTune = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("PitchSineA", [&](const int val){ PitchSineA = val;});
-	pMapCv.emplace("PitchSineA", [&](const int val){ cv_PitchSineA = val;});
-	pMapPar.emplace("FrequSineA", [&](const int val){ FrequSineA = val;});
-	pMapCv.emplace("FrequSineA", [&](const int val){ cv_FrequSineA = val;});
-	pMapPar.emplace("SineBisDistorted", [&](const int val){ SineBisDistorted = val;});
-	pMapTrig.emplace("SineBisDistorted", [&](const int val){ trig_SineBisDistorted = val;});
-	pMapPar.emplace("PitchSineB", [&](const int val){ PitchSineB = val;});
-	pMapCv.emplace("PitchSineB", [&](const int val){ cv_PitchSineB = val;});
-	pMapPar.emplace("FrequSineB", [&](const int val){ FrequSineB = val;});
-	pMapCv.emplace("FrequSineB", [&](const int val){ cv_FrequSineB = val;});
-	pMapPar.emplace("ResetFeedbackLoop", [&](const int val){ ResetFeedbackLoop = val;});
-	pMapTrig.emplace("ResetFeedbackLoop", [&](const int val){ trig_ResetFeedbackLoop = val;});
-	pMapPar.emplace("CombCut", [&](const int val){ CombCut = val;});
-	pMapCv.emplace("CombCut", [&](const int val){ cv_CombCut = val;});
-	pMapPar.emplace("CombRes", [&](const int val){ CombRes = val;});
-	pMapCv.emplace("CombRes", [&](const int val){ cv_CombRes = val;});
-	pMapPar.emplace("CombTone", [&](const int val){ CombTone = val;});
-	pMapCv.emplace("CombTone", [&](const int val){ cv_CombTone = val;});
-	pMapPar.emplace("LadderCut", [&](const int val){ LadderCut = val;});
-	pMapCv.emplace("LadderCut", [&](const int val){ cv_LadderCut = val;});
-	pMapPar.emplace("LadderRes", [&](const int val){ LadderRes = val;});
-	pMapCv.emplace("LadderRes", [&](const int val){ cv_LadderRes = val;});
-	pMapPar.emplace("VintageFilter", [&](const int val){ VintageFilter = val;});
-	pMapTrig.emplace("VintageFilter", [&](const int val){ trig_VintageFilter = val;});
-	pMapPar.emplace("WavefolderAmount", [&](const int val){ WavefolderAmount = val;});
-	pMapCv.emplace("WavefolderAmount", [&](const int val){ cv_WavefolderAmount = val;});
-	pMapPar.emplace("IsolateFeedback", [&](const int val){ IsolateFeedback = val;});
-	pMapTrig.emplace("IsolateFeedback", [&](const int val){ trig_IsolateFeedback = val;});
-	pMapPar.emplace("SineDisable", [&](const int val){ SineDisable = val;});
-	pMapTrig.emplace("SineDisable", [&](const int val){ trig_SineDisable = val;});
-	pMapPar.emplace("VolSineBoost", [&](const int val){ VolSineBoost = val;});
-	pMapCv.emplace("VolSineBoost", [&](const int val){ cv_VolSineBoost = val;});
-	pMapPar.emplace("VolSineA", [&](const int val){ VolSineA = val;});
-	pMapCv.emplace("VolSineA", [&](const int val){ cv_VolSineA = val;});
-	pMapPar.emplace("VolSineB", [&](const int val){ VolSineB = val;});
-	pMapCv.emplace("VolSineB", [&](const int val){ cv_VolSineB = val;});
-	pMapPar.emplace("SineMix", [&](const int val){ SineMix = val;});
-	pMapCv.emplace("SineMix", [&](const int val){ cv_SineMix = val;});
-	pMapPar.emplace("VolFeedbackLoop", [&](const int val){ VolFeedbackLoop = val;});
-	pMapCv.emplace("VolFeedbackLoop", [&](const int val){ cv_VolFeedbackLoop = val;});
-	pMapPar.emplace("VolWavefolder", [&](const int val){ VolWavefolder = val;});
-	pMapCv.emplace("VolWavefolder", [&](const int val){ cv_VolWavefolder = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, MasterPitch),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, MasterTune),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, Volume),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, PitchSineA),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, FrequSineA),
+		MK_PARAM_BOOL(ctagSoundProcessorRetroactor, SineBisDistorted),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, PitchSineB),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, FrequSineB),
+		MK_PARAM_BOOL(ctagSoundProcessorRetroactor, ResetFeedbackLoop),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, CombCut),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, CombRes),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, CombTone),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, LadderCut),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, LadderRes),
+		MK_PARAM_BOOL(ctagSoundProcessorRetroactor, VintageFilter),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, WavefolderAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorRetroactor, IsolateFeedback),
+		MK_PARAM_BOOL(ctagSoundProcessorRetroactor, SineDisable),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, VolSineBoost),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, VolSineA),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, VolSineB),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, SineMix),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, VolFeedbackLoop),
+		MK_PARAM_INT(ctagSoundProcessorRetroactor, VolWavefolder),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "Retroactor";
 	// sectionCpp0
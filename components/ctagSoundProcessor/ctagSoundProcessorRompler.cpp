@@ -187,72 +187,42 @@ ctagSoundProcessorRompler::~ctagSoundProcessorRompler() {
 void ctagSoundProcessorRompler::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("gain", [&](const int val){ gain = val;});
-	pMapCv.emplace("gain", [&](const int val){ cv_gain = val;});
-    pMapPar.emplace("brr", [&](const int val){ brr = val;});
-    pMapCv.emplace("brr", [&](const int val){ cv_brr = val;});
-	pMapPar.emplace("gate", [&](const int val){ gate = val;});
-	pMapTrig.emplace("gate", [&](const int val){ trig_gate = val;});
-	pMapPar.emplace("latch", [&](const int val){ latch = val;});
-	pMapTrig.emplace("latch", [&](const int val){ trig_latch = val;});
-	pMapPar.emplace("bank", [&](const int val){ bank = val;});
-	pMapCv.emplace("bank", [&](const int val){ cv_bank = val;});
-	pMapPar.emplace("slice", [&](const int val){ slice = val;});
-	pMapCv.emplace("slice", [&](const int val){ cv_slice = val;});
-    pMapPar.emplace("slontrg", [&](const int val){ slontrg = val;});
-    pMapTrig.emplace("slontrg", [&](const int val){ trig_slontrg = val;});
-	pMapPar.emplace("skpwt", [&](const int val){ skpwt = val;});
-	pMapTrig.emplace("skpwt", [&](const int val){ trig_skpwt = val;});
-	pMapPar.emplace("speed", [&](const int val){ speed = val;});
-	pMapCv.emplace("speed", [&](const int val){ cv_speed = val;});
-	pMapPar.emplace("pitch", [&](const int val){ pitch = val;});
-	pMapCv.emplace("pitch", [&](const int val){ cv_pitch = val;});
-	pMapPar.emplace("tune", [&](const int val){ tune = val;});
-	pMapCv.emplace("tune", [&](const int val){ cv_tune = val;});
-	pMapPar.emplace("start", [&](const int val){ start = val;});
-	pMapCv.emplace("start", [&](const int val){ cv_start = val;});
-	pMapPar.emplace("length", [&](const int val){ length = val;});
-	pMapCv.emplace("length", [&](const int val){ cv_length = val;});
-	pMapPar.emplace("duo", [&](const int val){ duo = val;});
-	pMapTrig.emplace("duo", [&](const int val){ trig_duo = val;});
-	pMapPar.emplace("loop", [&](const int val){ loop = val;});
-	pMapTrig.emplace("loop", [&](const int val){ trig_loop = val;});
-	pMapPar.emplace("looppipo", [&](const int val){ looppipo = val;});
-	pMapTrig.emplace("looppipo", [&](const int val){ trig_looppipo = val;});
-	pMapPar.emplace("lpstart", [&](const int val){ lpstart = val;});
-	pMapCv.emplace("lpstart", [&](const int val){ cv_lpstart = val;});
-	pMapPar.emplace("fmode", [&](const int val){ fmode = val;});
-	pMapCv.emplace("fmode", [&](const int val){ cv_fmode = val;});
-	pMapPar.emplace("fcut", [&](const int val){ fcut = val;});
-	pMapCv.emplace("fcut", [&](const int val){ cv_fcut = val;});
-	pMapPar.emplace("freso", [&](const int val){ freso = val;});
-	pMapCv.emplace("freso", [&](const int val){ cv_freso = val;});
-	pMapPar.emplace("lfo2am", [&](const int val){ lfo2am = val;});
-	pMapCv.emplace("lfo2am", [&](const int val){ cv_lfo2am = val;});
-	pMapPar.emplace("lfo2fm", [&](const int val){ lfo2fm = val;});
-	pMapCv.emplace("lfo2fm", [&](const int val){ cv_lfo2fm = val;});
-	pMapPar.emplace("lfo2filtfm", [&](const int val){ lfo2filtfm = val;});
-	pMapCv.emplace("lfo2filtfm", [&](const int val){ cv_lfo2filtfm = val;});
-	pMapPar.emplace("eg2am", [&](const int val){ eg2am = val;});
-	pMapCv.emplace("eg2am", [&](const int val){ cv_eg2am = val;});
-	pMapPar.emplace("eg2fm", [&](const int val){ eg2fm = val;});
-	pMapCv.emplace("eg2fm", [&](const int val){ cv_eg2fm = val;});
-	pMapPar.emplace("eg2filtfm", [&](const int val){ eg2filtfm = val;});
-	pMapCv.emplace("eg2filtfm", [&](const int val){ cv_eg2filtfm = val;});
-	pMapPar.emplace("lfospeed", [&](const int val){ lfospeed = val;});
-	pMapCv.emplace("lfospeed", [&](const int val){ cv_lfospeed = val;});
-	pMapPar.emplace("egfasl", [&](const int val){ egfasl = val;});
-	pMapTrig.emplace("egfasl", [&](const int val){ trig_egfasl = val;});
-	pMapPar.emplace("attack", [&](const int val){ attack = val;});
-	pMapCv.emplace("attack", [&](const int val){ cv_attack = val;});
-	pMapPar.emplace("decay", [&](const int val){ decay = val;});
-	pMapCv.emplace("decay", [&](const int val){ cv_decay = val;});
-	pMapPar.emplace("sustain", [&](const int val){ sustain = val;});
-	pMapCv.emplace("sustain", [&](const int val){ cv_sustain = val;});
-	pMapPar.emplace("release", [&](const int val){ release = val;});
-	pMapCv.emplace("release", [&](const int val){ cv_release = val;});
-	pMapPar.emplace("egstop", [&](const int val){ egstop = val;});
-	pMapTrig.emplace("egstop", [&](const int val){ trig_egstop = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorRompler, gain),
+		MK_PARAM_INT(ctagSoundProcessorRompler, brr),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, gate),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, latch),
+		MK_PARAM_INT(ctagSoundProcessorRompler, bank),
+		MK_PARAM_INT(ctagSoundProcessorRompler, slice),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, slontrg),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, skpwt),
+		MK_PARAM_INT(ctagSoundProcessorRompler, speed),
+		MK_PARAM_INT(ctagSoundProcessorRompler, pitch),
+		MK_PARAM_INT(ctagSoundProcessorRompler, tune),
+		MK_PARAM_INT(ctagSoundProcessorRompler, start),
+		MK_PARAM_INT(ctagSoundProcessorRompler, length),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, duo),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, loop),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, looppipo),
+		MK_PARAM_INT(ctagSoundProcessorRompler, lpstart),
+		MK_PARAM_INT(ctagSoundProcessorRompler, fmode),
+		MK_PARAM_INT(ctagSoundProcessorRompler, fcut),
+		MK_PARAM_INT(ctagSoundProcessorRompler, freso),
+		MK_PARAM_INT(ctagSoundProcessorRompler, lfo2am),
+		MK_PARAM_INT(ctagSoundProcessorRompler, lfo2fm),
+		MK_PARAM_INT(ctagSoundProcessorRompler, lfo2filtfm),
+		MK_PARAM_INT(ctagSoundProcessorRompler, eg2am),
+		MK_PARAM_INT(ctagSoundProcessorRompler, eg2fm),
+		MK_PARAM_INT(ctagSoundProcessorRompler, eg2filtfm),
+		MK_PARAM_INT(ctagSoundProcessorRompler, lfospeed),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, egfasl),
+		MK_PARAM_INT(ctagSoundProcessorRompler, attack),
+		MK_PARAM_INT(ctagSoundProcessorRompler, decay),
+		MK_PARAM_INT(ctagSoundProcessorRompler, sustain),
+		MK_PARAM_INT(ctagSoundProcessorRompler, release),
+		MK_PARAM_BOOL(ctagSoundProcessorRompler, egstop),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "Rompler";
 	// sectionCpp0
@@ -39,7 +39,7 @@ namespace CTAG {
         private:
             virtual void knowYourself() override;
             RomplerVoice romplers[2];
-            float out[32];
+            float out[bufSz];
             bool preGate = false;
             bool bGate2 = false;
             bool preGateLatch = false;
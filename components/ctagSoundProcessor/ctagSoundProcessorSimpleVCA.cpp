@@ -47,8 +47,10 @@ ctagSoundProcessorSimpleVCA::~ctagSoundProcessorSimpleVCA() {
 
 void ctagSoundProcessorSimpleVCA::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("loudness", [&](const int val) { loudness = val; });
-    pMapCv.emplace("loudness", [&](const int val) { cv_loudness = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorSimpleVCA, loudness),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "SimpleVCA";
     // sectionCpp0
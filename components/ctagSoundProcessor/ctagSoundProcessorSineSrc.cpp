@@ -125,28 +125,20 @@ void ctagSoundProcessorSineSrc::Process(const ProcessData &data) {
 
 void ctagSoundProcessorSineSrc::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("frequency", [&](const int val) { frequency = val; });
-    pMapCv.emplace("frequency", [&](const int val) { cv_frequency = val; });
-    pMapPar.emplace("loudness", [&](const int val) { loudness = val; });
-    pMapCv.emplace("loudness", [&](const int val) { cv_loudness = val; });
-    pMapPar.emplace("enableEG", [&](const int val) { enableEG = val; });
-    pMapTrig.emplace("enableEG", [&](const int val) { trig_enableEG = val; });
-    pMapPar.emplace("loopEG", [&](const int val) { loopEG = val; });
-    pMapTrig.emplace("loopEG", [&](const int val) { trig_loopEG = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
-    pMapPar.emplace("enableEG_p", [&](const int val) { enableEG_p = val; });
-    pMapTrig.emplace("enableEG_p", [&](const int val) { trig_enableEG_p = val; });
-    pMapPar.emplace("loopEG_p", [&](const int val) { loopEG_p = val; });
-    pMapTrig.emplace("loopEG_p", [&](const int val) { trig_loopEG_p = val; });
-    pMapPar.emplace("amount_p", [&](const int val) { amount_p = val; });
-    pMapCv.emplace("amount_p", [&](const int val) { cv_amount_p = val; });
-    pMapPar.emplace("attack_p", [&](const int val) { attack_p = val; });
-    pMapCv.emplace("attack_p", [&](const int val) { cv_attack_p = val; });
-    pMapPar.emplace("decay_p", [&](const int val) { decay_p = val; });
-    pMapCv.emplace("decay_p", [&](const int val) { cv_decay_p = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, frequency),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, loudness),
+        MK_PARAM_BOOL(ctagSoundProcessorSineSrc, enableEG),
+        MK_PARAM_BOOL(ctagSoundProcessorSineSrc, loopEG),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, attack),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, decay),
+        MK_PARAM_BOOL(ctagSoundProcessorSineSrc, enableEG_p),
+        MK_PARAM_BOOL(ctagSoundProcessorSineSrc, loopEG_p),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, amount_p),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, attack_p),
+        MK_PARAM_INT(ctagSoundProcessorSineSrc, decay_p),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "SineSrc";
     // sectionCpp0
@@ -509,7 +509,7 @@ void ctagSoundProcessorSpaceFX::Init(std::size_t blockSize, void *blockPtr)
   eg_adsr.Reset();
 
   // --- Initialize MI Verb ---
-  reverb_buffer = (float *) heap_caps_malloc(32768 * sizeof(float), MALLOC_CAP_SPIRAM);     // MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+  reverb_buffer = (float *) ctagSPAllocator::Allocate(32768 * sizeof(float), alignof(float), ctagSPAllocator::Region::SPIRAM);
   if(!reverb_buffer)
     ESP_LOGE("MIVerb", "Could not allocate shared buffer!");
   else
@@ -553,9 +553,7 @@ void ctagSoundProcessorSpaceFX::Init(std::size_t blockSize, void *blockPtr)
 
 ctagSoundProcessorSpaceFX::~ctagSoundProcessorSpaceFX() 
 {
-    if(nullptr != reverb_buffer){
-        heap_caps_free(reverb_buffer);
-    }
+    // no explicit freeing for reverb_buffer needed, done by ctagSPAllocator
 }
 
 // --- Attach parameters from GUI ---
@@ -563,194 +561,103 @@ void ctagSoundProcessorSpaceFX::knowYourself()
 {
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("Trigger", [&](const int val){ Trigger = val;});
-	pMapTrig.emplace("Trigger", [&](const int val){ trig_Trigger = val;});
-	pMapPar.emplace("MasterPitch", [&](const int val){ MasterPitch = val;});
-	pMapCv.emplace("MasterPitch", [&](const int val){ cv_MasterPitch = val;});
-	pMapPar.emplace("MasterTune", [&](const int val){ MasterTune = val;});
-	pMapCv.emplace("MasterTune", [&](const int val){ cv_MasterTune = val;});
-	pMapPar.emplace("FilterTracking", [&](const int val){ FilterTracking = val;});
-	pMapCv.emplace("FilterTracking", [&](const int val){ cv_FilterTracking = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("EnableNoise", [&](const int val){ EnableNoise = val;});
-	pMapTrig.emplace("EnableNoise", [&](const int val){ trig_EnableNoise = val;});
-	pMapPar.emplace("NoiseColour", [&](const int val){ NoiseColour = val;});
-	pMapCv.emplace("NoiseColour", [&](const int val){ cv_NoiseColour = val;});
-	pMapPar.emplace("MixedNoiseLevel", [&](const int val){ MixedNoiseLevel = val;});
-	pMapCv.emplace("MixedNoiseLevel", [&](const int val){ cv_MixedNoiseLevel = val;});
-	pMapPar.emplace("EnableNoiseMod", [&](const int val){ EnableNoiseMod = val;});
-	pMapTrig.emplace("EnableNoiseMod", [&](const int val){ trig_EnableNoiseMod = val;});
-	pMapPar.emplace("NoiseColourModSpeed", [&](const int val){ NoiseColourModSpeed = val;});
-	pMapCv.emplace("NoiseColourModSpeed", [&](const int val){ cv_NoiseColourModSpeed = val;});
-	pMapPar.emplace("NoiseColourModAmount", [&](const int val){ NoiseColourModAmount = val;});
-	pMapCv.emplace("NoiseColourModAmount", [&](const int val){ cv_NoiseColourModAmount = val;});
-	pMapPar.emplace("NoiseLevelModSpeed", [&](const int val){ NoiseLevelModSpeed = val;});
-	pMapCv.emplace("NoiseLevelModSpeed", [&](const int val){ cv_NoiseLevelModSpeed = val;});
-	pMapPar.emplace("NoiseLevelModAmount", [&](const int val){ NoiseLevelModAmount = val;});
-	pMapCv.emplace("NoiseLevelModAmount", [&](const int val){ cv_NoiseLevelModAmount = val;});
-	pMapPar.emplace("PitchToCutoff", [&](const int val){ PitchToCutoff = val;});
-	pMapTrig.emplace("PitchToCutoff", [&](const int val){ trig_PitchToCutoff = val;});
-	pMapPar.emplace("Cutoff", [&](const int val){ Cutoff = val;});
-	pMapCv.emplace("Cutoff", [&](const int val){ cv_Cutoff = val;});
-	pMapPar.emplace("Resonance", [&](const int val){ Resonance = val;});
-	pMapCv.emplace("Resonance", [&](const int val){ cv_Resonance = val;});
-	pMapPar.emplace("VintageResonance", [&](const int val){ VintageResonance = val;});
-	pMapTrig.emplace("VintageResonance", [&](const int val){ trig_VintageResonance = val;});
-	pMapPar.emplace("CutoffModulationAmount", [&](const int val){ CutoffModulationAmount = val;});
-	pMapCv.emplace("CutoffModulationAmount", [&](const int val){ cv_CutoffModulationAmount = val;});
-	pMapPar.emplace("ResonanceModulationAmount", [&](const int val){ ResonanceModulationAmount = val;});
-	pMapCv.emplace("ResonanceModulationAmount", [&](const int val){ cv_ResonanceModulationAmount = val;});
-	pMapPar.emplace("AmplitudeModulationAmount", [&](const int val){ AmplitudeModulationAmount = val;});
-	pMapCv.emplace("AmplitudeModulationAmount", [&](const int val){ cv_AmplitudeModulationAmount = val;});
-	pMapPar.emplace("ADenvEnable", [&](const int val){ ADenvEnable = val;});
-	pMapTrig.emplace("ADenvEnable", [&](const int val){ trig_ADenvEnable = val;});
-	pMapPar.emplace("ADenvToVCA", [&](const int val){ ADenvToVCA = val;});
-	pMapTrig.emplace("ADenvToVCA", [&](const int val){ trig_ADenvToVCA = val;});
-	pMapPar.emplace("ADattack", [&](const int val){ ADattack = val;});
-	pMapCv.emplace("ADattack", [&](const int val){ cv_ADattack = val;});
-	pMapPar.emplace("ADdecay", [&](const int val){ ADdecay = val;});
-	pMapCv.emplace("ADdecay", [&](const int val){ cv_ADdecay = val;});
-	pMapPar.emplace("ADegLoop", [&](const int val){ ADegLoop = val;});
-	pMapTrig.emplace("ADegLoop", [&](const int val){ trig_ADegLoop = val;});
-	pMapPar.emplace("ADenvNegative", [&](const int val){ ADenvNegative = val;});
-	pMapTrig.emplace("ADenvNegative", [&](const int val){ trig_ADenvNegative = val;});
-	pMapPar.emplace("ADenvelopeCutoffAmount", [&](const int val){ ADenvelopeCutoffAmount = val;});
-	pMapCv.emplace("ADenvelopeCutoffAmount", [&](const int val){ cv_ADenvelopeCutoffAmount = val;});
-	pMapPar.emplace("ADenvelopeResonanceAmount", [&](const int val){ ADenvelopeResonanceAmount = val;});
-	pMapCv.emplace("ADenvelopeResonanceAmount", [&](const int val){ cv_ADenvelopeResonanceAmount = val;});
-	pMapPar.emplace("ADtoSawLFOfrequ", [&](const int val){ ADtoSawLFOfrequ = val;});
-	pMapTrig.emplace("ADtoSawLFOfrequ", [&](const int val){ trig_ADtoSawLFOfrequ = val;});
-	pMapPar.emplace("ADtoSawSpeedLevel", [&](const int val){ ADtoSawSpeedLevel = val;});
-	pMapCv.emplace("ADtoSawSpeedLevel", [&](const int val){ cv_ADtoSawSpeedLevel = val;});
-	pMapPar.emplace("ADSRenvEnable", [&](const int val){ ADSRenvEnable = val;});
-	pMapTrig.emplace("ADSRenvEnable", [&](const int val){ trig_ADSRenvEnable = val;});
-	pMapPar.emplace("ADSRenvToVCA", [&](const int val){ ADSRenvToVCA = val;});
-	pMapTrig.emplace("ADSRenvToVCA", [&](const int val){ trig_ADSRenvToVCA = val;});
-	pMapPar.emplace("ADSRattack", [&](const int val){ ADSRattack = val;});
-	pMapCv.emplace("ADSRattack", [&](const int val){ cv_ADSRattack = val;});
-	pMapPar.emplace("ADSRdecay", [&](const int val){ ADSRdecay = val;});
-	pMapCv.emplace("ADSRdecay", [&](const int val){ cv_ADSRdecay = val;});
-	pMapPar.emplace("ADSRsustain", [&](const int val){ ADSRsustain = val;});
-	pMapCv.emplace("ADSRsustain", [&](const int val){ cv_ADSRsustain = val;});
-	pMapPar.emplace("ADSRrelease", [&](const int val){ ADSRrelease = val;});
-	pMapCv.emplace("ADSRrelease", [&](const int val){ cv_ADSRrelease = val;});
-	pMapPar.emplace("ADSRenvNegative", [&](const int val){ ADSRenvNegative = val;});
-	pMapTrig.emplace("ADSRenvNegative", [&](const int val){ trig_ADSRenvNegative = val;});
-	pMapPar.emplace("ADSRenvelopeCutoffAmount", [&](const int val){ ADSRenvelopeCutoffAmount = val;});
-	pMapCv.emplace("ADSRenvelopeCutoffAmount", [&](const int val){ cv_ADSRenvelopeCutoffAmount = val;});
-	pMapPar.emplace("ADSRenvelopeResonanceAmount", [&](const int val){ ADSRenvelopeResonanceAmount = val;});
-	pMapCv.emplace("ADSRenvelopeResonanceAmount", [&](const int val){ cv_ADSRenvelopeResonanceAmount = val;});
-	pMapPar.emplace("ADSRtoSineLFOfrequ", [&](const int val){ ADSRtoSineLFOfrequ = val;});
-	pMapTrig.emplace("ADSRtoSineLFOfrequ", [&](const int val){ trig_ADSRtoSineLFOfrequ = val;});
-	pMapPar.emplace("ADSRtoSineSpeedLevel", [&](const int val){ ADSRtoSineSpeedLevel = val;});
-	pMapCv.emplace("ADSRtoSineSpeedLevel", [&](const int val){ cv_ADSRtoSineSpeedLevel = val;});
-	pMapPar.emplace("SnH1Enable", [&](const int val){ SnH1Enable = val;});
-	pMapTrig.emplace("SnH1Enable", [&](const int val){ trig_SnH1Enable = val;});
-	pMapPar.emplace("SnH1Freq", [&](const int val){ SnH1Freq = val;});
-	pMapCv.emplace("SnH1Freq", [&](const int val){ cv_SnH1Freq = val;});
-	pMapPar.emplace("SnH1CutoffLevel", [&](const int val){ SnH1CutoffLevel = val;});
-	pMapCv.emplace("SnH1CutoffLevel", [&](const int val){ cv_SnH1CutoffLevel = val;});
-	pMapPar.emplace("SnH1ResonanceLevel", [&](const int val){ SnH1ResonanceLevel = val;});
-	pMapCv.emplace("SnH1ResonanceLevel", [&](const int val){ cv_SnH1ResonanceLevel = val;});
-	pMapPar.emplace("SnH1AMlevel", [&](const int val){ SnH1AMlevel = val;});
-	pMapCv.emplace("SnH1AMlevel", [&](const int val){ cv_SnH1AMlevel = val;});
-	pMapPar.emplace("SnH1FrequSnH2Change", [&](const int val){ SnH1FrequSnH2Change = val;});
-	pMapCv.emplace("SnH1FrequSnH2Change", [&](const int val){ cv_SnH1FrequSnH2Change = val;});
-	pMapPar.emplace("SnH1FrequSquareChange", [&](const int val){ SnH1FrequSquareChange = val;});
-	pMapCv.emplace("SnH1FrequSquareChange", [&](const int val){ cv_SnH1FrequSquareChange = val;});
-	pMapPar.emplace("SnH1ADattackChange", [&](const int val){ SnH1ADattackChange = val;});
-	pMapCv.emplace("SnH1ADattackChange", [&](const int val){ cv_SnH1ADattackChange = val;});
-	pMapPar.emplace("SnH2Enable", [&](const int val){ SnH2Enable = val;});
-	pMapTrig.emplace("SnH2Enable", [&](const int val){ trig_SnH2Enable = val;});
-	pMapPar.emplace("SnH2Freq", [&](const int val){ SnH2Freq = val;});
-	pMapCv.emplace("SnH2Freq", [&](const int val){ cv_SnH2Freq = val;});
-	pMapPar.emplace("SnH2CutoffLevel", [&](const int val){ SnH2CutoffLevel = val;});
-	pMapCv.emplace("SnH2CutoffLevel", [&](const int val){ cv_SnH2CutoffLevel = val;});
-	pMapPar.emplace("SnH2ResonanceLevel", [&](const int val){ SnH2ResonanceLevel = val;});
-	pMapCv.emplace("SnH2ResonanceLevel", [&](const int val){ cv_SnH2ResonanceLevel = val;});
-	pMapPar.emplace("SnH2AMlevel", [&](const int val){ SnH2AMlevel = val;});
-	pMapCv.emplace("SnH2AMlevel", [&](const int val){ cv_SnH2AMlevel = val;});
-	pMapPar.emplace("SnH2FrequSnH1Change", [&](const int val){ SnH2FrequSnH1Change = val;});
-	pMapCv.emplace("SnH2FrequSnH1Change", [&](const int val){ cv_SnH2FrequSnH1Change = val;});
-	pMapPar.emplace("SnH2FrequPulseChange", [&](const int val){ SnH2FrequPulseChange = val;});
-	pMapCv.emplace("SnH2FrequPulseChange", [&](const int val){ cv_SnH2FrequPulseChange = val;});
-	pMapPar.emplace("SnH2ADdecayChange", [&](const int val){ SnH2ADdecayChange = val;});
-	pMapCv.emplace("SnH2ADdecayChange", [&](const int val){ cv_SnH2ADdecayChange = val;});
-	pMapPar.emplace("SineEnable", [&](const int val){ SineEnable = val;});
-	pMapTrig.emplace("SineEnable", [&](const int val){ trig_SineEnable = val;});
-	pMapPar.emplace("SineFreq", [&](const int val){ SineFreq = val;});
-	pMapCv.emplace("SineFreq", [&](const int val){ cv_SineFreq = val;});
-	pMapPar.emplace("SineCutoffAmount", [&](const int val){ SineCutoffAmount = val;});
-	pMapCv.emplace("SineCutoffAmount", [&](const int val){ cv_SineCutoffAmount = val;});
-	pMapPar.emplace("SineResonanceAmount", [&](const int val){ SineResonanceAmount = val;});
-	pMapCv.emplace("SineResonanceAmount", [&](const int val){ cv_SineResonanceAmount = val;});
-	pMapPar.emplace("SineAMamount", [&](const int val){ SineAMamount = val;});
-	pMapCv.emplace("SineAMamount", [&](const int val){ cv_SineAMamount = val;});
-	pMapPar.emplace("PulseEnable", [&](const int val){ PulseEnable = val;});
-	pMapTrig.emplace("PulseEnable", [&](const int val){ trig_PulseEnable = val;});
-	pMapPar.emplace("PulseFreq", [&](const int val){ PulseFreq = val;});
-	pMapCv.emplace("PulseFreq", [&](const int val){ cv_PulseFreq = val;});
-	pMapPar.emplace("PulseWidth", [&](const int val){ PulseWidth = val;});
-	pMapCv.emplace("PulseWidth", [&](const int val){ cv_PulseWidth = val;});
-	pMapPar.emplace("PWMspeed", [&](const int val){ PWMspeed = val;});
-	pMapCv.emplace("PWMspeed", [&](const int val){ cv_PWMspeed = val;});
-	pMapPar.emplace("PWMamount", [&](const int val){ PWMamount = val;});
-	pMapCv.emplace("PWMamount", [&](const int val){ cv_PWMamount = val;});
-	pMapPar.emplace("PulseCutoffAmount", [&](const int val){ PulseCutoffAmount = val;});
-	pMapCv.emplace("PulseCutoffAmount", [&](const int val){ cv_PulseCutoffAmount = val;});
-	pMapPar.emplace("PulseResonanceAmount", [&](const int val){ PulseResonanceAmount = val;});
-	pMapCv.emplace("PulseResonanceAmount", [&](const int val){ cv_PulseResonanceAmount = val;});
-	pMapPar.emplace("PulseAMamount", [&](const int val){ PulseAMamount = val;});
-	pMapCv.emplace("PulseAMamount", [&](const int val){ cv_PulseAMamount = val;});
-	pMapPar.emplace("SawEnable", [&](const int val){ SawEnable = val;});
-	pMapTrig.emplace("SawEnable", [&](const int val){ trig_SawEnable = val;});
-	pMapPar.emplace("SawFreq", [&](const int val){ SawFreq = val;});
-	pMapCv.emplace("SawFreq", [&](const int val){ cv_SawFreq = val;});
-	pMapPar.emplace("SawCutoffAmount", [&](const int val){ SawCutoffAmount = val;});
-	pMapCv.emplace("SawCutoffAmount", [&](const int val){ cv_SawCutoffAmount = val;});
-	pMapPar.emplace("SawResonanceAmount", [&](const int val){ SawResonanceAmount = val;});
-	pMapCv.emplace("SawResonanceAmount", [&](const int val){ cv_SawResonanceAmount = val;});
-	pMapPar.emplace("SawAMamount", [&](const int val){ SawAMamount = val;});
-	pMapCv.emplace("SawAMamount", [&](const int val){ cv_SawAMamount = val;});
-	pMapPar.emplace("SquareEnable", [&](const int val){ SquareEnable = val;});
-	pMapTrig.emplace("SquareEnable", [&](const int val){ trig_SquareEnable = val;});
-	pMapPar.emplace("SquareFreq", [&](const int val){ SquareFreq = val;});
-	pMapCv.emplace("SquareFreq", [&](const int val){ cv_SquareFreq = val;});
-	pMapPar.emplace("SquareCutoffAmount", [&](const int val){ SquareCutoffAmount = val;});
-	pMapCv.emplace("SquareCutoffAmount", [&](const int val){ cv_SquareCutoffAmount = val;});
-	pMapPar.emplace("SquareResonanceAmount", [&](const int val){ SquareResonanceAmount = val;});
-	pMapCv.emplace("SquareResonanceAmount", [&](const int val){ cv_SquareResonanceAmount = val;});
-	pMapPar.emplace("SquareAMamount", [&](const int val){ SquareAMamount = val;});
-	pMapCv.emplace("SquareAMamount", [&](const int val){ cv_SquareAMamount = val;});
-	pMapPar.emplace("DelayEnable", [&](const int val){ DelayEnable = val;});
-	pMapTrig.emplace("DelayEnable", [&](const int val){ trig_DelayEnable = val;});
-	pMapPar.emplace("DelayTimeShortened", [&](const int val){ DelayTimeShortened = val;});
-	pMapTrig.emplace("DelayTimeShortened", [&](const int val){ trig_DelayTimeShortened = val;});
-	pMapPar.emplace("DelayTime", [&](const int val){ DelayTime = val;});
-	pMapCv.emplace("DelayTime", [&](const int val){ cv_DelayTime = val;});
-	pMapPar.emplace("DelayFeedback", [&](const int val){ DelayFeedback = val;});
-	pMapCv.emplace("DelayFeedback", [&](const int val){ cv_DelayFeedback = val;});
-	pMapPar.emplace("DelayDryWet", [&](const int val){ DelayDryWet = val;});
-	pMapCv.emplace("DelayDryWet", [&](const int val){ cv_DelayDryWet = val;});
-	pMapPar.emplace("ReverbEnable", [&](const int val){ ReverbEnable = val;});
-	pMapTrig.emplace("ReverbEnable", [&](const int val){ trig_ReverbEnable = val;});
-	pMapPar.emplace("ReverbIsMono", [&](const int val){ ReverbIsMono = val;});
-	pMapTrig.emplace("ReverbIsMono", [&](const int val){ trig_ReverbIsMono = val;});
-	pMapPar.emplace("RevInputGain", [&](const int val){ RevInputGain = val;});
-	pMapCv.emplace("RevInputGain", [&](const int val){ cv_RevInputGain = val;});
-	pMapPar.emplace("RevDiffusion", [&](const int val){ RevDiffusion = val;});
-	pMapCv.emplace("RevDiffusion", [&](const int val){ cv_RevDiffusion = val;});
-	pMapPar.emplace("RevTime", [&](const int val){ RevTime = val;});
-	pMapCv.emplace("RevTime", [&](const int val){ cv_RevTime = val;});
-	pMapPar.emplace("RevLowpass", [&](const int val){ RevLowpass = val;});
-	pMapCv.emplace("RevLowpass", [&](const int val){ cv_RevLowpass = val;});
-	pMapPar.emplace("RevLFO1", [&](const int val){ RevLFO1 = val;});
-	pMapCv.emplace("RevLFO1", [&](const int val){ cv_RevLFO1 = val;});
-	pMapPar.emplace("RevLFO2", [&](const int val){ RevLFO2 = val;});
-	pMapCv.emplace("RevLFO2", [&](const int val){ cv_RevLFO2 = val;});
-	pMapPar.emplace("RevAmount", [&](const int val){ RevAmount = val;});
-	pMapCv.emplace("RevAmount", [&](const int val){ cv_RevAmount = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, Trigger),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, MasterPitch),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, MasterTune),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, FilterTracking),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, Volume),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, EnableNoise),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, NoiseColour),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, MixedNoiseLevel),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, EnableNoiseMod),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, NoiseColourModSpeed),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, NoiseColourModAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, NoiseLevelModSpeed),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, NoiseLevelModAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, PitchToCutoff),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, Cutoff),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, Resonance),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, VintageResonance),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, CutoffModulationAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ResonanceModulationAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, AmplitudeModulationAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADenvEnable),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADenvToVCA),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADattack),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADdecay),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADegLoop),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADenvNegative),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADenvelopeCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADenvelopeResonanceAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADtoSawLFOfrequ),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADtoSawSpeedLevel),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADSRenvEnable),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADSRenvToVCA),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRattack),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRdecay),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRsustain),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRrelease),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADSRenvNegative),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRenvelopeCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRenvelopeResonanceAmount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ADSRtoSineLFOfrequ),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, ADSRtoSineSpeedLevel),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, SnH1Enable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1Freq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1CutoffLevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1ResonanceLevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1AMlevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1FrequSnH2Change),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1FrequSquareChange),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH1ADattackChange),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, SnH2Enable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2Freq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2CutoffLevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2ResonanceLevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2AMlevel),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2FrequSnH1Change),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2FrequPulseChange),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SnH2ADdecayChange),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, SineEnable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SineFreq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SineCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SineResonanceAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SineAMamount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, PulseEnable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PulseFreq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PulseWidth),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PWMspeed),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PWMamount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PulseCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PulseResonanceAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, PulseAMamount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, SawEnable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SawFreq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SawCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SawResonanceAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SawAMamount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, SquareEnable),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SquareFreq),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SquareCutoffAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SquareResonanceAmount),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, SquareAMamount),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, DelayEnable),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, DelayTimeShortened),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, DelayTime),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, DelayFeedback),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, DelayDryWet),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ReverbEnable),
+		MK_PARAM_BOOL(ctagSoundProcessorSpaceFX, ReverbIsMono),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevInputGain),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevDiffusion),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevTime),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevLowpass),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevLFO1),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevLFO2),
+		MK_PARAM_INT(ctagSoundProcessorSpaceFX, RevAmount),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "SpaceFX";
 	// sectionCpp0
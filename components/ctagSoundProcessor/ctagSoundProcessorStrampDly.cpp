@@ -21,9 +21,9 @@ respective component folders / files if different from this license.
 
 
 #include "ctagSoundProcessorStrampDly.hpp"
-#include "esp_heap_caps.h"
 #include <iostream>
 #include <cmath>
+#include <cstring>
 #include "helpers/ctagFastMath.hpp"
 #include "esp_log.h"
 
@@ -40,13 +40,17 @@ void ctagSoundProcessorStrampDly::Init(std::size_t blockSize, void *blockPtr) {
     msLength = length;
     sampleRate = 44100.f;
     bufLen = ceilf(sampleRate * msMaxLength / 1000.0);
-    bufL = (float *) heap_caps_calloc(bufLen, sizeof(float), MALLOC_CAP_SPIRAM); // mono
+    bufL = (float *) ctagSPAllocator::Allocate(bufLen * sizeof(float), alignof(float), ctagSPAllocator::Region::SPIRAM); // mono
     if (bufL == NULL) {
         ESP_LOGE("DELAY", "Could not allocate memory --> delay buffer!");
+    } else {
+        memset(bufL, 0, bufLen * sizeof(float));
     }
-    bufR = (float *) heap_caps_calloc(bufLen, sizeof(float), MALLOC_CAP_SPIRAM); // mono
+    bufR = (float *) ctagSPAllocator::Allocate(bufLen * sizeof(float), alignof(float), ctagSPAllocator::Region::SPIRAM); // mono
     if (bufR == NULL) {
         ESP_LOGE("DELAY", "Could not allocate memory --> delay buffer!");
+    } else {
+        memset(bufR, 0, bufLen * sizeof(float));
     }
     mute();
 
@@ -161,8 +165,7 @@ void ctagSoundProcessorStrampDly::Process(const ProcessData &data) {
 }
 
 ctagSoundProcessorStrampDly::~ctagSoundProcessorStrampDly() {
-    heap_caps_free(bufL);
-    heap_caps_free(bufR);
+    // no explicit freeing for bufL, bufR needed, done by ctagSPAllocator
 }
 
 void ctagSoundProcessorStrampDly::mute() {
@@ -175,24 +178,18 @@ void ctagSoundProcessorStrampDly::mute() {
 
 void ctagSoundProcessorStrampDly::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("mode", [&](const int val) { mode = val; });
-    pMapTrig.emplace("mode", [&](const int val) { trig_mode = val; });
-    pMapPar.emplace("freeze", [&](const int val) { freeze = val; });
-    pMapTrig.emplace("freeze", [&](const int val) { trig_freeze = val; });
-    pMapPar.emplace("bypass", [&](const int val) { bypass = val; });
-    pMapTrig.emplace("bypass", [&](const int val) { trig_bypass = val; });
-    pMapPar.emplace("length", [&](const int val) { length = val; });
-    pMapCv.emplace("length", [&](const int val) { cv_length = val; });
-    pMapPar.emplace("feedback", [&](const int val) { feedback = val; });
-    pMapCv.emplace("feedback", [&](const int val) { cv_feedback = val; });
-    pMapPar.emplace("pan", [&](const int val) { pan = val; });
-    pMapCv.emplace("pan", [&](const int val) { cv_pan = val; });
-    pMapPar.emplace("wvol", [&](const int val) { wvol = val; });
-    pMapCv.emplace("wvol", [&](const int val) { cv_wvol = val; });
-    pMapPar.emplace("dvol", [&](const int val) { dvol = val; });
-    pMapCv.emplace("dvol", [&](const int val) { cv_dvol = val; });
-    pMapPar.emplace("gain", [&](const int val) { gain = val; });
-    pMapCv.emplace("gain", [&](const int val) { cv_gain = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorStrampDly, mode),
+        MK_PARAM_BOOL(ctagSoundProcessorStrampDly, freeze),
+        MK_PARAM_BOOL(ctagSoundProcessorStrampDly, bypass),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, length),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, feedback),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, pan),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, wvol),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, dvol),
+        MK_PARAM_INT(ctagSoundProcessorStrampDly, gain),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "StrampDly";
     // sectionCpp0
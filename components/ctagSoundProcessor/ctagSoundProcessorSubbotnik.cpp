@@ -703,196 +703,104 @@ void ctagSoundProcessorSubbotnik::knowYourself()
 {
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("Gate", [&](const int val){ Gate = val;});
-	pMapTrig.emplace("Gate", [&](const int val){ trig_Gate = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("xFadeOscAoscB", [&](const int val){ xFadeOscAoscB = val;});
-	pMapCv.emplace("xFadeOscAoscB", [&](const int val){ cv_xFadeOscAoscB = val;});
-	pMapPar.emplace("osc_active_A", [&](const int val){ osc_active_A = val;});
-	pMapTrig.emplace("osc_active_A", [&](const int val){ trig_osc_active_A = val;});
-	pMapPar.emplace("shape_A", [&](const int val){ shape_A = val;});
-	pMapCv.emplace("shape_A", [&](const int val){ cv_shape_A = val;});
-	pMapPar.emplace("vol_A", [&](const int val){ vol_A = val;});
-	pMapCv.emplace("vol_A", [&](const int val){ cv_vol_A = val;});
-	pMapPar.emplace("pitch_A", [&](const int val){ pitch_A = val;});
-	pMapCv.emplace("pitch_A", [&](const int val){ cv_pitch_A = val;});
-	pMapPar.emplace("tune_A", [&](const int val){ tune_A = val;});
-	pMapCv.emplace("tune_A", [&](const int val){ cv_tune_A = val;});
-	pMapPar.emplace("timbre_A", [&](const int val){ timbre_A = val;});
-	pMapCv.emplace("timbre_A", [&](const int val){ cv_timbre_A = val;});
-	pMapPar.emplace("color_A", [&](const int val){ color_A = val;});
-	pMapCv.emplace("color_A", [&](const int val){ cv_color_A = val;});
-	pMapPar.emplace("xModActive_A", [&](const int val){ xModActive_A = val;});
-	pMapTrig.emplace("xModActive_A", [&](const int val){ trig_xModActive_A = val;});
-	pMapPar.emplace("am_xModB_A", [&](const int val){ am_xModB_A = val;});
-	pMapCv.emplace("am_xModB_A", [&](const int val){ cv_am_xModB_A = val;});
-	pMapPar.emplace("freqX_factor_A", [&](const int val){ freqX_factor_A = val;});
-	pMapCv.emplace("freqX_factor_A", [&](const int val){ cv_freqX_factor_A = val;});
-	pMapPar.emplace("freq_xModB_A", [&](const int val){ freq_xModB_A = val;});
-	pMapCv.emplace("freq_xModB_A", [&](const int val){ cv_freq_xModB_A = val;});
-	pMapPar.emplace("timbre_xModB_A", [&](const int val){ timbre_xModB_A = val;});
-	pMapCv.emplace("timbre_xModB_A", [&](const int val){ cv_timbre_xModB_A = val;});
-	pMapPar.emplace("color_xModB_A", [&](const int val){ color_xModB_A = val;});
-	pMapCv.emplace("color_xModB_A", [&](const int val){ cv_color_xModB_A = val;});
-	pMapPar.emplace("osc_active_B", [&](const int val){ osc_active_B = val;});
-	pMapTrig.emplace("osc_active_B", [&](const int val){ trig_osc_active_B = val;});
-	pMapPar.emplace("shape_B", [&](const int val){ shape_B = val;});
-	pMapCv.emplace("shape_B", [&](const int val){ cv_shape_B = val;});
-	pMapPar.emplace("vol_B", [&](const int val){ vol_B = val;});
-	pMapCv.emplace("vol_B", [&](const int val){ cv_vol_B = val;});
-	pMapPar.emplace("pitch_B", [&](const int val){ pitch_B = val;});
-	pMapCv.emplace("pitch_B", [&](const int val){ cv_pitch_B = val;});
-	pMapPar.emplace("tune_B", [&](const int val){ tune_B = val;});
-	pMapCv.emplace("tune_B", [&](const int val){ cv_tune_B = val;});
-	pMapPar.emplace("timbre_B", [&](const int val){ timbre_B = val;});
-	pMapCv.emplace("timbre_B", [&](const int val){ cv_timbre_B = val;});
-	pMapPar.emplace("color_B", [&](const int val){ color_B = val;});
-	pMapCv.emplace("color_B", [&](const int val){ cv_color_B = val;});
-	pMapPar.emplace("xModActive_B", [&](const int val){ xModActive_B = val;});
-	pMapTrig.emplace("xModActive_B", [&](const int val){ trig_xModActive_B = val;});
-	pMapPar.emplace("am_xModA_B", [&](const int val){ am_xModA_B = val;});
-	pMapCv.emplace("am_xModA_B", [&](const int val){ cv_am_xModA_B = val;});
-	pMapPar.emplace("freqX_factor_B", [&](const int val){ freqX_factor_B = val;});
-	pMapCv.emplace("freqX_factor_B", [&](const int val){ cv_freqX_factor_B = val;});
-	pMapPar.emplace("freq_xModA_B", [&](const int val){ freq_xModA_B = val;});
-	pMapCv.emplace("freq_xModA_B", [&](const int val){ cv_freq_xModA_B = val;});
-	pMapPar.emplace("timbre_xModA_B", [&](const int val){ timbre_xModA_B = val;});
-	pMapCv.emplace("timbre_xModA_B", [&](const int val){ cv_timbre_xModA_B = val;});
-	pMapPar.emplace("color_xModA_B", [&](const int val){ color_xModA_B = val;});
-	pMapCv.emplace("color_xModA_B", [&](const int val){ cv_color_xModA_B = val;});
-	pMapPar.emplace("enableFilter", [&](const int val){ enableFilter = val;});
-	pMapTrig.emplace("enableFilter", [&](const int val){ trig_enableFilter = val;});
-	pMapPar.emplace("filterIsSVF", [&](const int val){ filterIsSVF = val;});
-	pMapTrig.emplace("filterIsSVF", [&](const int val){ trig_filterIsSVF = val;});
-	pMapPar.emplace("WavefolderAmnt", [&](const int val){ WavefolderAmnt = val;});
-	pMapCv.emplace("WavefolderAmnt", [&](const int val){ cv_WavefolderAmnt = val;});
-	pMapPar.emplace("Cutoff", [&](const int val){ Cutoff = val;});
-	pMapCv.emplace("Cutoff", [&](const int val){ cv_Cutoff = val;});
-	pMapPar.emplace("Resonance", [&](const int val){ Resonance = val;});
-	pMapCv.emplace("Resonance", [&](const int val){ cv_Resonance = val;});
-	pMapPar.emplace("ADfilterAmnt", [&](const int val){ ADfilterAmnt = val;});
-	pMapCv.emplace("ADfilterAmnt", [&](const int val){ cv_ADfilterAmnt = val;});
-	pMapPar.emplace("enableADeg", [&](const int val){ enableADeg = val;});
-	pMapTrig.emplace("enableADeg", [&](const int val){ trig_enableADeg = val;});
-	pMapPar.emplace("ADegIsLowpassGate", [&](const int val){ ADegIsLowpassGate = val;});
-	pMapTrig.emplace("ADegIsLowpassGate", [&](const int val){ trig_ADegIsLowpassGate = val;});
-	pMapPar.emplace("attackADeg", [&](const int val){ attackADeg = val;});
-	pMapCv.emplace("attackADeg", [&](const int val){ cv_attackADeg = val;});
-	pMapPar.emplace("decayADeg", [&](const int val){ decayADeg = val;});
-	pMapCv.emplace("decayADeg", [&](const int val){ cv_decayADeg = val;});
-	pMapPar.emplace("loopADeg", [&](const int val){ loopADeg = val;});
-	pMapTrig.emplace("loopADeg", [&](const int val){ trig_loopADeg = val;});
-	pMapPar.emplace("enableVolADSReg", [&](const int val){ enableVolADSReg = val;});
-	pMapTrig.emplace("enableVolADSReg", [&](const int val){ trig_enableVolADSReg = val;});
-	pMapPar.emplace("attackVolADSReg", [&](const int val){ attackVolADSReg = val;});
-	pMapCv.emplace("attackVolADSReg", [&](const int val){ cv_attackVolADSReg = val;});
-	pMapPar.emplace("decayVolADSReg", [&](const int val){ decayVolADSReg = val;});
-	pMapCv.emplace("decayVolADSReg", [&](const int val){ cv_decayVolADSReg = val;});
-	pMapPar.emplace("sustainVolADSReg", [&](const int val){ sustainVolADSReg = val;});
-	pMapCv.emplace("sustainVolADSReg", [&](const int val){ cv_sustainVolADSReg = val;});
-	pMapPar.emplace("releaseVolADSReg", [&](const int val){ releaseVolADSReg = val;});
-	pMapCv.emplace("releaseVolADSReg", [&](const int val){ cv_releaseVolADSReg = val;});
-	pMapPar.emplace("lfoActive_1", [&](const int val){ lfoActive_1 = val;});
-	pMapTrig.emplace("lfoActive_1", [&](const int val){ trig_lfoActive_1 = val;});
-	pMapPar.emplace("lfoDestination_1", [&](const int val){ lfoDestination_1 = val;});
-	pMapCv.emplace("lfoDestination_1", [&](const int val){ cv_lfoDestination_1 = val;});
-	pMapPar.emplace("lfoType_1", [&](const int val){ lfoType_1 = val;});
-	pMapCv.emplace("lfoType_1", [&](const int val){ cv_lfoType_1 = val;});
-	pMapPar.emplace("lfoSpeed_1", [&](const int val){ lfoSpeed_1 = val;});
-	pMapCv.emplace("lfoSpeed_1", [&](const int val){ cv_lfoSpeed_1 = val;});
-	pMapPar.emplace("lfoAmnt_1", [&](const int val){ lfoAmnt_1 = val;});
-	pMapCv.emplace("lfoAmnt_1", [&](const int val){ cv_lfoAmnt_1 = val;});
-	pMapPar.emplace("lfoActive_2", [&](const int val){ lfoActive_2 = val;});
-	pMapTrig.emplace("lfoActive_2", [&](const int val){ trig_lfoActive_2 = val;});
-	pMapPar.emplace("lfoDestination_2", [&](const int val){ lfoDestination_2 = val;});
-	pMapCv.emplace("lfoDestination_2", [&](const int val){ cv_lfoDestination_2 = val;});
-	pMapPar.emplace("lfoType_2", [&](const int val){ lfoType_2 = val;});
-	pMapCv.emplace("lfoType_2", [&](const int val){ cv_lfoType_2 = val;});
-	pMapPar.emplace("lfoSpeed_2", [&](const int val){ lfoSpeed_2 = val;});
-	pMapCv.emplace("lfoSpeed_2", [&](const int val){ cv_lfoSpeed_2 = val;});
-	pMapPar.emplace("lfoAmnt_2", [&](const int val){ lfoAmnt_2 = val;});
-	pMapCv.emplace("lfoAmnt_2", [&](const int val){ cv_lfoAmnt_2 = val;});
-	pMapPar.emplace("lfoActive_3", [&](const int val){ lfoActive_3 = val;});
-	pMapTrig.emplace("lfoActive_3", [&](const int val){ trig_lfoActive_3 = val;});
-	pMapPar.emplace("lfoDestination_3", [&](const int val){ lfoDestination_3 = val;});
-	pMapCv.emplace("lfoDestination_3", [&](const int val){ cv_lfoDestination_3 = val;});
-	pMapPar.emplace("lfoType_3", [&](const int val){ lfoType_3 = val;});
-	pMapCv.emplace("lfoType_3", [&](const int val){ cv_lfoType_3 = val;});
-	pMapPar.emplace("lfoSpeed_3", [&](const int val){ lfoSpeed_3 = val;});
-	pMapCv.emplace("lfoSpeed_3", [&](const int val){ cv_lfoSpeed_3 = val;});
-	pMapPar.emplace("lfoAmnt_3", [&](const int val){ lfoAmnt_3 = val;});
-	pMapCv.emplace("lfoAmnt_3", [&](const int val){ cv_lfoAmnt_3 = val;});
-	pMapPar.emplace("lfoActive_4", [&](const int val){ lfoActive_4 = val;});
-	pMapTrig.emplace("lfoActive_4", [&](const int val){ trig_lfoActive_4 = val;});
-	pMapPar.emplace("lfoDestination_4", [&](const int val){ lfoDestination_4 = val;});
-	pMapCv.emplace("lfoDestination_4", [&](const int val){ cv_lfoDestination_4 = val;});
-	pMapPar.emplace("lfoType_4", [&](const int val){ lfoType_4 = val;});
-	pMapCv.emplace("lfoType_4", [&](const int val){ cv_lfoType_4 = val;});
-	pMapPar.emplace("lfoSpeed_4", [&](const int val){ lfoSpeed_4 = val;});
-	pMapCv.emplace("lfoSpeed_4", [&](const int val){ cv_lfoSpeed_4 = val;});
-	pMapPar.emplace("lfoAmnt_4", [&](const int val){ lfoAmnt_4 = val;});
-	pMapCv.emplace("lfoAmnt_4", [&](const int val){ cv_lfoAmnt_4 = val;});
-	pMapPar.emplace("lfoActive_5", [&](const int val){ lfoActive_5 = val;});
-	pMapTrig.emplace("lfoActive_5", [&](const int val){ trig_lfoActive_5 = val;});
-	pMapPar.emplace("lfoDestination_5", [&](const int val){ lfoDestination_5 = val;});
-	pMapCv.emplace("lfoDestination_5", [&](const int val){ cv_lfoDestination_5 = val;});
-	pMapPar.emplace("lfoType_5", [&](const int val){ lfoType_5 = val;});
-	pMapCv.emplace("lfoType_5", [&](const int val){ cv_lfoType_5 = val;});
-	pMapPar.emplace("lfoSpeed_5", [&](const int val){ lfoSpeed_5 = val;});
-	pMapCv.emplace("lfoSpeed_5", [&](const int val){ cv_lfoSpeed_5 = val;});
-	pMapPar.emplace("lfoAmnt_5", [&](const int val){ lfoAmnt_5 = val;});
-	pMapCv.emplace("lfoAmnt_5", [&](const int val){ cv_lfoAmnt_5 = val;});
-	pMapPar.emplace("lfoppActive_1", [&](const int val){ lfoppActive_1 = val;});
-	pMapTrig.emplace("lfoppActive_1", [&](const int val){ trig_lfoppActive_1 = val;});
-	pMapPar.emplace("lfoppDestination_1", [&](const int val){ lfoppDestination_1 = val;});
-	pMapCv.emplace("lfoppDestination_1", [&](const int val){ cv_lfoppDestination_1 = val;});
-	pMapPar.emplace("lfoppType_1", [&](const int val){ lfoppType_1 = val;});
-	pMapCv.emplace("lfoppType_1", [&](const int val){ cv_lfoppType_1 = val;});
-	pMapPar.emplace("lfoppSpeed_1", [&](const int val){ lfoppSpeed_1 = val;});
-	pMapCv.emplace("lfoppSpeed_1", [&](const int val){ cv_lfoppSpeed_1 = val;});
-	pMapPar.emplace("lfoppAmnt_1", [&](const int val){ lfoppAmnt_1 = val;});
-	pMapCv.emplace("lfoppAmnt_1", [&](const int val){ cv_lfoppAmnt_1 = val;});
-	pMapPar.emplace("lfoppActive_2", [&](const int val){ lfoppActive_2 = val;});
-	pMapTrig.emplace("lfoppActive_2", [&](const int val){ trig_lfoppActive_2 = val;});
-	pMapPar.emplace("lfoppDestination_2", [&](const int val){ lfoppDestination_2 = val;});
-	pMapCv.emplace("lfoppDestination_2", [&](const int val){ cv_lfoppDestination_2 = val;});
-	pMapPar.emplace("lfoppType_2", [&](const int val){ lfoppType_2 = val;});
-	pMapCv.emplace("lfoppType_2", [&](const int val){ cv_lfoppType_2 = val;});
-	pMapPar.emplace("lfoppSpeed_2", [&](const int val){ lfoppSpeed_2 = val;});
-	pMapCv.emplace("lfoppSpeed_2", [&](const int val){ cv_lfoppSpeed_2 = val;});
-	pMapPar.emplace("lfoppAmnt_2", [&](const int val){ lfoppAmnt_2 = val;});
-	pMapCv.emplace("lfoppAmnt_2", [&](const int val){ cv_lfoppAmnt_2 = val;});
-	pMapPar.emplace("lfoppActive_3", [&](const int val){ lfoppActive_3 = val;});
-	pMapTrig.emplace("lfoppActive_3", [&](const int val){ trig_lfoppActive_3 = val;});
-	pMapPar.emplace("lfoppDestination_3", [&](const int val){ lfoppDestination_3 = val;});
-	pMapCv.emplace("lfoppDestination_3", [&](const int val){ cv_lfoppDestination_3 = val;});
-	pMapPar.emplace("lfoppType_3", [&](const int val){ lfoppType_3 = val;});
-	pMapCv.emplace("lfoppType_3", [&](const int val){ cv_lfoppType_3 = val;});
-	pMapPar.emplace("lfoppSpeed_3", [&](const int val){ lfoppSpeed_3 = val;});
-	pMapCv.emplace("lfoppSpeed_3", [&](const int val){ cv_lfoppSpeed_3 = val;});
-	pMapPar.emplace("lfoppAmnt_3", [&](const int val){ lfoppAmnt_3 = val;});
-	pMapCv.emplace("lfoppAmnt_3", [&](const int val){ cv_lfoppAmnt_3 = val;});
-	pMapPar.emplace("lfoppActive_4", [&](const int val){ lfoppActive_4 = val;});
-	pMapTrig.emplace("lfoppActive_4", [&](const int val){ trig_lfoppActive_4 = val;});
-	pMapPar.emplace("lfoppDestination_4", [&](const int val){ lfoppDestination_4 = val;});
-	pMapCv.emplace("lfoppDestination_4", [&](const int val){ cv_lfoppDestination_4 = val;});
-	pMapPar.emplace("lfoppType_4", [&](const int val){ lfoppType_4 = val;});
-	pMapCv.emplace("lfoppType_4", [&](const int val){ cv_lfoppType_4 = val;});
-	pMapPar.emplace("lfoppSpeed_4", [&](const int val){ lfoppSpeed_4 = val;});
-	pMapCv.emplace("lfoppSpeed_4", [&](const int val){ cv_lfoppSpeed_4 = val;});
-	pMapPar.emplace("lfoppAmnt_4", [&](const int val){ lfoppAmnt_4 = val;});
-	pMapCv.emplace("lfoppAmnt_4", [&](const int val){ cv_lfoppAmnt_4 = val;});
-	pMapPar.emplace("lfoppActive_5", [&](const int val){ lfoppActive_5 = val;});
-	pMapTrig.emplace("lfoppActive_5", [&](const int val){ trig_lfoppActive_5 = val;});
-	pMapPar.emplace("lfoppDestination_5", [&](const int val){ lfoppDestination_5 = val;});
-	pMapCv.emplace("lfoppDestination_5", [&](const int val){ cv_lfoppDestination_5 = val;});
-	pMapPar.emplace("lfoppType_5", [&](const int val){ lfoppType_5 = val;});
-	pMapCv.emplace("lfoppType_5", [&](const int val){ cv_lfoppType_5 = val;});
-	pMapPar.emplace("lfoppSpeed_5", [&](const int val){ lfoppSpeed_5 = val;});
-	pMapCv.emplace("lfoppSpeed_5", [&](const int val){ cv_lfoppSpeed_5 = val;});
-	pMapPar.emplace("lfoppAmnt_5", [&](const int val){ lfoppAmnt_5 = val;});
-	pMapCv.emplace("lfoppAmnt_5", [&](const int val){ cv_lfoppAmnt_5 = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, Gate),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, Volume),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, xFadeOscAoscB),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, osc_active_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, shape_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, vol_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, pitch_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, tune_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, timbre_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, color_A),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, xModActive_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, am_xModB_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, freqX_factor_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, freq_xModB_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, timbre_xModB_A),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, color_xModB_A),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, osc_active_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, shape_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, vol_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, pitch_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, tune_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, timbre_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, color_B),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, xModActive_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, am_xModA_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, freqX_factor_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, freq_xModA_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, timbre_xModA_B),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, color_xModA_B),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, enableFilter),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, filterIsSVF),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, WavefolderAmnt),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, Cutoff),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, Resonance),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, ADfilterAmnt),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, enableADeg),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, ADegIsLowpassGate),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, attackADeg),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, decayADeg),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, loopADeg),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, enableVolADSReg),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, attackVolADSReg),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, decayVolADSReg),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, sustainVolADSReg),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, releaseVolADSReg),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoActive_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoDestination_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoType_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoSpeed_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoAmnt_1),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoActive_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoDestination_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoType_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoSpeed_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoAmnt_2),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoActive_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoDestination_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoType_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoSpeed_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoAmnt_3),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoActive_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoDestination_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoType_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoSpeed_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoAmnt_4),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoActive_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoDestination_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoType_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoSpeed_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoAmnt_5),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoppActive_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppDestination_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppType_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppSpeed_1),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppAmnt_1),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoppActive_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppDestination_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppType_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppSpeed_2),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppAmnt_2),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoppActive_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppDestination_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppType_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppSpeed_3),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppAmnt_3),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoppActive_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppDestination_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppType_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppSpeed_4),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppAmnt_4),
+		MK_PARAM_BOOL(ctagSoundProcessorSubbotnik, lfoppActive_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppDestination_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppType_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppSpeed_5),
+		MK_PARAM_INT(ctagSoundProcessorSubbotnik, lfoppAmnt_5),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "Subbotnik";
 	// sectionCpp0
@@ -169,8 +169,12 @@ void ctagSoundProcessorTBD03::Process(const ProcessData &data) {
     osc.set_pitch(ipitch);
 
     // render audio data
-    int16_t buffer[32];
-    osc.Render(sync, buffer, bufSz);
+    int16_t buffer[bufSz];
+    // braids renders at most 32 frames per call
+    constexpr int chunkSz = bufSz < 32 ? bufSz : 32;
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        osc.Render(sync, &buffer[i], chunkSz);
+    }
 
     // apply filter and EGs
     int ftype = filter_type;
@@ -252,48 +256,30 @@ void ctagSoundProcessorTBD03::Process(const ProcessData &data) {
 
 void ctagSoundProcessorTBD03::knowYourself() {
     // sectionCpp0
-	pMapPar.emplace("trigger", [&](const int val){ trigger = val;});
-	pMapTrig.emplace("trigger", [&](const int val){ trig_trigger = val;});
-	pMapPar.emplace("sync_trig", [&](const int val){ sync_trig = val;});
-	pMapTrig.emplace("sync_trig", [&](const int val){ trig_sync_trig = val;});
-	pMapPar.emplace("pitch", [&](const int val){ pitch = val;});
-	pMapCv.emplace("pitch", [&](const int val){ cv_pitch = val;});
-	pMapPar.emplace("shape", [&](const int val){ shape = val;});
-	pMapCv.emplace("shape", [&](const int val){ cv_shape = val;});
-	pMapPar.emplace("param_0", [&](const int val){ param_0 = val;});
-	pMapCv.emplace("param_0", [&](const int val){ cv_param_0 = val;});
-	pMapPar.emplace("param_1", [&](const int val){ param_1 = val;});
-	pMapCv.emplace("param_1", [&](const int val){ cv_param_1 = val;});
-	pMapPar.emplace("gain", [&](const int val){ gain = val;});
-	pMapCv.emplace("gain", [&](const int val){ cv_gain = val;});
-	pMapPar.emplace("filter_type", [&](const int val){ filter_type = val;});
-	pMapCv.emplace("filter_type", [&](const int val){ cv_filter_type = val;});
-	pMapPar.emplace("cutoff", [&](const int val){ cutoff = val;});
-	pMapCv.emplace("cutoff", [&](const int val){ cv_cutoff = val;});
-	pMapPar.emplace("resonance", [&](const int val){ resonance = val;});
-	pMapCv.emplace("resonance", [&](const int val){ cv_resonance = val;});
-	pMapPar.emplace("envelope", [&](const int val){ envelope = val;});
-	pMapCv.emplace("envelope", [&](const int val){ cv_envelope = val;});
-	pMapPar.emplace("saturation", [&](const int val){ saturation = val;});
-	pMapCv.emplace("saturation", [&](const int val){ cv_saturation = val;});
-	pMapPar.emplace("drive", [&](const int val){ drive = val;});
-	pMapCv.emplace("drive", [&](const int val){ cv_drive = val;});
-	pMapPar.emplace("accent", [&](const int val){ accent = val;});
-	pMapTrig.emplace("accent", [&](const int val){ trig_accent = val;});
-	pMapPar.emplace("accent_level", [&](const int val){ accent_level = val;});
-	pMapCv.emplace("accent_level", [&](const int val){ cv_accent_level = val;});
-	pMapPar.emplace("slide", [&](const int val){ slide = val;});
-	pMapTrig.emplace("slide", [&](const int val){ trig_slide = val;});
-	pMapPar.emplace("slide_level", [&](const int val){ slide_level = val;});
-	pMapCv.emplace("slide_level", [&](const int val){ cv_slide_level = val;});
-	pMapPar.emplace("decay_vca", [&](const int val){ decay_vca = val;});
-	pMapCv.emplace("decay_vca", [&](const int val){ cv_decay_vca = val;});
-	pMapPar.emplace("decay_vcf", [&](const int val){ decay_vcf = val;});
-	pMapCv.emplace("decay_vcf", [&](const int val){ cv_decay_vcf = val;});
-	pMapPar.emplace("p0_amt", [&](const int val){ p0_amt = val;});
-	pMapCv.emplace("p0_amt", [&](const int val){ cv_p0_amt = val;});
-	pMapPar.emplace("p1_amt", [&](const int val){ p1_amt = val;});
-	pMapCv.emplace("p1_amt", [&](const int val){ cv_p1_amt = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorTBD03, trigger),
+		MK_PARAM_BOOL(ctagSoundProcessorTBD03, sync_trig),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, pitch),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, shape),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, param_0),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, param_1),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, gain),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, filter_type),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, cutoff),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, resonance),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, envelope),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, saturation),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, drive),
+		MK_PARAM_BOOL(ctagSoundProcessorTBD03, accent),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, accent_level),
+		MK_PARAM_BOOL(ctagSoundProcessorTBD03, slide),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, slide_level),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, decay_vca),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, decay_vcf),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, p0_amt),
+		MK_PARAM_INT(ctagSoundProcessorTBD03, p1_amt),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "TBD03";
 	// sectionCpp0
@@ -128,7 +128,11 @@ void ctagSoundProcessorTBDaits::Process(const ProcessData &data) {
 
     // get frame
     plaits::Voice::Frame out[bufSz];
-    voice.Render(patch, modulations, out, bufSz);
+    // plaits renders at most plaits::kMaxBlockSize frames per call
+    constexpr int chunkSz = bufSz < static_cast<int>(plaits::kMaxBlockSize) ? bufSz : static_cast<int>(plaits::kMaxBlockSize);
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        voice.Render(patch, modulations, &out[i], bufSz - i < chunkSz ? bufSz - i : chunkSz);
+    }
 
     // convert
     for (int i = 0; i < bufSz; i++) {
@@ -142,30 +146,21 @@ ctagSoundProcessorTBDaits::~ctagSoundProcessorTBDaits() {
 
 void ctagSoundProcessorTBDaits::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("smodel", [&](const int val) { smodel = val; });
-    pMapCv.emplace("smodel", [&](const int val) { cv_smodel = val; });
-    pMapPar.emplace("trigger", [&](const int val) { trigger = val; });
-    pMapTrig.emplace("trigger", [&](const int val) { trig_trigger = val; });
-    pMapPar.emplace("frequency", [&](const int val) { frequency = val; });
-    pMapCv.emplace("frequency", [&](const int val) { cv_frequency = val; });
-    pMapPar.emplace("level", [&](const int val) { level = val; });
-    pMapCv.emplace("level", [&](const int val) { cv_level = val; });
-    pMapPar.emplace("harmonics", [&](const int val) { harmonics = val; });
-    pMapCv.emplace("harmonics", [&](const int val) { cv_harmonics = val; });
-    pMapPar.emplace("timbre", [&](const int val) { timbre = val; });
-    pMapCv.emplace("timbre", [&](const int val) { cv_timbre = val; });
-    pMapPar.emplace("morph", [&](const int val) { morph = val; });
-    pMapCv.emplace("morph", [&](const int val) { cv_morph = val; });
-    pMapPar.emplace("lpg_color", [&](const int val) { lpg_color = val; });
-    pMapCv.emplace("lpg_color", [&](const int val) { cv_lpg_color = val; });
-    pMapPar.emplace("lpg_decay", [&](const int val) { lpg_decay = val; });
-    pMapCv.emplace("lpg_decay", [&](const int val) { cv_lpg_decay = val; });
-    pMapPar.emplace("mod_freq", [&](const int val) { mod_freq = val; });
-    pMapCv.emplace("mod_freq", [&](const int val) { cv_mod_freq = val; });
-    pMapPar.emplace("mod_timbre", [&](const int val) { mod_timbre = val; });
-    pMapCv.emplace("mod_timbre", [&](const int val) { cv_mod_timbre = val; });
-    pMapPar.emplace("mod_morph", [&](const int val) { mod_morph = val; });
-    pMapCv.emplace("mod_morph", [&](const int val) { cv_mod_morph = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, smodel),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDaits, trigger),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, frequency),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, level),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, harmonics),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, timbre),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, morph),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, lpg_color),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, lpg_decay),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, mod_freq),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, mod_timbre),
+        MK_PARAM_INT(ctagSoundProcessorTBDaits, mod_morph),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "TBDaits";
     // sectionCpp0
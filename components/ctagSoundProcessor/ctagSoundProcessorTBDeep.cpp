@@ -70,7 +70,7 @@ void ctagSoundProcessorTBDeep::Init(std::size_t blockSize, void *blockPtr) {
 
     loudAD.SetSampleRate(44100.f);
     loudAD.SetModeExp();
-    paramAD.SetSampleRate(44100.f / 32.f);
+    paramAD.SetSampleRate(44100.f / bufSz);
     paramAD.SetModeLin();
 }
 
@@ -111,23 +111,6 @@ void ctagSoundProcessorTBDeep::Process(const ProcessData &data) {
     output_mode = (tides2::OutputMode) 3; // only mode 3 (tides2::OutputMode)(mode % 4);
     ramp_mode = (tides2::RampMode) 1; // only mode 1
 
-    // Input gates
-    for (int i = 0; i < bufSz; i++) {
-        if (trig_trigger != -1) {
-            trig_flags[i] = stmlib::ExtractGateFlags(previous_trig_flag, data.trig[trig_trigger] != 1);
-        } else {
-            trig_flags[i] = trigger;
-        }
-        previous_trig_flag = trig_flags[i];
-
-        if (trig_clock != -1) {
-            clock_flags[i] = stmlib::ExtractGateFlags(previous_clock_flag, data.trig[trig_clock] != 1);
-        } else {
-            clock_flags[i] = clock;
-        }
-        previous_clock_flag = clock_flags[i];
-    }
-
     float note = frequency;
     if (cv_frequency != -1) {
         note += 12.f * data.cv[cv_frequency] * 5.f;
@@ -144,29 +127,8 @@ void ctagSoundProcessorTBDeep::Process(const ProcessData &data) {
     CONSTRAIN(fm, -96.f, 96.f);
 
     float transposition = note + fm;
-    float ramp[tides2::kBlockSize];
-    float freq;
     tides2::Range range_mode = tides2::RANGE_AUDIO; // only audio (range < 2) ? tides2::RANGE_CONTROL : tides2::RANGE_AUDIO;
 
-    if (trig_clock != -1) {
-        if (must_reset_ramp_extractor) {
-            ramp_extractor.Reset();
-        }
-
-        tides2::Ratio r = ratio_index_quantizer.Lookup(kRatios, 0.5f + transposition * 0.0105f, 20);
-        freq = ramp_extractor.Process(
-                range_mode == tides2::RANGE_AUDIO,
-                range_mode == tides2::RANGE_AUDIO && ramp_mode == tides2::RAMP_MODE_AR,
-                r,
-                clock_flags,
-                ramp,
-                tides2::kBlockSize);
-        must_reset_ramp_extractor = false;
-    } else {
-        freq = kRootScaled[2] / 44100.f * stmlib::SemitonesToRatio(transposition);
-        must_reset_ramp_extractor = true;
-    }
-
     // Get parameters
     float fSlope = slope / 4095.f;
     if (cv_slope != -1) {
@@ -215,21 +177,6 @@ void ctagSoundProcessorTBDeep::Process(const ProcessData &data) {
         previous_output_mode = output_mode;
     }
 
-    // Render generator
-    poly_slope_generator.Render(
-            ramp_mode,
-            output_mode,
-            range_mode,
-            freq,
-            fSlope,
-            fShape,
-            fSmoothness,
-            fShift,
-            trig_flags,
-            (trig_trigger == -1) && (trig_clock != -1) ? ramp : NULL,
-            out,
-            tides2::kBlockSize);
-
     // which output to route?
     int o0 = out0;
     if (cv_out0 != -1) {
@@ -258,60 +205,100 @@ void ctagSoundProcessorTBDeep::Process(const ProcessData &data) {
         fModLevel = data.cv[cv_mod_level];
     }
 
-    for (int j = 0; j < bufSz; j++) {
-        float loud = fModLevel * loudAD.Process();
-        if (fModLevel < 0.f) loud -= fModLevel;
-        float loud0 = fLoud0 * ((1.f - fabsf(fModLevel)) + loud);
-        float loud1 = fLoud1 * ((1.f - fabsf(fModLevel)) + loud);
-        data.buf[j * 2] = HELPERS::fasttanh(out[j].channel[o0] * loud0);
-        data.buf[j * 2 + 1] = HELPERS::fasttanh(out[j].channel[o1] * loud1);
+    // tides renders at most tides2::kBlockSize frames per call
+    constexpr int chunkSz = bufSz < static_cast<int>(tides2::kBlockSize) ? bufSz : static_cast<int>(tides2::kBlockSize);
+    for (int k = 0; k < bufSz; k += chunkSz) {
+        const int n = bufSz - k < chunkSz ? bufSz - k : chunkSz;
+        // Input gates
+        for (int i = 0; i < n; i++) {
+            if (trig_trigger != -1) {
+                trig_flags[i] = stmlib::ExtractGateFlags(previous_trig_flag, data.trig[trig_trigger] != 1);
+            } else {
+                trig_flags[i] = trigger;
+            }
+            previous_trig_flag = trig_flags[i];
+
+            if (trig_clock != -1) {
+                clock_flags[i] = stmlib::ExtractGateFlags(previous_clock_flag, data.trig[trig_clock] != 1);
+            } else {
+                clock_flags[i] = clock;
+            }
+            previous_clock_flag = clock_flags[i];
+        }
+
+        float ramp[tides2::kBlockSize];
+        float freq;
+        if (trig_clock != -1) {
+            if (must_reset_ramp_extractor) {
+                ramp_extractor.Reset();
+            }
+
+            tides2::Ratio r = ratio_index_quantizer.Lookup(kRatios, 0.5f + transposition * 0.0105f, 20);
+            freq = ramp_extractor.Process(
+                    range_mode == tides2::RANGE_AUDIO,
+                    range_mode == tides2::RANGE_AUDIO && ramp_mode == tides2::RAMP_MODE_AR,
+                    r,
+                    clock_flags,
+                    ramp,
+                    n);
+            must_reset_ramp_extractor = false;
+        } else {
+            freq = kRootScaled[2] / 44100.f * stmlib::SemitonesToRatio(transposition);
+            must_reset_ramp_extractor = true;
+        }
+
+        // Render generator
+        poly_slope_generator.Render(
+                ramp_mode,
+                output_mode,
+                range_mode,
+                freq,
+                fSlope,
+                fShape,
+                fSmoothness,
+                fShift,
+                trig_flags,
+                (trig_trigger == -1) && (trig_clock != -1) ? ramp : NULL,
+                out,
+                n);
+
+        for (int j = 0; j < n; j++) {
+            float loud = fModLevel * loudAD.Process();
+            if (fModLevel < 0.f) loud -= fModLevel;
+            float loud0 = fLoud0 * ((1.f - fabsf(fModLevel)) + loud);
+            float loud1 = fLoud1 * ((1.f - fabsf(fModLevel)) + loud);
+            data.buf[(k + j) * 2] = HELPERS::fasttanh(out[j].channel[o0] * loud0);
+            data.buf[(k + j) * 2 + 1] = HELPERS::fasttanh(out[j].channel[o1] * loud1);
+        }
     }
 }
 
 void ctagSoundProcessorTBDeep::knowYourself() {
 // sectionCpp0
-    pMapPar.emplace("trigger", [&](const int val) { trigger = val; });
-    pMapTrig.emplace("trigger", [&](const int val) { trig_trigger = val; });
-    pMapPar.emplace("clock", [&](const int val) { clock = val; });
-    pMapTrig.emplace("clock", [&](const int val) { trig_clock = val; });
-    pMapPar.emplace("out0", [&](const int val) { out0 = val; });
-    pMapCv.emplace("out0", [&](const int val) { cv_out0 = val; });
-    pMapPar.emplace("out0_level", [&](const int val) { out0_level = val; });
-    pMapCv.emplace("out0_level", [&](const int val) { cv_out0_level = val; });
-    pMapPar.emplace("out1", [&](const int val) { out1 = val; });
-    pMapCv.emplace("out1", [&](const int val) { cv_out1 = val; });
-    pMapPar.emplace("out1_level", [&](const int val) { out1_level = val; });
-    pMapCv.emplace("out1_level", [&](const int val) { cv_out1_level = val; });
-    pMapPar.emplace("frequency", [&](const int val) { frequency = val; });
-    pMapCv.emplace("frequency", [&](const int val) { cv_frequency = val; });
-    pMapPar.emplace("shape", [&](const int val) { shape = val; });
-    pMapCv.emplace("shape", [&](const int val) { cv_shape = val; });
-    pMapPar.emplace("slope", [&](const int val) { slope = val; });
-    pMapCv.emplace("slope", [&](const int val) { cv_slope = val; });
-    pMapPar.emplace("smoothness", [&](const int val) { smoothness = val; });
-    pMapCv.emplace("smoothness", [&](const int val) { cv_smoothness = val; });
-    pMapPar.emplace("shift", [&](const int val) { shift = val; });
-    pMapCv.emplace("shift", [&](const int val) { cv_shift = val; });
-    pMapPar.emplace("eg_trigger", [&](const int val) { eg_trigger = val; });
-    pMapTrig.emplace("eg_trigger", [&](const int val) { trig_eg_trigger = val; });
-    pMapPar.emplace("eg_loop", [&](const int val) { eg_loop = val; });
-    pMapTrig.emplace("eg_loop", [&](const int val) { trig_eg_loop = val; });
-    pMapPar.emplace("eg_attack", [&](const int val) { eg_attack = val; });
-    pMapCv.emplace("eg_attack", [&](const int val) { cv_eg_attack = val; });
-    pMapPar.emplace("eg_decay", [&](const int val) { eg_decay = val; });
-    pMapCv.emplace("eg_decay", [&](const int val) { cv_eg_decay = val; });
-    pMapPar.emplace("mod_level", [&](const int val) { mod_level = val; });
-    pMapCv.emplace("mod_level", [&](const int val) { cv_mod_level = val; });
-    pMapPar.emplace("mod_frequency", [&](const int val) { mod_frequency = val; });
-    pMapCv.emplace("mod_frequency", [&](const int val) { cv_mod_frequency = val; });
-    pMapPar.emplace("mod_shape", [&](const int val) { mod_shape = val; });
-    pMapCv.emplace("mod_shape", [&](const int val) { cv_mod_shape = val; });
-    pMapPar.emplace("mod_slope", [&](const int val) { mod_slope = val; });
-    pMapCv.emplace("mod_slope", [&](const int val) { cv_mod_slope = val; });
-    pMapPar.emplace("mod_smoothness", [&](const int val) { mod_smoothness = val; });
-    pMapCv.emplace("mod_smoothness", [&](const int val) { cv_mod_smoothness = val; });
-    pMapPar.emplace("mod_shift", [&](const int val) { mod_shift = val; });
-    pMapCv.emplace("mod_shift", [&](const int val) { cv_mod_shift = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorTBDeep, trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDeep, clock),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, out0),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, out0_level),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, out1),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, out1_level),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, frequency),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, shape),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, slope),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, smoothness),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, shift),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDeep, eg_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDeep, eg_loop),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, eg_attack),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, eg_decay),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_level),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_frequency),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_shape),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_slope),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_smoothness),
+        MK_PARAM_INT(ctagSoundProcessorTBDeep, mod_shift),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "TBDeep";
     // sectionCpp0
@@ -39,17 +39,17 @@ void ctagSoundProcessorTBDings::Init(std::size_t blockSize, void *blockPtr) {
     reverb_buffer = (uint16_t *) blockPtr;
      */
 
-    reverb_buffer = (uint16_t *) heap_caps_malloc(32768 * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    reverb_buffer = (uint16_t *) ctagSPAllocator::Allocate(32768 * sizeof(uint16_t), alignof(uint16_t), ctagSPAllocator::Region::SPIRAM);
     assert(reverb_buffer != nullptr);
 
-    strummer.Init(0.01f, 44100.0f / bufSz);
+    strummer.Init(0.01f, 44100.0f / chunkSz);
     part.Init(reverb_buffer);
     string_synth.Init(reverb_buffer);
 
     //memset(&patch, 0, sizeof(patch));
     //memset(&performance_state, 0, sizeof(performance_state));
 
-    paramAD.SetSampleRate(44100.f / 32.f);
+    paramAD.SetSampleRate(44100.f / bufSz);
     paramAD.SetModeLin();
 }
 
@@ -71,12 +71,16 @@ void ctagSoundProcessorTBDings::Process(const ProcessData &data) {
     for (int i = 0; i < bufSz; i++) {
         in[i] = data.buf[i * 2];
     }
-    if (isEaster) {
-        strummer.Process(NULL, bufSz, &performance_state);
-        string_synth.Process(performance_state, patch, in, out, aux, bufSz);
-    } else {
-        strummer.Process(in, bufSz, &performance_state);
-        part.Process(performance_state, patch, in, out, aux, bufSz);
+    for (int i = 0; i < bufSz; i += chunkSz) {
+        const int n = bufSz - i < chunkSz ? bufSz - i : chunkSz;
+        if (isEaster) {
+            strummer.Process(NULL, n, &performance_state);
+            string_synth.Process(performance_state, patch, &in[i], &out[i], &aux[i], n);
+        } else {
+            strummer.Process(&in[i], n, &performance_state);
+            part.Process(performance_state, patch, &in[i], &out[i], &aux[i], n);
+        }
+        performance_state.strum = false; // external strum triggers first chunk only
     }
 
     for (int i = 0; i < bufSz; i++) {
@@ -198,53 +202,35 @@ void ctagSoundProcessorTBDings::updateParams(const ProcessData &data) {
 }
 
 ctagSoundProcessorTBDings::~ctagSoundProcessorTBDings() {
-    heap_caps_free(reverb_buffer);
+    // no explicit freeing for reverb_buffer needed, done by ctagSPAllocator
 }
 
 void ctagSoundProcessorTBDings::knowYourself() {
     // sectionCpp0
-    pMapPar.emplace("reson_model", [&](const int val) { reson_model = val; });
-    pMapCv.emplace("reson_model", [&](const int val) { cv_reson_model = val; });
-    pMapPar.emplace("frequency", [&](const int val) { frequency = val; });
-    pMapCv.emplace("frequency", [&](const int val) { cv_frequency = val; });
-    pMapPar.emplace("polyphony", [&](const int val) { polyphony = val; });
-    pMapCv.emplace("polyphony", [&](const int val) { cv_polyphony = val; });
-    pMapPar.emplace("structure", [&](const int val) { structure = val; });
-    pMapCv.emplace("structure", [&](const int val) { cv_structure = val; });
-    pMapPar.emplace("brightness", [&](const int val) { brightness = val; });
-    pMapCv.emplace("brightness", [&](const int val) { cv_brightness = val; });
-    pMapPar.emplace("damping", [&](const int val) { damping = val; });
-    pMapCv.emplace("damping", [&](const int val) { cv_damping = val; });
-    pMapPar.emplace("position", [&](const int val) { position = val; });
-    pMapCv.emplace("position", [&](const int val) { cv_position = val; });
-    pMapPar.emplace("chords", [&](const int val) { chords = val; });
-    pMapCv.emplace("chords", [&](const int val) { cv_chords = val; });
-    pMapPar.emplace("easter", [&](const int val) { easter = val; });
-    pMapTrig.emplace("easter", [&](const int val) { trig_easter = val; });
-    pMapPar.emplace("ex_int", [&](const int val) { ex_int = val; });
-    pMapTrig.emplace("ex_int", [&](const int val) { trig_ex_int = val; });
-    pMapPar.emplace("strum_int", [&](const int val) { strum_int = val; });
-    pMapTrig.emplace("strum_int", [&](const int val) { trig_strum_int = val; });
-    pMapPar.emplace("note_int", [&](const int val) { note_int = val; });
-    pMapTrig.emplace("note_int", [&](const int val) { trig_note_int = val; });
-    pMapPar.emplace("eg_trigger", [&](const int val) { eg_trigger = val; });
-    pMapTrig.emplace("eg_trigger", [&](const int val) { trig_eg_trigger = val; });
-    pMapPar.emplace("eg_loop", [&](const int val) { eg_loop = val; });
-    pMapTrig.emplace("eg_loop", [&](const int val) { trig_eg_loop = val; });
-    pMapPar.emplace("eg_attack", [&](const int val) { eg_attack = val; });
-    pMapCv.emplace("eg_attack", [&](const int val) { cv_eg_attack = val; });
-    pMapPar.emplace("eg_decay", [&](const int val) { eg_decay = val; });
-    pMapCv.emplace("eg_decay", [&](const int val) { cv_eg_decay = val; });
-    pMapPar.emplace("mod_brightness", [&](const int val) { mod_brightness = val; });
-    pMapCv.emplace("mod_brightness", [&](const int val) { cv_mod_brightness = val; });
-    pMapPar.emplace("mod_frequency", [&](const int val) { mod_frequency = val; });
-    pMapCv.emplace("mod_frequency", [&](const int val) { cv_mod_frequency = val; });
-    pMapPar.emplace("mod_damping", [&](const int val) { mod_damping = val; });
-    pMapCv.emplace("mod_damping", [&](const int val) { cv_mod_damping = val; });
-    pMapPar.emplace("mod_structure", [&](const int val) { mod_structure = val; });
-    pMapCv.emplace("mod_structure", [&](const int val) { cv_mod_structure = val; });
-    pMapPar.emplace("mod_position", [&](const int val) { mod_position = val; });
-    pMapCv.emplace("mod_position", [&](const int val) { cv_mod_position = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorTBDings, reson_model),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, frequency),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, polyphony),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, structure),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, brightness),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, damping),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, position),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, chords),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, easter),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, ex_int),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, strum_int),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, note_int),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, eg_trigger),
+        MK_PARAM_BOOL(ctagSoundProcessorTBDings, eg_loop),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, eg_attack),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, eg_decay),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, mod_brightness),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, mod_frequency),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, mod_damping),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, mod_structure),
+        MK_PARAM_INT(ctagSoundProcessorTBDings, mod_position),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "TBDings";
     // sectionCpp0
@@ -44,6 +44,8 @@ namespace CTAG {
             void updateParams(const ProcessData &);
 
             // private attributes could go here
+            // rings processes at most rings::kMaxBlockSize frames per call, strummer runs once per chunk
+            static constexpr int chunkSz = bufSz < static_cast<int>(rings::kMaxBlockSize) ? bufSz : static_cast<int>(rings::kMaxBlockSize);
             uint16_t *reverb_buffer;
             rings::Part part;
             rings::StringSynthPart string_synth;
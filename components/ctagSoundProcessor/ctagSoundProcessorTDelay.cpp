@@ -72,7 +72,7 @@ void ctagSoundProcessorTDelay::Init(std::size_t blockSize, void *blockPtr) {
     model = std::make_unique<ctagSPDataModel>(id, isStereo);
     LoadPreset(0);
 
-    assert(blockSize > 258*4); // tdelay memory requirements
+    assert(blockSize >= blockMemSize); // tdelay memory requirements
     tdelay.SetBlockMem(blockPtr);
 }
 
@@ -82,20 +82,16 @@ ctagSoundProcessorTDelay::~ctagSoundProcessorTDelay() {
 void ctagSoundProcessorTDelay::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("bypass", [&](const int val){ bypass = val;});
-	pMapTrig.emplace("bypass", [&](const int val){ trig_bypass = val;});
-	pMapPar.emplace("depth", [&](const int val){ depth = val;});
-	pMapCv.emplace("depth", [&](const int val){ cv_depth = val;});
-	pMapPar.emplace("delay", [&](const int val){ delay = val;});
-	pMapCv.emplace("delay", [&](const int val){ cv_delay = val;});
-	pMapPar.emplace("feedback", [&](const int val){ feedback = val;});
-	pMapCv.emplace("feedback", [&](const int val){ cv_feedback = val;});
-	pMapPar.emplace("lnft", [&](const int val){ lnft = val;});
-	pMapCv.emplace("lnft", [&](const int val){ cv_lnft = val;});
-	pMapPar.emplace("dry", [&](const int val){ dry = val;});
-	pMapCv.emplace("dry", [&](const int val){ cv_dry = val;});
-	pMapPar.emplace("wet", [&](const int val){ wet = val;});
-	pMapCv.emplace("wet", [&](const int val){ cv_wet = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorTDelay, bypass),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, depth),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, delay),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, feedback),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, lnft),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, dry),
+		MK_PARAM_INT(ctagSoundProcessorTDelay, wet),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "TDelay";
 	// sectionCpp0
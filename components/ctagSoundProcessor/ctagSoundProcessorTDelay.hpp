@@ -29,6 +29,7 @@ namespace CTAG {
         public:
             virtual void Process(const ProcessData &) override;
            virtual void Init(std::size_t blockSize, void *blockPtr) override;
+           static constexpr std::size_t blockMemSize = 258 * sizeof(int);
             virtual ~ctagSoundProcessorTDelay();
 
         private:
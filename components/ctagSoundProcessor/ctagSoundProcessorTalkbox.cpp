@@ -235,56 +235,34 @@ ctagSoundProcessorTalkbox::~ctagSoundProcessorTalkbox() {
 void ctagSoundProcessorTalkbox::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("MasterPitch", [&](const int val){ MasterPitch = val;});
-	pMapCv.emplace("MasterPitch", [&](const int val){ cv_MasterPitch = val;});
-	pMapPar.emplace("MasterTune", [&](const int val){ MasterTune = val;});
-	pMapCv.emplace("MasterTune", [&](const int val){ cv_MasterTune = val;});
-	pMapPar.emplace("CarrierAmnt", [&](const int val){ CarrierAmnt = val;});
-	pMapCv.emplace("CarrierAmnt", [&](const int val){ cv_CarrierAmnt = val;});
-	pMapPar.emplace("CarrierBalance", [&](const int val){ CarrierBalance = val;});
-	pMapCv.emplace("CarrierBalance", [&](const int val){ cv_CarrierBalance = val;});
-	pMapPar.emplace("CarrierExternalBalance", [&](const int val){ CarrierExternalBalance = val;});
-	pMapCv.emplace("CarrierExternalBalance", [&](const int val){ cv_CarrierExternalBalance = val;});
-	pMapPar.emplace("CarrierLeak", [&](const int val){ CarrierLeak = val;});
-	pMapCv.emplace("CarrierLeak", [&](const int val){ cv_CarrierLeak = val;});
-	pMapPar.emplace("ExtCarrierAmnt", [&](const int val){ ExtCarrierAmnt = val;});
-	pMapCv.emplace("ExtCarrierAmnt", [&](const int val){ cv_ExtCarrierAmnt = val;});
-	pMapPar.emplace("AccentBendIsActive", [&](const int val){ AccentBendIsActive = val;});
-	pMapTrig.emplace("AccentBendIsActive", [&](const int val){ trig_AccentBendIsActive = val;});
-	pMapPar.emplace("AccentBend", [&](const int val){ AccentBend = val;});
-	pMapCv.emplace("AccentBend", [&](const int val){ cv_AccentBend = val;});
-	pMapPar.emplace("ModulatorAmnt", [&](const int val){ ModulatorAmnt = val;});
-	pMapCv.emplace("ModulatorAmnt", [&](const int val){ cv_ModulatorAmnt = val;});
-	pMapPar.emplace("ModulatorLeakage", [&](const int val){ ModulatorLeakage = val;});
-	pMapCv.emplace("ModulatorLeakage", [&](const int val){ cv_ModulatorLeakage = val;});
-	pMapPar.emplace("Volume", [&](const int val){ Volume = val;});
-	pMapCv.emplace("Volume", [&](const int val){ cv_Volume = val;});
-	pMapPar.emplace("VibratoIsActive", [&](const int val){ VibratoIsActive = val;});
-	pMapTrig.emplace("VibratoIsActive", [&](const int val){ trig_VibratoIsActive = val;});
-	pMapPar.emplace("VibratoSpeed", [&](const int val){ VibratoSpeed = val;});
-	pMapCv.emplace("VibratoSpeed", [&](const int val){ cv_VibratoSpeed = val;});
-	pMapPar.emplace("VibratoDepth", [&](const int val){ VibratoDepth = val;});
-	pMapCv.emplace("VibratoDepth", [&](const int val){ cv_VibratoDepth = val;});
-	pMapPar.emplace("PWMactive", [&](const int val){ PWMactive = val;});
-	pMapTrig.emplace("PWMactive", [&](const int val){ trig_PWMactive = val;});
-	pMapPar.emplace("PWMspeed", [&](const int val){ PWMspeed = val;});
-	pMapCv.emplace("PWMspeed", [&](const int val){ cv_PWMspeed = val;});
-	pMapPar.emplace("PWMdepth", [&](const int val){ PWMdepth = val;});
-	pMapCv.emplace("PWMdepth", [&](const int val){ cv_PWMdepth = val;});
-	pMapPar.emplace("SubOscTune_A", [&](const int val){ SubOscTune_A = val;});
-	pMapCv.emplace("SubOscTune_A", [&](const int val){ cv_SubOscTune_A = val;});
-	pMapPar.emplace("SubOscTuningBactive", [&](const int val){ SubOscTuningBactive = val;});
-	pMapTrig.emplace("SubOscTuningBactive", [&](const int val){ trig_SubOscTuningBactive = val;});
-	pMapPar.emplace("SubOscTune_B", [&](const int val){ SubOscTune_B = val;});
-	pMapCv.emplace("SubOscTune_B", [&](const int val){ cv_SubOscTune_B = val;});
-	pMapPar.emplace("FXIsActive", [&](const int val){ FXIsActive = val;});
-	pMapTrig.emplace("FXIsActive", [&](const int val){ trig_FXIsActive = val;});
-	pMapPar.emplace("FXEnsChor", [&](const int val){ FXEnsChor = val;});
-	pMapTrig.emplace("FXEnsChor", [&](const int val){ trig_FXEnsChor = val;});
-	pMapPar.emplace("FXDepth", [&](const int val){ FXDepth = val;});
-	pMapCv.emplace("FXDepth", [&](const int val){ cv_FXDepth = val;});
-	pMapPar.emplace("FXAmt", [&](const int val){ FXAmt = val;});
-	pMapCv.emplace("FXAmt", [&](const int val){ cv_FXAmt = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, MasterPitch),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, MasterTune),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, CarrierAmnt),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, CarrierBalance),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, CarrierExternalBalance),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, CarrierLeak),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, ExtCarrierAmnt),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, AccentBendIsActive),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, AccentBend),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, ModulatorAmnt),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, ModulatorLeakage),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, Volume),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, VibratoIsActive),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, VibratoSpeed),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, VibratoDepth),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, PWMactive),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, PWMspeed),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, PWMdepth),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, SubOscTune_A),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, SubOscTuningBactive),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, SubOscTune_B),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, FXIsActive),
+		MK_PARAM_BOOL(ctagSoundProcessorTalkbox, FXEnsChor),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, FXDepth),
+		MK_PARAM_INT(ctagSoundProcessorTalkbox, FXAmt),
+	};
+	setParamTable(params);
 	isStereo = true;
 	id = "Talkbox";
 	// sectionCpp0
@@ -397,7 +397,7 @@ void ctagSoundProcessorVctrSnt::Process(const ProcessData &data) {
         CONSTRAIN(f_ScanWavTblA, 0.f, 1.f)
     }
     // --- Render A: Calc wave and apply filter ---
-    float out_A[32] = {0.f};
+    float out_A[bufSz] = {0.f};
     if (isWaveTableGood_A) {
         wt_osc_A.Render(f_freq_A, f_VolWT_A, f_ScanWavTblA, wavetables_A, out_A, bufSz);
         if (t_SubOscPWM_A)   // PWM modulated square-wave as sub-oscillator?
@@ -508,7 +508,7 @@ void ctagSoundProcessorVctrSnt::Process(const ProcessData &data) {
         CONSTRAIN(f_ScanWavTblC, 0.f, 1.f)
     }
     // --- Render C: Calc wave and apply filter ---
-    float out_C[32] = {0.f};
+    float out_C[bufSz] = {0.f};
     if (isWaveTableGood_C) {
         wt_osc_C.Render(f_freq_C, f_VolWT_C, f_ScanWavTblC, wavetables_C, out_C, bufSz);
         if (t_SubOscPWM_C)   // PWM modulated square-wave as sub-oscillator?
@@ -957,254 +957,133 @@ ctagSoundProcessorVctrSnt::~ctagSoundProcessorVctrSnt() {
 void ctagSoundProcessorVctrSnt::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("Gate", [&](const int val) { Gate = val; });
-    pMapTrig.emplace("Gate", [&](const int val) { trig_Gate = val; });
-    pMapPar.emplace("EGvolGate", [&](const int val) { EGvolGate = val; });
-    pMapTrig.emplace("EGvolGate", [&](const int val) { trig_EGvolGate = val; });
-    pMapPar.emplace("MasterPitch", [&](const int val) { MasterPitch = val; });
-    pMapCv.emplace("MasterPitch", [&](const int val) { cv_MasterPitch = val; });
-    pMapPar.emplace("MasterTune", [&](const int val) { MasterTune = val; });
-    pMapCv.emplace("MasterTune", [&](const int val) { cv_MasterTune = val; });
-    pMapPar.emplace("QuantizePitch", [&](const int val) { QuantizePitch = val; });
-    pMapTrig.emplace("QuantizePitch", [&](const int val) { trig_QuantizePitch = val; });
-    pMapPar.emplace("Volume", [&](const int val) { Volume = val; });
-    pMapCv.emplace("Volume", [&](const int val) { cv_Volume = val; });
-    pMapPar.emplace("ExclSubOSCmasterPitch", [&](const int val) { ExclSubOSCmasterPitch = val; });
-    pMapTrig.emplace("ExclSubOSCmasterPitch", [&](const int val) { trig_ExclSubOSCmasterPitch = val; });
-    pMapPar.emplace("ExclWTmasterPitch", [&](const int val) { ExclWTmasterPitch = val; });
-    pMapTrig.emplace("ExclWTmasterPitch", [&](const int val) { trig_ExclWTmasterPitch = val; });
-    pMapPar.emplace("ExclSMPmasterPitch", [&](const int val) { ExclSMPmasterPitch = val; });
-    pMapTrig.emplace("ExclSMPmasterPitch", [&](const int val) { trig_ExclSMPmasterPitch = val; });
-    pMapPar.emplace("PWMintensity", [&](const int val) { PWMintensity = val; });
-    pMapCv.emplace("PWMintensity", [&](const int val) { cv_PWMintensity = val; });
-    pMapPar.emplace("PWMspeed", [&](const int val) { PWMspeed = val; });
-    pMapCv.emplace("PWMspeed", [&](const int val) { cv_PWMspeed = val; });
-    pMapPar.emplace("SubOscPWM_A", [&](const int val) { SubOscPWM_A = val; });
-    pMapTrig.emplace("SubOscPWM_A", [&](const int val) { trig_SubOscPWM_A = val; });
-    pMapPar.emplace("SubOsc2VCF_A", [&](const int val) { SubOsc2VCF_A = val; });
-    pMapTrig.emplace("SubOsc2VCF_A", [&](const int val) { trig_SubOsc2VCF_A = val; });
-    pMapPar.emplace("PitchSubOsc_A", [&](const int val) { PitchSubOsc_A = val; });
-    pMapCv.emplace("PitchSubOsc_A", [&](const int val) { cv_PitchSubOsc_A = val; });
-    pMapPar.emplace("SubOscFade_A", [&](const int val) { SubOscFade_A = val; });
-    pMapCv.emplace("SubOscFade_A", [&](const int val) { cv_SubOscFade_A = val; });
-    pMapPar.emplace("SubOscPWM_C", [&](const int val) { SubOscPWM_C = val; });
-    pMapTrig.emplace("SubOscPWM_C", [&](const int val) { trig_SubOscPWM_C = val; });
-    pMapPar.emplace("SubOsc2VCF_C", [&](const int val) { SubOsc2VCF_C = val; });
-    pMapTrig.emplace("SubOsc2VCF_C", [&](const int val) { trig_SubOsc2VCF_C = val; });
-    pMapPar.emplace("PitchSubOsc_C", [&](const int val) { PitchSubOsc_C = val; });
-    pMapCv.emplace("PitchSubOsc_C", [&](const int val) { cv_PitchSubOsc_C = val; });
-    pMapPar.emplace("SubOscFade_C", [&](const int val) { SubOscFade_C = val; });
-    pMapCv.emplace("SubOscFade_C", [&](const int val) { cv_SubOscFade_C = val; });
-    pMapPar.emplace("VolWT_A", [&](const int val) { VolWT_A = val; });
-    pMapCv.emplace("VolWT_A", [&](const int val) { cv_VolWT_A = val; });
-    pMapPar.emplace("VolOsc_B", [&](const int val) { VolOsc_B = val; });
-    pMapCv.emplace("VolOsc_B", [&](const int val) { cv_VolOsc_B = val; });
-    pMapPar.emplace("VolWT_C", [&](const int val) { VolWT_C = val; });
-    pMapCv.emplace("VolWT_C", [&](const int val) { cv_VolWT_C = val; });
-    pMapPar.emplace("VolOsc_D", [&](const int val) { VolOsc_D = val; });
-    pMapCv.emplace("VolOsc_D", [&](const int val) { cv_VolOsc_D = val; });
-    pMapPar.emplace("StereoSplit", [&](const int val) { StereoSplit = val; });
-    pMapTrig.emplace("StereoSplit", [&](const int val) { trig_StereoSplit = val; });
-    pMapPar.emplace("XfadeWaveTbls", [&](const int val) { XfadeWaveTbls = val; });
-    pMapCv.emplace("XfadeWaveTbls", [&](const int val) { cv_XfadeWaveTbls = val; });
-    pMapPar.emplace("XfadeSamples", [&](const int val) { XfadeSamples = val; });
-    pMapCv.emplace("XfadeSamples", [&](const int val) { cv_XfadeSamples = val; });
-    pMapPar.emplace("LfoWTxFadeActive_1", [&](const int val) { LfoWTxFadeActive_1 = val; });
-    pMapTrig.emplace("LfoWTxFadeActive_1", [&](const int val) { trig_LfoWTxFadeActive_1 = val; });
-    pMapPar.emplace("LfoTypeWTxFade_1", [&](const int val) { LfoTypeWTxFade_1 = val; });
-    pMapCv.emplace("LfoTypeWTxFade_1", [&](const int val) { cv_LfoTypeWTxFade_1 = val; });
-    pMapPar.emplace("LfoWTxFadeRange_1", [&](const int val) { LfoWTxFadeRange_1 = val; });
-    pMapCv.emplace("LfoWTxFadeRange_1", [&](const int val) { cv_LfoWTxFadeRange_1 = val; });
-    pMapPar.emplace("LfoWTxFadeSpeed_1", [&](const int val) { LfoWTxFadeSpeed_1 = val; });
-    pMapCv.emplace("LfoWTxFadeSpeed_1", [&](const int val) { cv_LfoWTxFadeSpeed_1 = val; });
-    pMapPar.emplace("LfoWTxFadeActive_2", [&](const int val) { LfoWTxFadeActive_2 = val; });
-    pMapTrig.emplace("LfoWTxFadeActive_2", [&](const int val) { trig_LfoWTxFadeActive_2 = val; });
-    pMapPar.emplace("ModulateSubOscXfade_A", [&](const int val) { ModulateSubOscXfade_A = val; });
-    pMapTrig.emplace("ModulateSubOscXfade_A", [&](const int val) { trig_ModulateSubOscXfade_A = val; });
-    pMapPar.emplace("LfoTypeWTxFade_2", [&](const int val) { LfoTypeWTxFade_2 = val; });
-    pMapCv.emplace("LfoTypeWTxFade_2", [&](const int val) { cv_LfoTypeWTxFade_2 = val; });
-    pMapPar.emplace("LfoWTxFadeRange_2", [&](const int val) { LfoWTxFadeRange_2 = val; });
-    pMapCv.emplace("LfoWTxFadeRange_2", [&](const int val) { cv_LfoWTxFadeRange_2 = val; });
-    pMapPar.emplace("LfoWTxFadeSpeed_2", [&](const int val) { LfoWTxFadeSpeed_2 = val; });
-    pMapCv.emplace("LfoWTxFadeSpeed_2", [&](const int val) { cv_LfoWTxFadeSpeed_2 = val; });
-    pMapPar.emplace("LfoSAMPxFadeActive_1", [&](const int val) { LfoSAMPxFadeActive_1 = val; });
-    pMapTrig.emplace("LfoSAMPxFadeActive_1", [&](const int val) { trig_LfoSAMPxFadeActive_1 = val; });
-    pMapPar.emplace("LfoTypeSAMPxFade_1", [&](const int val) { LfoTypeSAMPxFade_1 = val; });
-    pMapCv.emplace("LfoTypeSAMPxFade_1", [&](const int val) { cv_LfoTypeSAMPxFade_1 = val; });
-    pMapPar.emplace("LfoSAMPxFadeRange_1", [&](const int val) { LfoSAMPxFadeRange_1 = val; });
-    pMapCv.emplace("LfoSAMPxFadeRange_1", [&](const int val) { cv_LfoSAMPxFadeRange_1 = val; });
-    pMapPar.emplace("LfoSAMPxFadeSpeed_1", [&](const int val) { LfoSAMPxFadeSpeed_1 = val; });
-    pMapCv.emplace("LfoSAMPxFadeSpeed_1", [&](const int val) { cv_LfoSAMPxFadeSpeed_1 = val; });
-    pMapPar.emplace("LfoSAMPxFadeActive_2", [&](const int val) { LfoSAMPxFadeActive_2 = val; });
-    pMapTrig.emplace("LfoSAMPxFadeActive_2", [&](const int val) { trig_LfoSAMPxFadeActive_2 = val; });
-    pMapPar.emplace("ModulateSubOscXfade_C", [&](const int val) { ModulateSubOscXfade_C = val; });
-    pMapTrig.emplace("ModulateSubOscXfade_C", [&](const int val) { trig_ModulateSubOscXfade_C = val; });
-    pMapPar.emplace("LfoTypeSAMPxFade_2", [&](const int val) { LfoTypeSAMPxFade_2 = val; });
-    pMapCv.emplace("LfoTypeSAMPxFade_2", [&](const int val) { cv_LfoTypeSAMPxFade_2 = val; });
-    pMapPar.emplace("LfoSAMPxFadeRange_2", [&](const int val) { LfoSAMPxFadeRange_2 = val; });
-    pMapCv.emplace("LfoSAMPxFadeRange_2", [&](const int val) { cv_LfoSAMPxFadeRange_2 = val; });
-    pMapPar.emplace("LfoSAMPxFadeSpeed_2", [&](const int val) { LfoSAMPxFadeSpeed_2 = val; });
-    pMapCv.emplace("LfoSAMPxFadeSpeed_2", [&](const int val) { cv_LfoSAMPxFadeSpeed_2 = val; });
-    pMapPar.emplace("WaveTblA", [&](const int val) { WaveTblA = val; });
-    pMapCv.emplace("WaveTblA", [&](const int val) { cv_WaveTblA = val; });
-    pMapPar.emplace("ScanWavTblA", [&](const int val) { ScanWavTblA = val; });
-    pMapCv.emplace("ScanWavTblA", [&](const int val) { cv_ScanWavTblA = val; });
-    pMapPar.emplace("pitch_A", [&](const int val) { pitch_A = val; });
-    pMapCv.emplace("pitch_A", [&](const int val) { cv_pitch_A = val; });
-    pMapPar.emplace("tune_A", [&](const int val) { tune_A = val; });
-    pMapCv.emplace("tune_A", [&](const int val) { cv_tune_A = val; });
-    pMapPar.emplace("ScanWavTbl_A", [&](const int val) { ScanWavTbl_A = val; });
-    pMapTrig.emplace("ScanWavTbl_A", [&](const int val) { trig_ScanWavTbl_A = val; });
-    pMapPar.emplace("LFOzScanType_A", [&](const int val) { LFOzScanType_A = val; });
-    pMapCv.emplace("LFOzScanType_A", [&](const int val) { cv_LFOzScanType_A = val; });
-    pMapPar.emplace("LFOzScanAmt_A", [&](const int val) { LFOzScanAmt_A = val; });
-    pMapCv.emplace("LFOzScanAmt_A", [&](const int val) { cv_LFOzScanAmt_A = val; });
-    pMapPar.emplace("LFOzScanSpeed_A", [&](const int val) { LFOzScanSpeed_A = val; });
-    pMapCv.emplace("LFOzScanSpeed_A", [&](const int val) { cv_LFOzScanSpeed_A = val; });
-    pMapPar.emplace("fmode_A", [&](const int val) { fmode_A = val; });
-    pMapCv.emplace("fmode_A", [&](const int val) { cv_fmode_A = val; });
-    pMapPar.emplace("fcut_A", [&](const int val) { fcut_A = val; });
-    pMapCv.emplace("fcut_A", [&](const int val) { cv_fcut_A = val; });
-    pMapPar.emplace("freso_A", [&](const int val) { freso_A = val; });
-    pMapCv.emplace("freso_A", [&](const int val) { cv_freso_A = val; });
-    pMapPar.emplace("FilterLFOon_A", [&](const int val) { FilterLFOon_A = val; });
-    pMapTrig.emplace("FilterLFOon_A", [&](const int val) { trig_FilterLFOon_A = val; });
-    pMapPar.emplace("LFOfilterType_A", [&](const int val) { LFOfilterType_A = val; });
-    pMapCv.emplace("LFOfilterType_A", [&](const int val) { cv_LFOfilterType_A = val; });
-    pMapPar.emplace("lfo2filtfm_A", [&](const int val) { lfo2filtfm_A = val; });
-    pMapCv.emplace("lfo2filtfm_A", [&](const int val) { cv_lfo2filtfm_A = val; });
-    pMapPar.emplace("lfospeed_A", [&](const int val) { lfospeed_A = val; });
-    pMapCv.emplace("lfospeed_A", [&](const int val) { cv_lfospeed_A = val; });
-    pMapPar.emplace("bank_B", [&](const int val) { bank_B = val; });
-    pMapCv.emplace("bank_B", [&](const int val) { cv_bank_B = val; });
-    pMapPar.emplace("slice_B", [&](const int val) { slice_B = val; });
-    pMapCv.emplace("slice_B", [&](const int val) { cv_slice_B = val; });
-    pMapPar.emplace("speed_B", [&](const int val) { speed_B = val; });
-    pMapCv.emplace("speed_B", [&](const int val) { cv_speed_B = val; });
-    pMapPar.emplace("pitch_B", [&](const int val) { pitch_B = val; });
-    pMapCv.emplace("pitch_B", [&](const int val) { cv_pitch_B = val; });
-    pMapPar.emplace("tune_B", [&](const int val) { tune_B = val; });
-    pMapCv.emplace("tune_B", [&](const int val) { cv_tune_B = val; });
-    pMapPar.emplace("start_B", [&](const int val) { start_B = val; });
-    pMapCv.emplace("start_B", [&](const int val) { cv_start_B = val; });
-    pMapPar.emplace("length_B", [&](const int val) { length_B = val; });
-    pMapCv.emplace("length_B", [&](const int val) { cv_length_B = val; });
-    pMapPar.emplace("loop_B", [&](const int val) { loop_B = val; });
-    pMapTrig.emplace("loop_B", [&](const int val) { trig_loop_B = val; });
-    pMapPar.emplace("loop_pipo_B", [&](const int val) { loop_pipo_B = val; });
-    pMapTrig.emplace("loop_pipo_B", [&](const int val) { trig_loop_pipo_B = val; });
-    pMapPar.emplace("lpstart_B", [&](const int val) { lpstart_B = val; });
-    pMapCv.emplace("lpstart_B", [&](const int val) { cv_lpstart_B = val; });
-    pMapPar.emplace("fmode_B", [&](const int val) { fmode_B = val; });
-    pMapCv.emplace("fmode_B", [&](const int val) { cv_fmode_B = val; });
-    pMapPar.emplace("fcut_B", [&](const int val) { fcut_B = val; });
-    pMapCv.emplace("fcut_B", [&](const int val) { cv_fcut_B = val; });
-    pMapPar.emplace("freso_B", [&](const int val) { freso_B = val; });
-    pMapCv.emplace("freso_B", [&](const int val) { cv_freso_B = val; });
-    pMapPar.emplace("FilterLFOon_B", [&](const int val) { FilterLFOon_B = val; });
-    pMapTrig.emplace("FilterLFOon_B", [&](const int val) { trig_FilterLFOon_B = val; });
-    pMapPar.emplace("lfo2filtfm_B", [&](const int val) { lfo2filtfm_B = val; });
-    pMapCv.emplace("lfo2filtfm_B", [&](const int val) { cv_lfo2filtfm_B = val; });
-    pMapPar.emplace("lfospeed_B", [&](const int val) { lfospeed_B = val; });
-    pMapCv.emplace("lfospeed_B", [&](const int val) { cv_lfospeed_B = val; });
-    pMapPar.emplace("WaveTblC", [&](const int val) { WaveTblC = val; });
-    pMapCv.emplace("WaveTblC", [&](const int val) { cv_WaveTblC = val; });
-    pMapPar.emplace("ScanWavTblC", [&](const int val) { ScanWavTblC = val; });
-    pMapCv.emplace("ScanWavTblC", [&](const int val) { cv_ScanWavTblC = val; });
-    pMapPar.emplace("pitch_C", [&](const int val) { pitch_C = val; });
-    pMapCv.emplace("pitch_C", [&](const int val) { cv_pitch_C = val; });
-    pMapPar.emplace("tune_C", [&](const int val) { tune_C = val; });
-    pMapCv.emplace("tune_C", [&](const int val) { cv_tune_C = val; });
-    pMapPar.emplace("ScanWavTbl_C", [&](const int val) { ScanWavTbl_C = val; });
-    pMapTrig.emplace("ScanWavTbl_C", [&](const int val) { trig_ScanWavTbl_C = val; });
-    pMapPar.emplace("LFOzScanType_C", [&](const int val) { LFOzScanType_C = val; });
-    pMapCv.emplace("LFOzScanType_C", [&](const int val) { cv_LFOzScanType_C = val; });
-    pMapPar.emplace("LFOzScanAmt_C", [&](const int val) { LFOzScanAmt_C = val; });
-    pMapCv.emplace("LFOzScanAmt_C", [&](const int val) { cv_LFOzScanAmt_C = val; });
-    pMapPar.emplace("LFOzScanSpeed_C", [&](const int val) { LFOzScanSpeed_C = val; });
-    pMapCv.emplace("LFOzScanSpeed_C", [&](const int val) { cv_LFOzScanSpeed_C = val; });
-    pMapPar.emplace("fmode_C", [&](const int val) { fmode_C = val; });
-    pMapCv.emplace("fmode_C", [&](const int val) { cv_fmode_C = val; });
-    pMapPar.emplace("fcut_C", [&](const int val) { fcut_C = val; });
-    pMapCv.emplace("fcut_C", [&](const int val) { cv_fcut_C = val; });
-    pMapPar.emplace("freso_C", [&](const int val) { freso_C = val; });
-    pMapCv.emplace("freso_C", [&](const int val) { cv_freso_C = val; });
-    pMapPar.emplace("FilterLFOon_C", [&](const int val) { FilterLFOon_C = val; });
-    pMapTrig.emplace("FilterLFOon_C", [&](const int val) { trig_FilterLFOon_C = val; });
-    pMapPar.emplace("LFOfilterType_C", [&](const int val) { LFOfilterType_C = val; });
-    pMapCv.emplace("LFOfilterType_C", [&](const int val) { cv_LFOfilterType_C = val; });
-    pMapPar.emplace("lfo2filtfm_C", [&](const int val) { lfo2filtfm_C = val; });
-    pMapCv.emplace("lfo2filtfm_C", [&](const int val) { cv_lfo2filtfm_C = val; });
-    pMapPar.emplace("lfospeed_C", [&](const int val) { lfospeed_C = val; });
-    pMapCv.emplace("lfospeed_C", [&](const int val) { cv_lfospeed_C = val; });
-    pMapPar.emplace("bank_D", [&](const int val) { bank_D = val; });
-    pMapCv.emplace("bank_D", [&](const int val) { cv_bank_D = val; });
-    pMapPar.emplace("slice_D", [&](const int val) { slice_D = val; });
-    pMapCv.emplace("slice_D", [&](const int val) { cv_slice_D = val; });
-    pMapPar.emplace("speed_D", [&](const int val) { speed_D = val; });
-    pMapCv.emplace("speed_D", [&](const int val) { cv_speed_D = val; });
-    pMapPar.emplace("pitch_D", [&](const int val) { pitch_D = val; });
-    pMapCv.emplace("pitch_D", [&](const int val) { cv_pitch_D = val; });
-    pMapPar.emplace("tune_D", [&](const int val) { tune_D = val; });
-    pMapCv.emplace("tune_D", [&](const int val) { cv_tune_D = val; });
-    pMapPar.emplace("start_D", [&](const int val) { start_D = val; });
-    pMapCv.emplace("start_D", [&](const int val) { cv_start_D = val; });
-    pMapPar.emplace("length_D", [&](const int val) { length_D = val; });
-    pMapCv.emplace("length_D", [&](const int val) { cv_length_D = val; });
-    pMapPar.emplace("loop_D", [&](const int val) { loop_D = val; });
-    pMapTrig.emplace("loop_D", [&](const int val) { trig_loop_D = val; });
-    pMapPar.emplace("loop_pipo_D", [&](const int val) { loop_pipo_D = val; });
-    pMapTrig.emplace("loop_pipo_D", [&](const int val) { trig_loop_pipo_D = val; });
-    pMapPar.emplace("lpstart_D", [&](const int val) { lpstart_D = val; });
-    pMapCv.emplace("lpstart_D", [&](const int val) { cv_lpstart_D = val; });
-    pMapPar.emplace("fmode_D", [&](const int val) { fmode_D = val; });
-    pMapCv.emplace("fmode_D", [&](const int val) { cv_fmode_D = val; });
-    pMapPar.emplace("fcut_D", [&](const int val) { fcut_D = val; });
-    pMapCv.emplace("fcut_D", [&](const int val) { cv_fcut_D = val; });
-    pMapPar.emplace("freso_D", [&](const int val) { freso_D = val; });
-    pMapCv.emplace("freso_D", [&](const int val) { cv_freso_D = val; });
-    pMapPar.emplace("FilterLFOon_D", [&](const int val) { FilterLFOon_D = val; });
-    pMapTrig.emplace("FilterLFOon_D", [&](const int val) { trig_FilterLFOon_D = val; });
-    pMapPar.emplace("lfo2filtfm_D", [&](const int val) { lfo2filtfm_D = val; });
-    pMapCv.emplace("lfo2filtfm_D", [&](const int val) { cv_lfo2filtfm_D = val; });
-    pMapPar.emplace("lfospeed_D", [&](const int val) { lfospeed_D = val; });
-    pMapCv.emplace("lfospeed_D", [&](const int val) { cv_lfospeed_D = val; });
-    pMapPar.emplace("FreqModActive", [&](const int val) { FreqModActive = val; });
-    pMapTrig.emplace("FreqModActive", [&](const int val) { trig_FreqModActive = val; });
-    pMapPar.emplace("FreqModExclSubOSC", [&](const int val) { FreqModExclSubOSC = val; });
-    pMapTrig.emplace("FreqModExclSubOSC", [&](const int val) { trig_FreqModExclSubOSC = val; });
-    pMapPar.emplace("FreqModExclWT", [&](const int val) { FreqModExclWT = val; });
-    pMapTrig.emplace("FreqModExclWT", [&](const int val) { trig_FreqModExclWT = val; });
-    pMapPar.emplace("FreqModExclSample", [&](const int val) { FreqModExclSample = val; });
-    pMapTrig.emplace("FreqModExclSample", [&](const int val) { trig_FreqModExclSample = val; });
-    pMapPar.emplace("FreqModType", [&](const int val) { FreqModType = val; });
-    pMapCv.emplace("FreqModType", [&](const int val) { cv_FreqModType = val; });
-    pMapPar.emplace("FreqModAmnt", [&](const int val) { FreqModAmnt = val; });
-    pMapCv.emplace("FreqModAmnt", [&](const int val) { cv_FreqModAmnt = val; });
-    pMapPar.emplace("FreqModSpeed", [&](const int val) { FreqModSpeed = val; });
-    pMapCv.emplace("FreqModSpeed", [&](const int val) { cv_FreqModSpeed = val; });
-    pMapPar.emplace("FreqModAnalog", [&](const int val) { FreqModAnalog = val; });
-    pMapCv.emplace("FreqModAnalog", [&](const int val) { cv_FreqModAnalog = val; });
-    pMapPar.emplace("EGvolActive", [&](const int val) { EGvolActive = val; });
-    pMapTrig.emplace("EGvolActive", [&](const int val) { trig_EGvolActive = val; });
-    pMapPar.emplace("EGvolSlow", [&](const int val) { EGvolSlow = val; });
-    pMapTrig.emplace("EGvolSlow", [&](const int val) { trig_EGvolSlow = val; });
-    pMapPar.emplace("AttackVol", [&](const int val) { AttackVol = val; });
-    pMapCv.emplace("AttackVol", [&](const int val) { cv_AttackVol = val; });
-    pMapPar.emplace("DecayVol", [&](const int val) { DecayVol = val; });
-    pMapCv.emplace("DecayVol", [&](const int val) { cv_DecayVol = val; });
-    pMapPar.emplace("EGvolADSRon", [&](const int val) { EGvolADSRon = val; });
-    pMapTrig.emplace("EGvolADSRon", [&](const int val) { trig_EGvolADSRon = val; });
-    pMapPar.emplace("SustainVol", [&](const int val) { SustainVol = val; });
-    pMapCv.emplace("SustainVol", [&](const int val) { cv_SustainVol = val; });
-    pMapPar.emplace("ReleaseVol", [&](const int val) { ReleaseVol = val; });
-    pMapCv.emplace("ReleaseVol", [&](const int val) { cv_ReleaseVol = val; });
-    pMapPar.emplace("PannerOn", [&](const int val) { PannerOn = val; });
-    pMapTrig.emplace("PannerOn", [&](const int val) { trig_PannerOn = val; });
-    pMapPar.emplace("PanAmnt", [&](const int val) { PanAmnt = val; });
-    pMapCv.emplace("PanAmnt", [&](const int val) { cv_PanAmnt = val; });
-    pMapPar.emplace("PanFreq", [&](const int val) { PanFreq = val; });
-    pMapCv.emplace("PanFreq", [&](const int val) { cv_PanFreq = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, Gate),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, EGvolGate),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, MasterPitch),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, MasterTune),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, QuantizePitch),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, Volume),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ExclSubOSCmasterPitch),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ExclWTmasterPitch),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ExclSMPmasterPitch),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PWMintensity),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PWMspeed),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, SubOscPWM_A),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, SubOsc2VCF_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PitchSubOsc_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, SubOscFade_A),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, SubOscPWM_C),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, SubOsc2VCF_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PitchSubOsc_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, SubOscFade_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, VolWT_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, VolOsc_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, VolWT_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, VolOsc_D),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, StereoSplit),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, XfadeWaveTbls),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, XfadeSamples),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, LfoWTxFadeActive_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoTypeWTxFade_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoWTxFadeRange_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoWTxFadeSpeed_1),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, LfoWTxFadeActive_2),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ModulateSubOscXfade_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoTypeWTxFade_2),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoWTxFadeRange_2),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoWTxFadeSpeed_2),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, LfoSAMPxFadeActive_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoTypeSAMPxFade_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoSAMPxFadeRange_1),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoSAMPxFadeSpeed_1),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, LfoSAMPxFadeActive_2),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ModulateSubOscXfade_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoTypeSAMPxFade_2),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoSAMPxFadeRange_2),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LfoSAMPxFadeSpeed_2),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, WaveTblA),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, ScanWavTblA),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, pitch_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, tune_A),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ScanWavTbl_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanType_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanAmt_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanSpeed_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fmode_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fcut_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, freso_A),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FilterLFOon_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOfilterType_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfo2filtfm_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfospeed_A),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, bank_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, slice_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, speed_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, pitch_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, tune_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, start_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, length_B),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, loop_B),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, loop_pipo_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lpstart_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fmode_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fcut_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, freso_B),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FilterLFOon_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfo2filtfm_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfospeed_B),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, WaveTblC),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, ScanWavTblC),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, pitch_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, tune_C),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, ScanWavTbl_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanType_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanAmt_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOzScanSpeed_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fmode_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fcut_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, freso_C),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FilterLFOon_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, LFOfilterType_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfo2filtfm_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfospeed_C),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, bank_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, slice_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, speed_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, pitch_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, tune_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, start_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, length_D),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, loop_D),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, loop_pipo_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lpstart_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fmode_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, fcut_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, freso_D),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FilterLFOon_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfo2filtfm_D),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, lfospeed_D),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FreqModActive),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FreqModExclSubOSC),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FreqModExclWT),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, FreqModExclSample),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, FreqModType),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, FreqModAmnt),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, FreqModSpeed),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, FreqModAnalog),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, EGvolActive),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, EGvolSlow),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, AttackVol),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, DecayVol),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, EGvolADSRon),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, SustainVol),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, ReleaseVol),
+        MK_PARAM_BOOL(ctagSoundProcessorVctrSnt, PannerOn),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PanAmnt),
+        MK_PARAM_INT(ctagSoundProcessorVctrSnt, PanFreq),
+    };
+    setParamTable(params);
     isStereo = true;
     id = "VctrSnt";
     // sectionCpp0
@@ -18,8 +18,10 @@ ctagSoundProcessorVoid::~ctagSoundProcessorVoid() {
 void ctagSoundProcessorVoid::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("dummy", [&](const int val){ dummy = val;});
-	pMapTrig.emplace("dummy", [&](const int val){ trig_dummy = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_BOOL(ctagSoundProcessorVoid, dummy),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "Void";
 	// sectionCpp0
@@ -30,8 +30,9 @@ using namespace CTAG::SP::HELPERS;
 void ctagSoundProcessorWTOsc::Process(const ProcessData &data) {
     // wave select
     currentBank = wavebank;
-	if(cv_wave != -1) ONE_POLE(fWave, fabsf(data.cv[cv_wave]), 0.1f)
-	else fWave = wave / 4095.f;
+    if (cv_wave != -1) waveSmoother.Next(fabsf(data.cv[cv_wave]));
+    else waveSmoother.Reset(wave / 4095.f);
+    const float fWave = waveSmoother.GetValue();
 
 
     if(lastBank != currentBank){ // this is slow, hence not modulated by CV
@@ -136,7 +137,7 @@ void ctagSoundProcessorWTOsc::Process(const ProcessData &data) {
     pre_fWt = fWt;
 
     // calc wave and apply filter
-    float out[32] = {0.f};
+    float out[bufSz] = {0.f};
     if(isWaveTableGood){
         oscillator.Render(trigger, f0, fAM, fWt, wavetables, out, bufSz);
 
@@ -170,8 +171,7 @@ void ctagSoundProcessorWTOsc::Init(std::size_t blockSize, void *blockPtr) {
     lfo.SetFrequency(1.f);
     // alloc mem for one wavetable
     // 260 = wavetable size after prep, 64 wavetables, 2 bytes per sample (int16)
-    int totalBlockSzRequired = 260*64*2 + 512*4;
-    assert(totalBlockSzRequired < blockSize);
+    assert(blockSize >= blockMemSize);
     buffer = (int16_t*)blockPtr;
     blockPtr = static_cast<uint8_t *>(blockPtr) + 260 * 64 * 2;
     memset(buffer, 0, 260 * 64 * 2);
@@ -185,6 +185,7 @@ void ctagSoundProcessorWTOsc::Init(std::size_t blockSize, void *blockPtr) {
     adsr.SetSampleRate(44100.f / bufSz);
     adsr.Reset();
     pitchQuantizer.Init();
+    waveSmoother.Init(ctagSmoothedParam::ONE_POLE, 7.f, bufSz); // approx. former 0.1 per block at 32 frames
 }
 
 ctagSoundProcessorWTOsc::~ctagSoundProcessorWTOsc() {
@@ -193,56 +194,34 @@ ctagSoundProcessorWTOsc::~ctagSoundProcessorWTOsc() {
 void ctagSoundProcessorWTOsc::knowYourself(){
     // autogenerated code here
     // sectionCpp0
-	pMapPar.emplace("gain", [&](const int val){ gain = val;});
-	pMapCv.emplace("gain", [&](const int val){ cv_gain = val;});
-	pMapPar.emplace("gate", [&](const int val){ gate = val;});
-	pMapTrig.emplace("gate", [&](const int val){ trig_gate = val;});
-	pMapPar.emplace("pitch", [&](const int val){ pitch = val;});
-	pMapCv.emplace("pitch", [&](const int val){ cv_pitch = val;});
-	pMapPar.emplace("q_scale", [&](const int val){ q_scale = val;});
-	pMapCv.emplace("q_scale", [&](const int val){ cv_q_scale = val;});
-	pMapPar.emplace("tune", [&](const int val){ tune = val;});
-	pMapCv.emplace("tune", [&](const int val){ cv_tune = val;});
-	pMapPar.emplace("wavebank", [&](const int val){ wavebank = val;});
-	pMapCv.emplace("wavebank", [&](const int val){ cv_wavebank = val;});
-	pMapPar.emplace("wave", [&](const int val){ wave = val;});
-	pMapCv.emplace("wave", [&](const int val){ cv_wave = val;});
-	pMapPar.emplace("fmode", [&](const int val){ fmode = val;});
-	pMapCv.emplace("fmode", [&](const int val){ cv_fmode = val;});
-	pMapPar.emplace("fcut", [&](const int val){ fcut = val;});
-	pMapCv.emplace("fcut", [&](const int val){ cv_fcut = val;});
-	pMapPar.emplace("freso", [&](const int val){ freso = val;});
-	pMapCv.emplace("freso", [&](const int val){ cv_freso = val;});
-	pMapPar.emplace("lfo2wave", [&](const int val){ lfo2wave = val;});
-	pMapCv.emplace("lfo2wave", [&](const int val){ cv_lfo2wave = val;});
-	pMapPar.emplace("lfo2am", [&](const int val){ lfo2am = val;});
-	pMapCv.emplace("lfo2am", [&](const int val){ cv_lfo2am = val;});
-	pMapPar.emplace("lfo2fm", [&](const int val){ lfo2fm = val;});
-	pMapCv.emplace("lfo2fm", [&](const int val){ cv_lfo2fm = val;});
-	pMapPar.emplace("lfo2filtfm", [&](const int val){ lfo2filtfm = val;});
-	pMapCv.emplace("lfo2filtfm", [&](const int val){ cv_lfo2filtfm = val;});
-	pMapPar.emplace("eg2wave", [&](const int val){ eg2wave = val;});
-	pMapCv.emplace("eg2wave", [&](const int val){ cv_eg2wave = val;});
-	pMapPar.emplace("eg2am", [&](const int val){ eg2am = val;});
-	pMapCv.emplace("eg2am", [&](const int val){ cv_eg2am = val;});
-	pMapPar.emplace("eg2fm", [&](const int val){ eg2fm = val;});
-	pMapCv.emplace("eg2fm", [&](const int val){ cv_eg2fm = val;});
-	pMapPar.emplace("eg2filtfm", [&](const int val){ eg2filtfm = val;});
-	pMapCv.emplace("eg2filtfm", [&](const int val){ cv_eg2filtfm = val;});
-	pMapPar.emplace("lfospeed", [&](const int val){ lfospeed = val;});
-	pMapCv.emplace("lfospeed", [&](const int val){ cv_lfospeed = val;});
-	pMapPar.emplace("lfosync", [&](const int val){ lfosync = val;});
-	pMapTrig.emplace("lfosync", [&](const int val){ trig_lfosync = val;});
-	pMapPar.emplace("egfasl", [&](const int val){ egfasl = val;});
-	pMapTrig.emplace("egfasl", [&](const int val){ trig_egfasl = val;});
-	pMapPar.emplace("attack", [&](const int val){ attack = val;});
-	pMapCv.emplace("attack", [&](const int val){ cv_attack = val;});
-	pMapPar.emplace("decay", [&](const int val){ decay = val;});
-	pMapCv.emplace("decay", [&](const int val){ cv_decay = val;});
-	pMapPar.emplace("sustain", [&](const int val){ sustain = val;});
-	pMapCv.emplace("sustain", [&](const int val){ cv_sustain = val;});
-	pMapPar.emplace("release", [&](const int val){ release = val;});
-	pMapCv.emplace("release", [&](const int val){ cv_release = val;});
+	static constexpr ctagParamDesc params[] {
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, gain),
+		MK_PARAM_BOOL(ctagSoundProcessorWTOsc, gate),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, pitch),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, q_scale),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, tune),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, wavebank),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, wave),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, fmode),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, fcut),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, freso),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, lfo2wave),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, lfo2am),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, lfo2fm),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, lfo2filtfm),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, eg2wave),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, eg2am),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, eg2fm),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, eg2filtfm),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, lfospeed),
+		MK_PARAM_BOOL(ctagSoundProcessorWTOsc, lfosync),
+		MK_PARAM_BOOL(ctagSoundProcessorWTOsc, egfasl),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, attack),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, decay),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, sustain),
+		MK_PARAM_INT(ctagSoundProcessorWTOsc, release),
+	};
+	setParamTable(params);
 	isStereo = false;
 	id = "WTOsc";
 	// sectionCpp0
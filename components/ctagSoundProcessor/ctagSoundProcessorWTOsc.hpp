@@ -37,6 +37,7 @@ namespace CTAG {
         public:
             virtual void Process(const ProcessData &) override;
            virtual void Init(std::size_t blockSize, void *blockPtr) override;
+           static constexpr std::size_t blockMemSize = 260 * 64 * 2 + 512 * 4;
             virtual ~ctagSoundProcessorWTOsc();
 
         private:
@@ -49,7 +50,7 @@ namespace CTAG {
             stmlib::Svf svf;
             int16_t *buffer = NULL;
             float *fbuffer = NULL;
-        	float fWave = 0.f;
+            HELPERS::ctagSmoothedParam waveSmoother;
             const int16_t *wavetables[64];
             int currentBank = 0;
             int lastBank = -1;
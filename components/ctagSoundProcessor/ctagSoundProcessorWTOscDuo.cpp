@@ -30,10 +30,12 @@ using namespace CTAG::SP::HELPERS;
 void ctagSoundProcessorWTOscDuo::Process(const ProcessData &data) {
     // wave select
     currentBank = wavebank;
-    if(cv_wave_1 != -1) ONE_POLE(fwave_1, fabsf(data.cv[cv_wave_1]), 0.1f)
-    else fwave_1 = wave_1 / 4095.f;
-    if(cv_wave_2 != -1) ONE_POLE(fwave_2, fabsf(data.cv[cv_wave_1]), 0.1f)
-    else fwave_2 = wave_2 / 4095.f;
+    if (cv_wave_1 != -1) waveSmoother_1.Next(fabsf(data.cv[cv_wave_1]));
+    else waveSmoother_1.Reset(wave_1 / 4095.f);
+    if (cv_wave_2 != -1) waveSmoother_2.Next(fabsf(data.cv[cv_wave_1]));
+    else waveSmoother_2.Reset(wave_2 / 4095.f);
+    const float fwave_1 = waveSmoother_1.GetValue();
+    const float fwave_2 = waveSmoother_2.GetValue();
 
     if (lastBank != currentBank) { // this is slow, hence not modulated by CV
         prepareWavetables();
@@ -201,7 +203,7 @@ void ctagSoundProcessorWTOscDuo::Process(const ProcessData &data) {
     pre_fWt_2 = fWt_2;
 
     // calc wave and apply filter
-    float out_1[32] = {0.f};
+    float out_1[bufSz] = {0.f};
     if (isWaveTableGood) {
         oscillator_1.Render(trigger1, f_1, fAM_1, fWt_1, wavetables, out_1, bufSz);
 
@@ -219,7 +221,7 @@ void ctagSoundProcessorWTOscDuo::Process(const ProcessData &data) {
         }
     }
     // calc wave and apply filter
-    float out_2[32] = {0.f};
+    float out_2[bufSz] = {0.f};
     if (isWaveTableGood) {
         oscillator_2.Render(trigger2, f_2, fAM_2, fWt_2, wavetables, out_2, bufSz);
 
@@ -257,8 +259,7 @@ void ctagSoundProcessorWTOscDuo::Init(std::size_t blockSize, void *blockPtr) {
     // alloc mem for one wavetable
 
     // 260 = wavetable size after prep, 64 wavetables, 2 bytes per sample (int16)
-    int totalBlockSzRequired = 260 * 64 * 2 + 512 * 4;
-    assert(totalBlockSzRequired < blockSize);
+    assert(blockSize >= blockMemSize);
     buffer = (int16_t *) blockPtr;
     blockPtr = static_cast<uint8_t *>(blockPtr) + 260 * 64 * 2;
     memset(buffer, 0, 260 * 64 * 2);
@@ -278,6 +279,8 @@ void ctagSoundProcessorWTOscDuo::Init(std::size_t blockSize, void *blockPtr) {
     adsr_2.SetSampleRate(44100.f / bufSz);
     adsr_2.Reset();
     pitchQuantizer.Init();
+    waveSmoother_1.Init(ctagSmoothedParam::ONE_POLE, 7.f, bufSz); // approx. former 0.1 per block at 32 frames
+    waveSmoother_2.Init(ctagSmoothedParam::ONE_POLE, 7.f, bufSz);
 }
 
 ctagSoundProcessorWTOscDuo::~ctagSoundProcessorWTOscDuo() {
@@ -333,72 +336,42 @@ void ctagSoundProcessorWTOscDuo::prepareWavetables() {
 void ctagSoundProcessorWTOscDuo::knowYourself() {
     // autogenerated code here
     // sectionCpp0
-    pMapPar.emplace("gain_1", [&](const int val) { gain_1 = val; });
-    pMapCv.emplace("gain_1", [&](const int val) { cv_gain_1 = val; });
-    pMapPar.emplace("gain_2", [&](const int val) { gain_2 = val; });
-    pMapCv.emplace("gain_2", [&](const int val) { cv_gain_2 = val; });
-    pMapPar.emplace("gate_1", [&](const int val) { gate_1 = val; });
-    pMapTrig.emplace("gate_1", [&](const int val) { trig_gate_1 = val; });
-    pMapPar.emplace("pitch_1", [&](const int val) { pitch_1 = val; });
-    pMapCv.emplace("pitch_1", [&](const int val) { cv_pitch_1 = val; });
-    pMapPar.emplace("gate_2", [&](const int val) { gate_2 = val; });
-    pMapTrig.emplace("gate_2", [&](const int val) { trig_gate_2 = val; });
-    pMapPar.emplace("pitch_2", [&](const int val) { pitch_2 = val; });
-    pMapCv.emplace("pitch_2", [&](const int val) { cv_pitch_2 = val; });
-    pMapPar.emplace("q_scale", [&](const int val) { q_scale = val; });
-    pMapCv.emplace("q_scale", [&](const int val) { cv_q_scale = val; });
-    pMapPar.emplace("tune_1", [&](const int val) { tune_1 = val; });
-    pMapCv.emplace("tune_1", [&](const int val) { cv_tune_1 = val; });
-    pMapPar.emplace("tune_2", [&](const int val) { tune_2 = val; });
-    pMapCv.emplace("tune_2", [&](const int val) { cv_tune_2 = val; });
-    pMapPar.emplace("wavebank", [&](const int val) { wavebank = val; });
-    pMapCv.emplace("wavebank", [&](const int val) { cv_wavebank = val; });
-    pMapPar.emplace("wave_1", [&](const int val) { wave_1 = val; });
-    pMapCv.emplace("wave_1", [&](const int val) { cv_wave_1 = val; });
-    pMapPar.emplace("wave_2", [&](const int val) { wave_2 = val; });
-    pMapCv.emplace("wave_2", [&](const int val) { cv_wave_2 = val; });
-    pMapPar.emplace("fmode", [&](const int val) { fmode = val; });
-    pMapCv.emplace("fmode", [&](const int val) { cv_fmode = val; });
-    pMapPar.emplace("fcut_1", [&](const int val) { fcut_1 = val; });
-    pMapCv.emplace("fcut_1", [&](const int val) { cv_fcut_1 = val; });
-    pMapPar.emplace("fcut_2", [&](const int val) { fcut_2 = val; });
-    pMapCv.emplace("fcut_2", [&](const int val) { cv_fcut_2 = val; });
-    pMapPar.emplace("freso", [&](const int val) { freso = val; });
-    pMapCv.emplace("freso", [&](const int val) { cv_freso = val; });
-    pMapPar.emplace("lfo2wave", [&](const int val) { lfo2wave = val; });
-    pMapCv.emplace("lfo2wave", [&](const int val) { cv_lfo2wave = val; });
-    pMapPar.emplace("lfo2am", [&](const int val) { lfo2am = val; });
-    pMapCv.emplace("lfo2am", [&](const int val) { cv_lfo2am = val; });
-    pMapPar.emplace("lfo2fm", [&](const int val) { lfo2fm = val; });
-    pMapCv.emplace("lfo2fm", [&](const int val) { cv_lfo2fm = val; });
-    pMapPar.emplace("lfo2filtfm", [&](const int val) { lfo2filtfm = val; });
-    pMapCv.emplace("lfo2filtfm", [&](const int val) { cv_lfo2filtfm = val; });
-    pMapPar.emplace("eg2wave", [&](const int val) { eg2wave = val; });
-    pMapCv.emplace("eg2wave", [&](const int val) { cv_eg2wave = val; });
-    pMapPar.emplace("eg2am", [&](const int val) { eg2am = val; });
-    pMapCv.emplace("eg2am", [&](const int val) { cv_eg2am = val; });
-    pMapPar.emplace("eg2fm", [&](const int val) { eg2fm = val; });
-    pMapCv.emplace("eg2fm", [&](const int val) { cv_eg2fm = val; });
-    pMapPar.emplace("eg2filtfm", [&](const int val) { eg2filtfm = val; });
-    pMapCv.emplace("eg2filtfm", [&](const int val) { cv_eg2filtfm = val; });
-    pMapPar.emplace("lfospeed", [&](const int val) { lfospeed = val; });
-    pMapCv.emplace("lfospeed", [&](const int val) { cv_lfospeed = val; });
-    pMapPar.emplace("vintage_vibe", [&](const int val) { vintage_vibe = val; });
-    pMapCv.emplace("vintage_vibe", [&](const int val) { cv_vintage_vibe = val; });
-    pMapPar.emplace("lfosync_1", [&](const int val) { lfosync_1 = val; });
-    pMapTrig.emplace("lfosync_1", [&](const int val) { trig_lfosync_1 = val; });
-    pMapPar.emplace("lfosync_2", [&](const int val) { lfosync_2 = val; });
-    pMapTrig.emplace("lfosync_2", [&](const int val) { trig_lfosync_2 = val; });
-    pMapPar.emplace("egfasl", [&](const int val) { egfasl = val; });
-    pMapTrig.emplace("egfasl", [&](const int val) { trig_egfasl = val; });
-    pMapPar.emplace("attack", [&](const int val) { attack = val; });
-    pMapCv.emplace("attack", [&](const int val) { cv_attack = val; });
-    pMapPar.emplace("decay", [&](const int val) { decay = val; });
-    pMapCv.emplace("decay", [&](const int val) { cv_decay = val; });
-    pMapPar.emplace("sustain", [&](const int val) { sustain = val; });
-    pMapCv.emplace("sustain", [&](const int val) { cv_sustain = val; });
-    pMapPar.emplace("release", [&](const int val) { release = val; });
-    pMapCv.emplace("release", [&](const int val) { cv_release = val; });
+    static constexpr ctagParamDesc params[] {
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, gain_1),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, gain_2),
+        MK_PARAM_BOOL(ctagSoundProcessorWTOscDuo, gate_1),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, pitch_1),
+        MK_PARAM_BOOL(ctagSoundProcessorWTOscDuo, gate_2),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, pitch_2),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, q_scale),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, tune_1),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, tune_2),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, wavebank),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, wave_1),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, wave_2),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, fmode),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, fcut_1),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, fcut_2),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, freso),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, lfo2wave),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, lfo2am),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, lfo2fm),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, lfo2filtfm),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, eg2wave),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, eg2am),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, eg2fm),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, eg2filtfm),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, lfospeed),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, vintage_vibe),
+        MK_PARAM_BOOL(ctagSoundProcessorWTOscDuo, lfosync_1),
+        MK_PARAM_BOOL(ctagSoundProcessorWTOscDuo, lfosync_2),
+        MK_PARAM_BOOL(ctagSoundProcessorWTOscDuo, egfasl),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, attack),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, decay),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, sustain),
+        MK_PARAM_INT(ctagSoundProcessorWTOscDuo, release),
+    };
+    setParamTable(params);
     isStereo = false;
     id = "WTOscDuo";
     // sectionCpp0
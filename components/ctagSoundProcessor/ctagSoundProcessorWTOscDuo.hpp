@@ -37,6 +37,7 @@ namespace CTAG {
         public:
             virtual void Process(const ProcessData &) override;
            virtual void Init(std::size_t blockSize, void *blockPtr) override;
+           static constexpr std::size_t blockMemSize = 260 * 64 * 2 + 512 * 4;
             virtual ~ctagSoundProcessorWTOscDuo();
 
         private:
@@ -58,8 +59,7 @@ namespace CTAG {
             int currentBank = 0;
             int lastBank = -1;
             bool isWaveTableGood = false;
-        	float fwave_1 = 0.f;
-        	float fwave_2 = 0.f;
+            HELPERS::ctagSmoothedParam waveSmoother_1, waveSmoother_2;
             float valADSR_1 = 0.f;
             float valADSR_2 = 0.f; 
             float valLFO_1 = 0.f;
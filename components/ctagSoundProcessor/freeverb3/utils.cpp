@@ -248,8 +248,10 @@ void *FV3_(utils)::fv3_malloc(size_t size){
     if(ptr != nullptr){
         return ptr;
     }
-    ESP_LOGD("fv3", "Falling back to regular malloc prefer internal, then SPIRAM");
-    ptr = heap_caps_malloc_prefer(size, MALLOC_CAP_INTERNAL|MALLOC_CAP_8BIT, MALLOC_CAP_SPIRAM);
+    ESP_LOGD("fv3", "Falling back to regular aligned malloc prefer internal, then SPIRAM");
+    // same alignment as block memory allocations
+    ptr = heap_caps_aligned_alloc(16, size, MALLOC_CAP_INTERNAL|MALLOC_CAP_8BIT);
+    if(ptr == nullptr) ptr = heap_caps_aligned_alloc(16, size, MALLOC_CAP_SPIRAM);
     for(int i = 0; i < MAX_ALLOCS; i++){
         if(allocsSPIRAM[i] == nullptr){
             allocsSPIRAM[i] = ptr;
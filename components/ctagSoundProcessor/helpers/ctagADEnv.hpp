@@ -64,7 +64,6 @@ namespace CTAG {
                 EnvStateType envState = EnvStateType::STATE_IDLE;
                 EnvModeType envMode = EnvModeType::MODE_LOG;
                 float envAccum = 0.f;
-                float envMaxLength = 44100.0f / 32.f / 10.f; // 10s at 44100Hz fs and 32 buf size
                 float attack = 0.5f;
                 float decay = 0.5f;
                 float fSample = 0.f, tSample = 0.f;
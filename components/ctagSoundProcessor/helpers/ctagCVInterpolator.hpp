@@ -0,0 +1,57 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// upsamples control rate cvs (one value per block) to audio rate
+// linear interpolation from value of previous block to value of current block, i.e. one block latency
+// output is channel major, NCV x BS floats, channel ch starts at ch * BS
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace CTAG::SP::HELPERS {
+    template<uint32_t NCV, uint32_t BS>
+    class ctagCVInterpolator final {
+    public:
+        // renders ramps of all channels, returns block buffer
+        float *Process(const float *cv) {
+            constexpr float scale = 1.f / static_cast<float>(BS);
+            for (uint32_t ch = 0; ch < NCV; ch++) {
+                const float a = prev[ch];
+                const float inc = (cv[ch] - a) * scale;
+                float *out = &block[ch * BS];
+                for (uint32_t i = 0; i < BS; i++) out[i] = a + inc * static_cast<float>(i + 1);
+                prev[ch] = cv[ch];
+            }
+            return block;
+        }
+
+        // no output needed this block, only track values so next ramp starts at right value
+        void Track(const float *cv) {
+            memcpy(prev, cv, sizeof(prev));
+        }
+
+    private:
+        float prev[NCV] {};
+        float block[NCV * BS] {};
+    };
+}
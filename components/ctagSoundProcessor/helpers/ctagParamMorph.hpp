@@ -0,0 +1,105 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// interpolates parameter values between two presets
+// api thread fills flat vectors once (Clear, Add, Start), only parameters which differ are stored
+// audio thread calls Process once per block, which is a single lerp over the flat vectors
+// bool parameters are rounded like ints, i.e. they switch at the middle of the morph
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+
+namespace CTAG::SP::HELPERS {
+    class ctagParamMorph final {
+    public:
+        // api thread, keeps capacity of vectors
+        void Clear() {
+            active = false;
+            index.clear();
+            a.clear();
+            d.clear();
+            out.clear();
+        }
+
+        // api thread, param index of table with start and end value
+        void Add(const uint16_t idx, const int32_t from, const int32_t to) {
+            if (from == to) return;
+            index.push_back(idx);
+            a.push_back(static_cast<float>(from));
+            d.push_back(static_cast<float>(to - from));
+            out.push_back(static_cast<float>(from));
+        }
+
+        // api thread, cv >= 0 controls morph position by abs value of that cv channel (time is ignored),
+        // otherwise morphs from start to end in timeMs, timeMs <= 0 jumps to end
+        void Start(const int timeMs, const int cv, const uint32_t blockSz, const float fs = 44100.f) {
+            cvChannel = cv;
+            pos = 0.f;
+            lastPos = -1.f;
+            inc = timeMs > 0 ? static_cast<float>(blockSz) / (static_cast<float>(timeMs) * 0.001f * fs) : 1.f;
+            active = !index.empty();
+        }
+
+        // audio thread, returns true if values have changed and must be applied
+        bool Process(const float *cv) {
+            if (!active) return false;
+            float t;
+            if (cvChannel >= 0) {
+                t = fabsf(cv[cvChannel]);
+                if (t > 1.f) t = 1.f;
+            } else {
+                pos += inc;
+                if (pos >= 1.f) {
+                    pos = 1.f;
+                    active = false; // end reached, apply last time
+                }
+                t = pos;
+            }
+            if (t == lastPos) return false;
+            lastPos = t;
+            const uint32_t n = out.size();
+            const float *pa = a.data(), *pd = d.data();
+            float *po = out.data();
+            for (uint32_t i = 0; i < n; i++) po[i] = pa[i] + t * pd[i];
+            return true;
+        }
+
+        void Stop() { active = false; }
+
+        bool IsActive() const { return active; }
+
+        uint32_t GetSize() const { return index.size(); }
+
+        uint16_t GetIndex(const uint32_t i) const { return index[i]; }
+
+        int32_t GetValue(const uint32_t i) const { return static_cast<int32_t>(lrintf(out[i])); }
+
+    private:
+        std::vector<uint16_t> index;
+        std::vector<float> a, d, out; // start, delta, interpolated
+        float pos {0.f}, inc {0.f}, lastPos {-1.f};
+        int cvChannel {-1};
+        bool active {false};
+    };
+}
@@ -0,0 +1,64 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// single producer / single consumer lock free ring buffer
+// producer calls Push, consumer calls Pop, neither blocks
+// N must be a power of two, one slot is never used to distinguish full from empty
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace CTAG::SP::HELPERS {
+    template<typename T, uint32_t N>
+    class ctagSPSCQueue final {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "ctagSPSCQueue size must be a power of two");
+    public:
+        // returns false if queue is full, element is not enqueued then
+        bool Push(const T &v) {
+            const uint32_t w = writeIdx.load(std::memory_order_relaxed);
+            const uint32_t next = (w + 1) & (N - 1);
+            if (next == readIdx.load(std::memory_order_acquire)) return false;
+            data[w] = v;
+            writeIdx.store(next, std::memory_order_release);
+            return true;
+        }
+
+        // returns false if queue is empty
+        bool Pop(T &v) {
+            const uint32_t r = readIdx.load(std::memory_order_relaxed);
+            if (r == writeIdx.load(std::memory_order_acquire)) return false;
+            v = data[r];
+            readIdx.store((r + 1) & (N - 1), std::memory_order_release);
+            return true;
+        }
+
+        bool IsEmpty() const {
+            return readIdx.load(std::memory_order_acquire) == writeIdx.load(std::memory_order_acquire);
+        }
+
+    private:
+        T data[N];
+        std::atomic<uint32_t> writeIdx {0};
+        std::atomic<uint32_t> readIdx {0};
+    };
+}
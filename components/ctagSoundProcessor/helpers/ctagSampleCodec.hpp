@@ -0,0 +1,140 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// IMA-ADPCM coding of sample rom slices, 4 bit per sample
+// an encoded slice is a sequence of blocks, each block starts with its first sample (int16) and the quantizer step
+// index (uint8, one reserved byte) followed by the nibbles of the remaining samples, low nibble first
+// a sample is decoded from the start of its block, decoding resumes from a State when reading on in the same block
+// encoder is used by sample rom builders, decoder by ctagSampleRom
+
+#pragma once
+
+#include <cstdint>
+
+#define SAMPLE_ROM_MAGIC 0xdeadface // int16 slices
+#define SAMPLE_ROM_MAGIC_ADPCM 0xdeadfadc // int16 or IMA-ADPCM slices, see sample_rom/readme.md
+#define SAMPLE_ROM_SLICE_ADPCM 0x80000000 // flag of slice data end offset
+#define SAMPLE_ADPCM_BLOCK_BYTES 256
+#define SAMPLE_ADPCM_BLOCK_SAMPLES 505 // first sample and 2 x 252 nibbles
+
+namespace CTAG::SP::HELPERS {
+    class ctagSampleCodec final {
+    public:
+        struct State {
+            uint32_t pos; // sample of block which is pred
+            int32_t pred;
+            int32_t index;
+        };
+
+        // int16 words of encoded slice
+        static constexpr uint32_t EncodedSize(const uint32_t nSamples) {
+            return (nSamples + SAMPLE_ADPCM_BLOCK_SAMPLES - 1) / SAMPLE_ADPCM_BLOCK_SAMPLES * (SAMPLE_ADPCM_BLOCK_BYTES / 2);
+        }
+
+        // dst holds EncodedSize(nSamples) words, last block is padded with silence
+        static void Encode(uint8_t *dst, const int16_t *src, const uint32_t nSamples) {
+            int32_t index = 0;
+            for (uint32_t start = 0; start < nSamples; start += SAMPLE_ADPCM_BLOCK_SAMPLES) {
+                uint8_t *block = &dst[start / SAMPLE_ADPCM_BLOCK_SAMPLES * SAMPLE_ADPCM_BLOCK_BYTES];
+                State s {0, src[start], index};
+                block[0] = s.pred & 0xFF;
+                block[1] = (s.pred >> 8) & 0xFF;
+                block[2] = s.index;
+                block[3] = 0;
+                for (uint32_t k = 1; k < SAMPLE_ADPCM_BLOCK_SAMPLES; k++) {
+                    const int32_t x = start + k < nSamples ? src[start + k] : 0;
+                    // quantize difference to prediction with same reconstruction as decoder
+                    const int32_t step = stepTable[s.index];
+                    int32_t d = x - s.pred;
+                    uint8_t nibble = 0;
+                    if (d < 0) {
+                        nibble = 8;
+                        d = -d;
+                    }
+                    if (d >= step) {
+                        nibble |= 4;
+                        d -= step;
+                    }
+                    if (d >= step >> 1) {
+                        nibble |= 2;
+                        d -= step >> 1;
+                    }
+                    if (d >= step >> 2) nibble |= 1;
+                    advance(s, nibble);
+                    uint8_t &b = block[4 + (k - 1) / 2];
+                    b = (k - 1) & 1 ? b | nibble << 4 : nibble;
+                }
+                index = s.index;
+            }
+        }
+
+        // starts decoding a block, header is first 4 bytes of block
+        static void Begin(State &s, const uint8_t *header) {
+            s.pos = 0;
+            s.pred = static_cast<int16_t>(header[0] | header[1] << 8);
+            s.index = header[2] > 88 ? 88 : header[2];
+        }
+
+        // decodes samples from ... from + n - 1 of block to int16 or float, from >= s.pos, n > 0
+        // only nibbles after s.pos up to last sample are accessed
+        template<typename T>
+        static void Decode(T *dst, const uint8_t *block, State &s, const uint32_t from, const uint32_t n) {
+            if (from == s.pos) *dst++ = convert<T>(s.pred);
+            const uint8_t *nibbles = &block[4];
+            for (uint32_t k = s.pos + 1; k < from + n; k++) {
+                const uint8_t b = nibbles[(k - 1) >> 1];
+                advance(s, (k - 1) & 1 ? b >> 4 : b & 0xF);
+                if (k >= from) *dst++ = convert<T>(s.pred);
+            }
+            s.pos = from + n - 1;
+        }
+
+    private:
+        static void advance(State &s, const uint8_t nibble) {
+            const int32_t step = stepTable[s.index];
+            int32_t diff = step >> 3;
+            if (nibble & 4) diff += step;
+            if (nibble & 2) diff += step >> 1;
+            if (nibble & 1) diff += step >> 2;
+            int32_t pred = nibble & 8 ? s.pred - diff : s.pred + diff;
+            s.pred = pred > 32767 ? 32767 : pred < -32768 ? -32768 : pred;
+            const int32_t index = s.index + indexTable[nibble];
+            s.index = index < 0 ? 0 : index > 88 ? 88 : index;
+        }
+
+        template<typename T>
+        static T convert(const int32_t x);
+
+        static constexpr int8_t indexTable[16] {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+        static constexpr int16_t stepTable[89] {
+                7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88,
+                97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+                724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660,
+                4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818,
+                18500, 20350, 22385, 24623, 27086, 29794, 32767};
+    };
+
+    template<>
+    inline int16_t ctagSampleCodec::convert<int16_t>(const int32_t x) { return x; }
+
+    template<>
+    inline float ctagSampleCodec::convert<float>(const int32_t x) { return float(x) * 0.000030518509476f; }
+}
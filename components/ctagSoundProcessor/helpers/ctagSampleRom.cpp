@@ -25,13 +25,24 @@ respective component folders / files if different from this license.
 #include "esp_log.h"
 #include "esp_heap_caps.h"
 #include <cstring>
+#include <new>
 
 #ifdef TBD_SIM
 #define CONFIG_SAMPLE_ROM_START_ADDRESS 0
+#define SAMPLE_ROM_MMAP
 #else
 #include "sdkconfig.h"
+#ifdef CONFIG_SAMPLE_ROM_MMAP
+#define SAMPLE_ROM_MMAP
+#endif
+#endif
+
+#ifdef SAMPLE_ROM_MMAP
+#include "spi_flash_mmap.h"
 #endif
 
+#define CACHE_FILL_STEP 2048 // int16 samples read from flash per ServiceCache call
+
 namespace CTAG::SP::HELPERS {
     atomic<uint32_t> ctagSampleRom::nConsumers = 0;
     uint32_t ctagSampleRom::totalSize = 0;
@@ -39,9 +50,21 @@ namespace CTAG::SP::HELPERS {
     uint32_t ctagSampleRom::headerSize = 0;
     uint32_t *ctagSampleRom::sliceSizes = nullptr;
     uint32_t *ctagSampleRom::sliceOffsets = nullptr;
+    uint32_t *ctagSampleRom::sliceData = nullptr;
+    uint32_t ctagSampleRom::generation = 0;
     uint32_t ctagSampleRom::firstNonWtSlice = 0;
-    int16_t *ctagSampleRom::ptrSPIRAM = nullptr;
-    uint32_t ctagSampleRom::nSlicesBuffered = 0;
+    const int16_t *ctagSampleRom::mapped = nullptr;
+    uint32_t ctagSampleRom::mapHandle = 0;
+    ctagSampleRom::SliceCache *ctagSampleRom::sliceCache = nullptr;
+    atomic<uint32_t> ctagSampleRom::cacheReaders = 0;
+    atomic<uint32_t> ctagSampleRom::cacheClock = 0;
+    uint32_t ctagSampleRom::cacheBudget = 0;
+    uint32_t ctagSampleRom::cacheUsed = 0;
+    int16_t *ctagSampleRom::fillBuffer = nullptr;
+    uint32_t ctagSampleRom::fillSlice = 0;
+    uint32_t ctagSampleRom::fillPos = 0;
+    ctagSampleRom::Cursor ctagSampleRom::fillCursor;
+    mutex ctagSampleRom::cacheMutex;
 
     ctagSampleRom::ctagSampleRom() {
         //ESP_LOGE("SR", "nConsumers %li", nConsumers.load());
@@ -76,6 +99,10 @@ namespace CTAG::SP::HELPERS {
     // reads words, offset in words not bytes
     void ctagSampleRom::Read(int16_t *dst, uint32_t offset, const uint32_t n_samples) {
         assert(dst != nullptr);
+        if (mapped != nullptr) {
+            memcpy(dst, &mapped[offset], n_samples * 2);
+            return;
+        }
         offset *= 2; // from int16 to bytes
         offset += headerSize; // add header size
         offset += CONFIG_SAMPLE_ROM_START_ADDRESS; // add start offset
@@ -94,39 +121,243 @@ namespace CTAG::SP::HELPERS {
     }
 
     void ctagSampleRom::ReadSlice(int16_t *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples) {
-        uint32_t start = sliceOffsets[slice] + offset;
         int32_t len = n_samples;
         if (offset + len >= sliceSizes[slice]) { // read beyond slice end ?
             len = sliceSizes[slice] - offset;
         }
         if (len <= 0) return; // nothing to read!
-        if(slice >= nSlicesBuffered) // nSlicesBuffered > 0 if SPIRAM Buffer is used
-            Read(dst, start, len);
+        if (ReadCached(dst, slice, offset, len)) return;
+        if (sliceCache != nullptr && cacheBudget > 0) { // cache on first use
+            sliceCache[slice].lastUse.store(cacheClock.load(memory_order_relaxed), memory_order_relaxed);
+            sliceCache[slice].requested.store(true, memory_order_relaxed);
+        }
+        if (sliceData[slice] & SAMPLE_ROM_SLICE_ADPCM)
+            decodeSlice(dst, slice, offset, len, cursor);
         else
-            memcpy(dst, &ptrSPIRAM[start], n_samples*2);
+            Read(dst, sliceData[slice] + offset, len);
     }
 
     void ctagSampleRom::ReadSliceAsFloat(float *dst, const uint32_t slice, const uint32_t offset,
                                          const uint32_t n_samples) {
-        uint32_t start = sliceOffsets[slice] + offset;
         int32_t len = n_samples;
         if (offset + len >= sliceSizes[slice]) { // read beyond slice end ?
             len = sliceSizes[slice] - offset;
         }
         if (len <= 0) return; // nothing to read!
+        if ((sliceData[slice] & SAMPLE_ROM_SLICE_ADPCM) && !IsSliceCached(slice)) { // decode to float
+            decodeSlice(dst, slice, offset, len, cursor);
+            return;
+        }
+        if (mapped != nullptr && !(sliceData[slice] & SAMPLE_ROM_SLICE_ADPCM)) { // convert in place
+            const int16_t *src = &mapped[sliceData[slice] + offset];
+            while (len--) {
+                *dst++ = float(*src++) * 0.000030518509476f;
+            }
+            return;
+        }
         int16_t idst[len];
         int16_t *dptr = idst;
-        if(slice >= nSlicesBuffered)
-            Read(idst, start, len);
-        else
-            memcpy(idst, &ptrSPIRAM[start], n_samples*2);
+        ReadSlice(idst, slice, offset, len);
         while (len--) {
             *dst++ = float(*dptr++) * 0.000030518509476f;
         }
     }
 
+    const int16_t *ctagSampleRom::GetSliceData(const uint32_t slice) {
+        if (mapped == nullptr || slice >= numberSlices) return nullptr;
+        if (sliceData[slice] & SAMPLE_ROM_SLICE_ADPCM) return nullptr;
+        return &mapped[sliceData[slice]];
+    }
+
+    template<typename T>
+    void ctagSampleRom::decodeSlice(T *dst, const uint32_t slice, const uint32_t offset, const uint32_t len, Cursor &c) {
+        const uint32_t data = sliceData[slice] & ~SAMPLE_ROM_SLICE_ADPCM;
+        uint8_t buffer[SAMPLE_ADPCM_BLOCK_BYTES] __attribute__((aligned(4)));
+        uint32_t pos = offset;
+        const uint32_t end = offset + len;
+        while (pos < end) {
+            const uint32_t block = pos / SAMPLE_ADPCM_BLOCK_SAMPLES;
+            const uint32_t from = pos % SAMPLE_ADPCM_BLOCK_SAMPLES;
+            const uint32_t n = end - pos < SAMPLE_ADPCM_BLOCK_SAMPLES - from ? end - pos : SAMPLE_ADPCM_BLOCK_SAMPLES - from;
+            const uint32_t word = data + block * (SAMPLE_ADPCM_BLOCK_BYTES / 2);
+            const uint8_t *src = mapped != nullptr ? (const uint8_t *) &mapped[word] : buffer;
+            if (c.generation != generation || c.slice != slice || c.block != block || c.state.pos > from) {
+                if (mapped == nullptr) Read((int16_t *) buffer, word, 2); // block header
+                ctagSampleCodec::Begin(c.state, src);
+                c.generation = generation;
+                c.slice = slice;
+                c.block = block;
+            }
+            if (mapped == nullptr && from + n - 1 > c.state.pos) {
+                // only words holding nibbles after decoder position, sample k is nibble k - 1
+                const uint32_t first = c.state.pos / 4, last = (from + n - 2) / 4;
+                Read((int16_t *) &buffer[4 + first * 2], word + 2 + first, last - first + 1);
+            }
+            ctagSampleCodec::Decode(dst, src, c.state, from, n);
+            dst += n;
+            pos += n;
+        }
+    }
+
+    bool ctagSampleRom::IsMapped() {
+        return mapped != nullptr;
+    }
+
+    void ctagSampleRom::map() {
+#ifdef SAMPLE_ROM_MMAP
+        // sample data is read in place through flash cache
+        const void *ptr = nullptr;
+        spi_flash_mmap_handle_t handle;
+        const uint32_t size = headerSize + totalSize * 2; // total size is in int16 words
+        if (spi_flash_mmap(CONFIG_SAMPLE_ROM_START_ADDRESS, size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+            ESP_LOGW("SROM", "Could not map %li bytes of sample rom, reading from flash", size);
+            return;
+        }
+        mapHandle = handle;
+        mapped = (const int16_t *) ((const uint8_t *) ptr + headerSize);
+#endif
+    }
+
+    void ctagSampleRom::unmap() {
+#ifdef SAMPLE_ROM_MMAP
+        if (mapped == nullptr) return;
+        spi_flash_munmap(mapHandle);
+        mapped = nullptr;
+#endif
+    }
+
+    bool ctagSampleRom::IsSliceCached(const uint32_t slice) {
+        if (sliceCache == nullptr || slice >= numberSlices) return false;
+        return sliceCache[slice].data.load(memory_order_relaxed) != nullptr;
+    }
+
+    bool ctagSampleRom::ReadCached(int16_t *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples) {
+        if (sliceCache == nullptr || slice >= numberSlices) return false;
+        if (offset >= sliceSizes[slice]) return true; // nothing to read
+        const uint32_t len = offset + n_samples > sliceSizes[slice] ? sliceSizes[slice] - offset : n_samples;
+        SliceCache &c = sliceCache[slice];
+        // eviction waits for readers before freeing data
+        cacheReaders.fetch_add(1);
+        int16_t *data = c.data.load();
+        if (data != nullptr) memcpy(dst, &data[offset], len * 2);
+        cacheReaders.fetch_sub(1);
+        if (data == nullptr) return false;
+        c.lastUse.store(cacheClock.load(memory_order_relaxed), memory_order_relaxed);
+        return true;
+    }
+
+    void ctagSampleRom::Reference(const uint32_t slice) {
+        if (sliceCache == nullptr || slice >= numberSlices) return;
+        sliceCache[slice].refs.fetch_add(1, memory_order_relaxed);
+    }
+
+    void ctagSampleRom::Unreference(const uint32_t slice) {
+        if (sliceCache == nullptr || slice >= numberSlices) return;
+        // references are dropped when rom is refreshed
+        uint16_t refs = sliceCache[slice].refs.load(memory_order_relaxed);
+        while (refs > 0 && !sliceCache[slice].refs.compare_exchange_weak(refs, refs - 1, memory_order_relaxed));
+    }
+
+    bool ctagSampleRom::evictOne(const uint32_t before) {
+        uint32_t victim = numberSlices;
+        for (uint32_t i = 0; i < numberSlices; i++) {
+            SliceCache &c = sliceCache[i];
+            if (c.data.load(memory_order_relaxed) == nullptr || c.refs.load(memory_order_relaxed) > 0) continue;
+            const uint32_t t = c.lastUse.load(memory_order_relaxed);
+            if (t >= before) continue;
+            if (victim == numberSlices || t < sliceCache[victim].lastUse.load(memory_order_relaxed)) victim = i;
+        }
+        if (victim == numberSlices) return false;
+        int16_t *data = sliceCache[victim].data.exchange(nullptr);
+        while (cacheReaders.load() > 0); // copy of at most one block
+        heap_caps_free(data);
+        cacheUsed -= sliceSizes[victim] * 2;
+        ESP_LOGD("SR", "Evicted slice %li, cache %li of %li bytes", victim, cacheUsed, cacheBudget);
+        return true;
+    }
+
+    void ctagSampleRom::dropCache() {
+        if (fillBuffer != nullptr) {
+            heap_caps_free(fillBuffer);
+            fillBuffer = nullptr;
+        }
+        if (sliceCache != nullptr) {
+            for (uint32_t i = 0; i < numberSlices; i++) {
+                int16_t *data = sliceCache[i].data.exchange(nullptr);
+                if (data != nullptr) heap_caps_free(data);
+                sliceCache[i].~SliceCache();
+            }
+            heap_caps_free(sliceCache);
+            sliceCache = nullptr;
+        }
+        cacheUsed = 0;
+    }
+
+    bool ctagSampleRom::ServiceCache() {
+        lock_guard<mutex> lock(cacheMutex);
+        if (sliceCache == nullptr || cacheBudget == 0) return false;
+        const uint32_t now = cacheClock.fetch_add(1, memory_order_relaxed) + 1;
+        if (fillBuffer == nullptr) {
+            // slices played by voices first, then most recently read ones
+            uint32_t next = numberSlices;
+            bool nextRef = false;
+            for (uint32_t i = 0; i < numberSlices; i++) {
+                SliceCache &c = sliceCache[i];
+                if (c.noCache || c.data.load(memory_order_relaxed) != nullptr) continue;
+                const bool ref = c.refs.load(memory_order_relaxed) > 0;
+                if (!ref && !c.requested.load(memory_order_relaxed)) continue;
+                if (next == numberSlices || (ref && !nextRef) || (ref == nextRef &&
+                    c.lastUse.load(memory_order_relaxed) > sliceCache[next].lastUse.load(memory_order_relaxed))) {
+                    next = i;
+                    nextRef = ref;
+                }
+            }
+            if (next == numberSlices) return false;
+            SliceCache &c = sliceCache[next];
+            c.requested = false;
+            const uint32_t bytes = sliceSizes[next] * 2;
+            // referenced slices may evict any unreferenced one, others only less recently used ones
+            const uint32_t before = nextRef ? UINT32_MAX : c.lastUse.load(memory_order_relaxed);
+            if (bytes == 0 || bytes > cacheBudget / 2) {
+                c.noCache = true;
+                return true;
+            }
+            while (cacheUsed + bytes > cacheBudget && evictOne(before));
+            if (cacheUsed + bytes <= cacheBudget) {
+                fillBuffer = (int16_t *) heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+                while (fillBuffer == nullptr && evictOne(before))
+                    fillBuffer = (int16_t *) heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+            }
+            if (fillBuffer == nullptr) {
+                // referenced slices which do not fit are streamed, others are retried when read again
+                if (nextRef) c.noCache = true;
+                return false;
+            }
+            fillSlice = next;
+            fillPos = 0;
+            cacheUsed += bytes;
+        }
+        // read in steps, a slice may be large
+        const uint32_t size = sliceSizes[fillSlice];
+        const uint32_t n = size - fillPos < CACHE_FILL_STEP ? size - fillPos : CACHE_FILL_STEP;
+        if (sliceData[fillSlice] & SAMPLE_ROM_SLICE_ADPCM)
+            decodeSlice(&fillBuffer[fillPos], fillSlice, fillPos, n, fillCursor);
+        else
+            Read(&fillBuffer[fillPos], sliceData[fillSlice] + fillPos, n);
+        fillPos += n;
+        if (fillPos < size) return true;
+        sliceCache[fillSlice].lastUse.store(now, memory_order_relaxed);
+        sliceCache[fillSlice].data.store(fillBuffer);
+        fillBuffer = nullptr;
+        ESP_LOGD("SR", "Cached slice %li, cache %li of %li bytes", fillSlice, cacheUsed, cacheBudget);
+        return true;
+    }
+
     void ctagSampleRom::RefreshDataStructure() {
         if(nConsumers == 0) return;
+        lock_guard<mutex> lock(cacheMutex);
+        dropCache();
+        unmap();
         if (sliceOffsets != nullptr) {
             heap_caps_free(sliceOffsets);
             sliceOffsets = nullptr;
@@ -135,13 +366,18 @@ namespace CTAG::SP::HELPERS {
             heap_caps_free(sliceSizes);
             sliceSizes = nullptr;
         }
+        if (sliceData != nullptr) {
+            heap_caps_free(sliceData);
+            sliceData = nullptr;
+        }
+        generation++; // decoder cursors are invalid
         uint32_t deadface = 0;
         totalSize = 0;
         numberSlices = 0;
         headerSize = 0;
         //spi_flash_read(CONFIG_SAMPLE_ROM_START_ADDRESS, &deadface, 4);
         esp_flash_read(nullptr, &deadface, CONFIG_SAMPLE_ROM_START_ADDRESS, 4);
-        if (deadface != 0xdeadface) {
+        if (deadface != SAMPLE_ROM_MAGIC && deadface != SAMPLE_ROM_MAGIC_ADPCM) {
             ESP_LOGE("SROM", "Magic number wrong!");
             return;
         }
@@ -149,7 +385,7 @@ namespace CTAG::SP::HELPERS {
         //spi_flash_read(CONFIG_SAMPLE_ROM_START_ADDRESS + 4, &totalSize, 4);
         esp_flash_read(nullptr,&totalSize, CONFIG_SAMPLE_ROM_START_ADDRESS + 4, 4);
         headerSize += 4;
-        ESP_LOGD("SROM", "Total sample data size %li bytes", totalSize);
+        ESP_LOGD("SROM", "Total sample data size %li words", totalSize);
         //spi_flash_read(CONFIG_SAMPLE_ROM_START_ADDRESS + 8, &numberSlices, 4);
         esp_flash_read(nullptr, &numberSlices, CONFIG_SAMPLE_ROM_START_ADDRESS + 8, 4);
         headerSize += 4;
@@ -159,6 +395,8 @@ namespace CTAG::SP::HELPERS {
         assert(sliceOffsets != nullptr);
         sliceSizes = (uint32_t *) heap_caps_malloc(numberSlices * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
         assert(sliceSizes != nullptr);
+        sliceData = (uint32_t *) heap_caps_malloc(numberSlices * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+        assert(sliceData != nullptr);
         //spi_flash_read(CONFIG_SAMPLE_ROM_START_ADDRESS + 12, &sliceOffsets[0], 4 * numberSlices);
         esp_flash_read(nullptr, &sliceOffsets[0], CONFIG_SAMPLE_ROM_START_ADDRESS + 12, 4 * numberSlices);
         headerSize += 4 * numberSlices;
@@ -169,6 +407,19 @@ namespace CTAG::SP::HELPERS {
             sliceOffsets[i] -= sliceSizes[i];
             ESP_LOGD("SROM", "Slice size %li, offset %li", sliceSizes[i], sliceOffsets[i]);
         }
+        if (deadface == SAMPLE_ROM_MAGIC_ADPCM) {
+            // end offsets of slice data, with encoding flag
+            esp_flash_read(nullptr, &sliceData[0], CONFIG_SAMPLE_ROM_START_ADDRESS + headerSize, 4 * numberSlices);
+            headerSize += 4 * numberSlices;
+            uint32_t lastEnd = 0;
+            for (uint32_t i = 0; i < numberSlices; i++) {
+                const uint32_t end = sliceData[i] & ~SAMPLE_ROM_SLICE_ADPCM;
+                sliceData[i] = lastEnd | (sliceData[i] & SAMPLE_ROM_SLICE_ADPCM);
+                lastEnd = end;
+            }
+        } else {
+            for (uint32_t i = 0; i < numberSlices; i++) sliceData[i] = sliceOffsets[i];
+        }
         // get first non Wt Slice
         for (int i = 0; i < numberSlices; i++) {
             if (sliceSizes[i] > 256){
@@ -176,6 +427,17 @@ namespace CTAG::SP::HELPERS {
                 break;
             }
         }
+        map();
+        sliceCache = (SliceCache *) heap_caps_malloc(numberSlices * sizeof(SliceCache), MALLOC_CAP_SPIRAM);
+        assert(sliceCache != nullptr);
+        for (uint32_t i = 0; i < numberSlices; i++) {
+            SliceCache *c = new(&sliceCache[i]) SliceCache;
+            c->data = nullptr;
+            c->lastUse = 0;
+            c->refs = 0;
+            c->requested = false;
+            c->noCache = false;
+        }
     }
 
     ctagSampleRom::~ctagSampleRom() {
@@ -184,24 +446,26 @@ namespace CTAG::SP::HELPERS {
 
         if (nConsumers > 0) return;
         //ESP_LOGE("SR", "freeing up SR data structure");
+        lock_guard<mutex> lock(cacheMutex);
+        dropCache();
+        unmap();
+        cacheBudget = 0;
         if (sliceOffsets != nullptr) {
             heap_caps_free(sliceOffsets);
         }
         if (sliceSizes != nullptr) {
             heap_caps_free(sliceSizes);
         }
+        if (sliceData != nullptr) {
+            heap_caps_free(sliceData);
+        }
         totalSize = 0;
         numberSlices = 0;
         headerSize = 0;
         sliceSizes = nullptr;
         sliceOffsets = nullptr;
+        sliceData = nullptr;
         firstNonWtSlice = 0;
-
-        if(ptrSPIRAM != nullptr){
-            heap_caps_free(ptrSPIRAM);
-            ptrSPIRAM = nullptr;
-            nSlicesBuffered = 0;
-        }
     }
 
     uint32_t ctagSampleRom::GetFirstNonWaveTableSlice() {
@@ -209,28 +473,17 @@ namespace CTAG::SP::HELPERS {
     }
 
     bool ctagSampleRom::IsBufferedInSPIRAM() {
-        if(ptrSPIRAM == nullptr) return false;
-        return true;
+        return cacheBudget > 0;
     }
 
     void ctagSampleRom::BufferInSPIRAM() {
-        if(ptrSPIRAM != nullptr) return; // already buffered
+        lock_guard<mutex> lock(cacheMutex);
+        if (cacheBudget > 0) return; // already enabled
+        if (mapped != nullptr) return; // read through flash cache
         size_t maxSizeBytes = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+        if (maxSizeBytes < (1024 + 128) * 1024) return; // not enough memory for this to make sense
         maxSizeBytes -= 128*1024; // reserve 128k for other stuff
-        if(maxSizeBytes < 1024*1024) return; // not enough memory for this to make sense
-        ptrSPIRAM = (int16_t *)heap_caps_malloc(maxSizeBytes, MALLOC_CAP_SPIRAM);
-        if(ptrSPIRAM == nullptr) return;
-        ESP_LOGI("SR", "Buffering %d bytes in SPIRAM", maxSizeBytes);
-        // figure out how many slices can be buffered
-        uint32_t maxSizeWords = maxSizeBytes / 2;
-        nSlicesBuffered = 0;
-        uint32_t totalSizeWords = 0;
-        for(uint32_t i=0;i<numberSlices;i++){
-            if(totalSizeWords + sliceSizes[i] > maxSizeWords) break;
-            totalSizeWords += sliceSizes[i];
-            nSlicesBuffered++;
-        }
-        ESP_LOGI("SR", "Buffering %li slices of %li, consuming %li bytes", nSlicesBuffered, numberSlices, totalSizeWords*2);
-        Read(ptrSPIRAM, 0, totalSizeWords);
+        cacheBudget = maxSizeBytes;
+        ESP_LOGI("SR", "Caching up to %d bytes of %li slices in SPIRAM", maxSizeBytes, numberSlices);
     }
 }
@@ -23,6 +23,8 @@ respective component folders / files if different from this license.
 #include <cstdint>
 #include <vector>
 #include <atomic>
+#include <mutex>
+#include "ctagSampleCodec.hpp"
 
 using namespace std;
 
@@ -40,20 +42,68 @@ namespace CTAG::SP::HELPERS{
         uint32_t GetSliceOffset(const uint32_t slice);
         bool HasSlice(const uint32_t slice);
         bool HasSliceGroup(const uint32_t startSlice, const uint32_t endSlice);
-        void Read(int16_t *dst, uint32_t offset, const uint32_t n_samples);
+        // raw sample data, offset in int16 words, wave table slices are never encoded
+        static void Read(int16_t *dst, uint32_t offset, const uint32_t n_samples);
+        // slices are decoded if IMA-ADPCM encoded
         void ReadSlice(int16_t *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
         void ReadSliceAsFloat(float *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
+        // sample data in place if sample rom is memory mapped and slice is not encoded, else nullptr
+        const int16_t *GetSliceData(const uint32_t slice);
+        bool IsMapped();
+        // enables slice cache in SPIRAM, slices are cached on first use and evicted least recently used first,
+        // slices referenced by voices are cached first and not evicted
         void BufferInSPIRAM();
         bool IsBufferedInSPIRAM();
+        bool IsSliceCached(const uint32_t slice);
+        // copies from cache, false if slice is not cached, audio thread
+        bool ReadCached(int16_t *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
+        // slice is played by a voice, audio thread
+        void Reference(const uint32_t slice);
+        void Unreference(const uint32_t slice);
+        // loads next part of a slice into cache, returns true if more work is pending, prefetch task
+        static bool ServiceCache();
     private:
+        struct SliceCache {
+            atomic<int16_t *> data; // whole slice, nullptr if not cached
+            atomic<uint32_t> lastUse; // cache clock
+            atomic<uint16_t> refs;
+            atomic<bool> requested; // read while not cached
+            bool noCache; // does not fit into cache
+        };
+        // decoder state of last read, reading on in same block resumes decoding
+        struct Cursor {
+            uint32_t generation {0};
+            uint32_t slice {UINT32_MAX};
+            uint32_t block {0};
+            ctagSampleCodec::State state;
+        };
+        // reads IMA-ADPCM encoded slice
+        template<typename T>
+        static void decodeSlice(T *dst, const uint32_t slice, const uint32_t offset, const uint32_t len, Cursor &c);
+        static void dropCache();
+        static void map();
+        static void unmap();
+        // evicts least recently used unreferenced slice last used before clock, false if there is none
+        static bool evictOne(const uint32_t before);
         static uint32_t totalSize;
         static uint32_t numberSlices;
         static uint32_t headerSize;
         static uint32_t *sliceSizes;
         static uint32_t *sliceOffsets;
+        static uint32_t *sliceData; // start of slice data in int16 words, SAMPLE_ROM_SLICE_ADPCM if encoded
+        static uint32_t generation; // of data structure
         static uint32_t firstNonWtSlice;
         static atomic<uint32_t>  nConsumers;
-        static int16_t *ptrSPIRAM;
-        static uint32_t nSlicesBuffered;
+        static const int16_t *mapped; // sample data, after header
+        static uint32_t mapHandle;
+        static SliceCache *sliceCache;
+        static atomic<uint32_t> cacheReaders; // audio threads copying from cache
+        static atomic<uint32_t> cacheClock;
+        static uint32_t cacheBudget, cacheUsed; // bytes
+        static int16_t *fillBuffer; // slice being cached
+        static uint32_t fillSlice, fillPos;
+        static Cursor fillCursor;
+        static mutex cacheMutex;
+        Cursor cursor;
     };
 }
@@ -0,0 +1,237 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "ctagSampleStream.hpp"
+#include "esp_heap_caps.h"
+#include <cstring>
+#include <algorithm>
+
+namespace CTAG::SP::HELPERS {
+    std::mutex ctagSampleStream::streamsMutex;
+    std::vector<ctagSampleStream *> ctagSampleStream::streams;
+    std::atomic<void (*)()> ctagSampleStream::wakeup {nullptr};
+    std::atomic<bool> ctagSampleStream::paused {false};
+
+    ctagSampleStream::ctagSampleStream() {
+        for (auto &k : chunkKey) k = NO_KEY;
+        for (auto &s : chunkSeq) s = 0;
+        for (auto &w : wanted) w = NO_KEY;
+        mem = (int16_t *) heap_caps_malloc(STREAM_N_CHUNKS * STREAM_CHUNK_SZ * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+        if (mem == nullptr) return; // reads directly
+        std::lock_guard<std::mutex> lock(streamsMutex);
+        streams.push_back(this);
+    }
+
+    ctagSampleStream::~ctagSampleStream() {
+        sampleRom.Unreference(refSlice);
+        if (mem == nullptr) return;
+        {
+            // waits until prefetch task has finished with this stream
+            std::lock_guard<std::mutex> lock(streamsMutex);
+            streams.erase(std::remove(streams.begin(), streams.end(), this), streams.end());
+        }
+        heap_caps_free(mem);
+    }
+
+    bool ctagSampleStream::isDirect() {
+        return mem == nullptr || wakeup.load(std::memory_order_relaxed) == nullptr || sampleRom.IsMapped();
+    }
+
+    void ctagSampleStream::Prefetch(const uint32_t slice, const int32_t pos, const int32_t dir,
+                                    const int32_t samplesPerBlock, const int32_t jumpPos, const int32_t headPos) {
+        if (isDirect()) return;
+        if (slice != refSlice) {
+            sampleRom.Unreference(refSlice);
+            sampleRom.Reference(slice);
+            refSlice = slice;
+        }
+        const int32_t size = sampleRom.GetSliceSize(slice);
+        if (size == 0) return;
+        if (sampleRom.IsSliceCached(slice)) { // referenced, i.e. stays cached
+            for (auto &w : wanted) w.store(NO_KEY, std::memory_order_relaxed);
+            return;
+        }
+        uint32_t keys[STREAM_N_WANTED];
+        uint32_t n = 0;
+        auto add = [&](const int32_t p) {
+            if (p < 0 || p >= size || n == STREAM_N_WANTED) return;
+            const uint32_t k = key(slice, p / STREAM_CHUNK_SZ);
+            for (uint32_t i = 0; i < n; i++) if (keys[i] == k) return;
+            keys[n++] = k;
+        };
+        // current read, then where playback continues, then ahead in playback direction and one chunk behind
+        const int32_t len = std::max(samplesPerBlock, 1);
+        const int32_t lead = dir >= 0 ? pos + len - 1 : pos;
+        add(pos);
+        add(pos + len - 1);
+        add(jumpPos);
+        add(jumpPos + (dir >= 0 ? len - 1 : -len));
+        add(headPos);
+        add(headPos + len);
+        const int32_t ahead = std::max(len * STREAM_AHEAD_BLOCKS, STREAM_CHUNK_SZ);
+        for (int32_t d = STREAM_CHUNK_SZ; d <= ahead && n < STREAM_N_WANTED - 1; d += STREAM_CHUNK_SZ)
+            add(lead + (dir >= 0 ? d : -d));
+        add(dir >= 0 ? pos - STREAM_CHUNK_SZ : pos + len - 1 + STREAM_CHUNK_SZ);
+        bool changed = false;
+        for (uint32_t i = 0; i < STREAM_N_WANTED; i++) {
+            const uint32_t k = i < n ? keys[i] : NO_KEY;
+            if (wanted[i].load(std::memory_order_relaxed) == k) continue;
+            wanted[i].store(k, std::memory_order_relaxed);
+            // only wake prefetch task if data is missing
+            if (k != NO_KEY && !isLoaded(k)) changed = true;
+        }
+        if (changed) wakeup.load(std::memory_order_relaxed)();
+    }
+
+    bool ctagSampleStream::isLoaded(const uint32_t k) {
+        for (uint32_t i = 0; i < STREAM_N_CHUNKS; i++) {
+            const uint32_t s0 = chunkSeq[i].load(std::memory_order_acquire);
+            if ((s0 & 1) || chunkKey[i].load(std::memory_order_relaxed) != k) continue;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (chunkSeq[i].load(std::memory_order_relaxed) == s0) return true;
+        }
+        return false;
+    }
+
+    bool ctagSampleStream::IsAvailable(const uint32_t slice, const uint32_t offset, const uint32_t n_samples) {
+        if (isDirect() || sampleRom.IsSliceCached(slice)) return true;
+        const uint32_t size = sampleRom.GetSliceSize(slice);
+        if (offset >= size || n_samples == 0) return true; // nothing to read
+        const uint32_t last = std::min(offset + n_samples, size) - 1;
+        for (uint32_t c = offset / STREAM_CHUNK_SZ; c <= last / STREAM_CHUNK_SZ; c++) {
+            if (!isLoaded(key(slice, c))) return false;
+        }
+        return true;
+    }
+
+    bool ctagSampleStream::readChunk(int16_t *dst, const uint32_t k, const uint32_t from, const uint32_t n) {
+        for (uint32_t i = 0; i < STREAM_N_CHUNKS; i++) {
+            const uint32_t s0 = chunkSeq[i].load(std::memory_order_acquire);
+            if ((s0 & 1) || chunkKey[i].load(std::memory_order_relaxed) != k) continue;
+            memcpy(dst, &mem[i * STREAM_CHUNK_SZ + from], n * sizeof(int16_t));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // chunk has been replaced while copying
+            if (chunkSeq[i].load(std::memory_order_relaxed) != s0) return false;
+            return true;
+        }
+        return false;
+    }
+
+    void ctagSampleStream::ReadSlice(int16_t *dst, const uint32_t slice, const uint32_t offset,
+                                     const uint32_t n_samples) {
+        if (isDirect()) {
+            sampleRom.ReadSlice(dst, slice, offset, n_samples);
+            return;
+        }
+        if (sampleRom.ReadCached(dst, slice, offset, n_samples)) return;
+        const uint32_t size = sampleRom.GetSliceSize(slice);
+        if (offset >= size) return; // nothing to read
+        uint32_t pos = offset;
+        const uint32_t end = std::min(offset + n_samples, size);
+        while (pos < end) {
+            const uint32_t from = pos % STREAM_CHUNK_SZ;
+            const uint32_t n = std::min(STREAM_CHUNK_SZ - from, end - pos);
+            if (!readChunk(dst, key(slice, pos / STREAM_CHUNK_SZ), from, n))
+                memset(dst, 0, n * sizeof(int16_t)); // not loaded in time
+            dst += n;
+            pos += n;
+        }
+    }
+
+    const int16_t *ctagSampleStream::ReadSpan(int16_t *buf, const uint32_t slice, const uint32_t offset,
+                                              const uint32_t n_samples) {
+        const int16_t *data = sampleRom.GetSliceData(slice);
+        if (data != nullptr && offset + n_samples <= sampleRom.GetSliceSize(slice)) return &data[offset];
+        ReadSlice(buf, slice, offset, n_samples);
+        return buf;
+    }
+
+    uint32_t ctagSampleStream::load() {
+        uint32_t nLoaded = 0;
+        uint32_t keys[STREAM_N_WANTED];
+        for (uint32_t i = 0; i < STREAM_N_WANTED; i++) keys[i] = wanted[i].load(std::memory_order_relaxed);
+        for (const uint32_t k : keys) {
+            if (k == NO_KEY || isLoaded(k)) continue;
+            // replace a chunk which is not requested, round robin
+            uint32_t c = STREAM_N_CHUNKS;
+            for (uint32_t i = 0; i < STREAM_N_CHUNKS && c == STREAM_N_CHUNKS; i++) {
+                const uint32_t candidate = (victim + i) % STREAM_N_CHUNKS;
+                const uint32_t ck = chunkKey[candidate].load(std::memory_order_relaxed);
+                if (std::find(keys, keys + STREAM_N_WANTED, ck) == keys + STREAM_N_WANTED || ck == NO_KEY)
+                    c = candidate;
+            }
+            if (c == STREAM_N_CHUNKS) break; // all chunks requested
+            victim = (c + 1) % STREAM_N_CHUNKS;
+            const uint32_t slice = k >> 16, chunk = k & 0xFFFF;
+            const uint32_t offset = chunk * STREAM_CHUNK_SZ;
+            const uint32_t size = sampleRom.GetSliceSize(slice);
+            if (offset >= size) continue;
+            // seqlock, sequence is odd while chunk is written
+            chunkSeq[c].store(chunkSeq[c].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            chunkKey[c].store(NO_KEY, std::memory_order_relaxed);
+            sampleRom.ReadSlice(&mem[c * STREAM_CHUNK_SZ], slice, offset, std::min<uint32_t>(STREAM_CHUNK_SZ, size - offset));
+            chunkKey[c].store(k, std::memory_order_relaxed);
+            chunkSeq[c].store(chunkSeq[c].load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            nLoaded++;
+        }
+        return nLoaded;
+    }
+
+    void ctagSampleStream::invalidate() {
+        for (uint32_t i = 0; i < STREAM_N_CHUNKS; i++) {
+            chunkSeq[i].store(chunkSeq[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            chunkKey[i].store(NO_KEY, std::memory_order_relaxed);
+            chunkSeq[i].store(chunkSeq[i].load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+    }
+
+    uint32_t ctagSampleStream::Service() {
+        std::lock_guard<std::mutex> lock(streamsMutex);
+        if (paused) return 0;
+        uint32_t n = 0;
+        for (auto s : streams) n += s->load();
+        if (ctagSampleRom::ServiceCache()) n++;
+        return n;
+    }
+
+    void ctagSampleStream::SetWakeup(void (*fn)()) {
+        wakeup = fn;
+    }
+
+    void ctagSampleStream::Pause() {
+        paused = true;
+        // wait for running Service call
+        std::lock_guard<std::mutex> lock(streamsMutex);
+    }
+
+    void ctagSampleStream::Resume() {
+        std::lock_guard<std::mutex> lock(streamsMutex);
+        for (auto s : streams) {
+            s->invalidate();
+            // sample rom may have been refreshed, referenced again by next Prefetch
+            s->sampleRom.Unreference(s->refSlice);
+            s->refSlice = NO_KEY;
+        }
+        paused = false;
+    }
+}
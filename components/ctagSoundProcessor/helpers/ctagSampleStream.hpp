@@ -0,0 +1,106 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// streaming access to sample rom slices for voices which play back from flash
+// each stream owns a small cache of fixed size chunks in SPIRAM, the audio thread declares which parts of a slice
+// are read next (Prefetch) and only copies from loaded chunks (ReadSlice), chunks are read from flash by a
+// lower priority prefetch task calling Service, i.e. the audio thread never waits for flash
+// chunks are published with a seqlock, data which is not loaded in time reads as silence
+// the slice a stream plays is referenced in ctagSampleRom, i.e. it is moved into the slice cache by the prefetch task if
+// enabled and not evicted, cached slices are read from cache, without prefetch task all reads are direct
+// a memory mapped sample rom (simulator, CONFIG_SAMPLE_ROM_MMAP) is read in place, without prefetching
+
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "ctagSampleRom.hpp"
+
+#define STREAM_CHUNK_SZ 512 // int16 samples per chunk
+#define STREAM_N_CHUNKS 12 // chunks cached per stream
+#define STREAM_N_WANTED 8 // chunks requested per stream at once
+#define STREAM_AHEAD_BLOCKS 8 // read ahead in blocks of playback
+
+namespace CTAG::SP::HELPERS {
+    class ctagSampleStream final {
+    public:
+        ctagSampleStream();
+        ~ctagSampleStream();
+
+        // audio thread, once per block
+        // pos is start of current read of samplesPerBlock samples, playhead moves in direction dir (1 or -1),
+        // jumpPos is where playback continues after a loop wrap and headPos where the next note starts reading
+        void Prefetch(const uint32_t slice, const int32_t pos, const int32_t dir, const int32_t samplesPerBlock,
+                      const int32_t jumpPos, const int32_t headPos);
+
+        // audio thread, true if range can be read without waiting for flash
+        bool IsAvailable(const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
+
+        // audio thread, like ctagSampleRom::ReadSlice
+        void ReadSlice(int16_t *dst, const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
+
+        // audio thread, sample data in place if sample rom is memory mapped and slice is not encoded, else read into buf
+        const int16_t *ReadSpan(int16_t *buf, const uint32_t slice, const uint32_t offset, const uint32_t n_samples);
+
+        // prefetch task, loads requested chunks of all streams and fills slice cache, returns number of reads from flash
+        static uint32_t Service();
+
+        // called by audio thread when new chunks are requested, enables asynchronous reads
+        static void SetWakeup(void (*fn)());
+
+        // stop / restart prefetching while sample rom is written, restart drops all loaded chunks and references
+        static void Pause();
+        static void Resume();
+
+    private:
+        static constexpr uint32_t NO_KEY = UINT32_MAX;
+
+        // slice and chunk index of slice
+        static uint32_t key(const uint32_t slice, const uint32_t chunk) { return slice << 16 | chunk; }
+
+        bool isDirect();
+
+        // copies chunk part, false if chunk is not loaded
+        bool readChunk(int16_t *dst, const uint32_t k, const uint32_t from, const uint32_t n);
+
+        bool isLoaded(const uint32_t k);
+
+        // prefetch task
+        uint32_t load();
+
+        void invalidate();
+
+        ctagSampleRom sampleRom;
+        int16_t *mem {nullptr}; // STREAM_N_CHUNKS x STREAM_CHUNK_SZ
+        std::atomic<uint32_t> chunkKey[STREAM_N_CHUNKS];
+        std::atomic<uint32_t> chunkSeq[STREAM_N_CHUNKS]; // odd while chunk is written
+        std::atomic<uint32_t> wanted[STREAM_N_WANTED]; // in order of priority
+        uint32_t victim {0};
+        uint32_t refSlice {NO_KEY}; // referenced in sample rom
+
+        static std::mutex streamsMutex;
+        static std::vector<ctagSampleStream *> streams;
+        static std::atomic<void (*)()> wakeup;
+        static std::atomic<bool> paused;
+    };
+}
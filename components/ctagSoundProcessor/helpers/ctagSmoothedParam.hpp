@@ -0,0 +1,84 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// control rate parameter smoothing
+// a target value is given once per block, Process renders a per sample ramp towards it into a block buffer,
+// Next just advances by one block for parameters which are only used at control rate
+// LINEAR reaches the target at the end of each block, ONE_POLE approaches it with time constant timeMs
+// mode is only checked once per call, inner loops are branch free
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+namespace CTAG::SP::HELPERS {
+    class ctagSmoothedParam final {
+    public:
+        enum Mode : uint8_t {
+            LINEAR,
+            ONE_POLE
+        };
+
+        void Init(const Mode m, const float timeMs, const uint32_t blockSz, const float fs = 44100.f) {
+            mode = m;
+            if (timeMs > 0.f) {
+                const float samples = timeMs * 0.001f * fs;
+                coeff = 1.f - expf(-1.f / samples);
+                coeffBlock = 1.f - expf(-static_cast<float>(blockSz) / samples);
+            } else {
+                coeff = coeffBlock = 1.f;
+            }
+        }
+
+        // jump to value, e.g. on preset load or when cv is unassigned
+        void Reset(const float v) { value = v; }
+
+        void Process(const float target, float *buf, const uint32_t n) {
+            float v = value;
+            if (mode == LINEAR) {
+                const float inc = (target - v) / static_cast<float>(n);
+                for (uint32_t i = 0; i < n; i++) buf[i] = v + inc * static_cast<float>(i + 1);
+                v = target;
+            } else {
+                const float c = coeff;
+                for (uint32_t i = 0; i < n; i++) {
+                    v += c * (target - v);
+                    buf[i] = v;
+                }
+            }
+            value = v;
+        }
+
+        float Next(const float target) {
+            if (mode == LINEAR) value = target;
+            else value += coeffBlock * (target - value);
+            return value;
+        }
+
+        float GetValue() const { return value; }
+
+    private:
+        float value {0.f};
+        float coeff {1.f}, coeffBlock {1.f};
+        Mode mode {LINEAR};
+    };
+}
@@ -30,6 +30,11 @@ respective component folders / files if different from this license.
 
 using namespace std;
 
+// audio block size in frames, set by build system, see ctagSoundProcessor.hpp
+#ifndef TBD_BLOCK_SIZE
+#define TBD_BLOCK_SIZE 32
+#endif
+
 namespace CTAG {
     namespace SP {
         // from plaits chord engine augmented with inversions
@@ -95,7 +100,8 @@ namespace CTAG {
             bool IsDead();
 
         private:
-            int16_t buffer[32];
+            static constexpr int kBlockSize = TBD_BLOCK_SIZE;
+            int16_t buffer[kBlockSize];
             int8_t scale[4];
 
             HELPERS::ctagADSREnv adsr;
@@ -111,6 +111,18 @@ namespace CTAG::SYNTHESIS {
                                                            playLength); // relative to play length, could be also relative to sliceLength
         if (loopPos > endPos) loopPos = endPos;
 
+        // sample data is loaded ahead by prefetch task, at playhead while playing and at start of next note,
+        // loops continue at loop marker (fwd) or end (bwd)
+        const int32_t blockLength = static_cast<int32_t>(phaseIncrement * float(size) + readBufferPhase);
+        const bool reverse = playBackDir == PlayBackDirection::BWD || playBackDir == PlayBackDirection::LOOPBWD ||
+                             playBackDir == PlayBackDirection::LOOPBWDPIPO;
+        const int32_t headPos = reverse ? endPos - blockLength - 1 : startPos;
+        int32_t jumpPos = headPos;
+        if (playBackDir == PlayBackDirection::LOOPFWD) jumpPos = loopPos;
+        else if (playBackDir == PlayBackDirection::LOOPBWD) jumpPos = endPos - blockLength;
+        const bool playing = bufferStatus == BufferStatus::RUNNING || bufferStatus == BufferStatus::READLAST;
+        stream.Prefetch(slice, playing ? readPos : headPos, reverse ? -1 : 1, blockLength, jumpPos, headPos);
+
         // in this cases return silence
         if (bufferStatus == BufferStatus::STOPPED) {
             memset(out, 0, size * sizeof(float));
@@ -134,9 +146,16 @@ namespace CTAG::SYNTHESIS {
         //  phaseIncrementMax*size*sizeof(datatype)+4), 32(5octaves up)*32(standard buffer size) --> > 1k words, we use 2k words
         readBufferLength = static_cast<uint32_t>(phaseIncrement * float(size) + readBufferPhase);
 
+        // first block of a note waits until its data has been loaded instead of starting with silence
+        if (bufferStatus == BufferStatus::READFIRST && !stream.IsAvailable(slice, headPos, readBufferLength + 1)) {
+            memset(out, 0, size * sizeof(float));
+            return;
+        }
+
 
         // calc marks and read assemble buffers depending on playback mode
         // readPos semantic is: start read position from linear rom buffer, updated after every read cycle
+        const int16_t *src = readBufferInt16; // sample data, in place if sample rom is memory mapped
         switch (playBackDir) {
             case PlayBackDirection::FWD:
                 // first buffer ?
@@ -148,7 +167,7 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = endPos - readPos;
                     memset(readBufferInt16, 0, readBufferLength * sizeof(int16_t));
                     if(remainBuffer > 0){ // play last couple of samples
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
+                        stream.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
                         bufferStatus = BufferStatus::READLAST;
                     }else{
                         memset(out, 0, size * sizeof(float)); // silence output
@@ -158,11 +177,11 @@ namespace CTAG::SYNTHESIS {
                 }else{
                     // obtain sample rom data
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // and write convert to float buffer
                     for (int i = 0; i < readBufferLength; i++) {
                         readBufferFloat[i + 4] =
-                                static_cast<float>(readBufferInt16[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
+                                static_cast<float>(src[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
                     }
                 }
 
@@ -186,7 +205,7 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = readPos - loopPos + readBufferLength;
                     if(remainBuffer > 0){ // read last couple of samples
                         readPos = startPos;
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
+                        stream.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
                         for (int i = 0; i < readBufferLength; i++) { // read convert reverse
                             readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[remainBuffer - i - 1]&brr_mask) *
                                                      0.000030518509476f; // only 2 for linear interp
@@ -199,10 +218,10 @@ namespace CTAG::SYNTHESIS {
                     }
                 }else{
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // and write convert reversed to float buffer
                     for (int i = 0; i < readBufferLength; i++) {
-                        readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
+                        readBufferFloat[i + 4] = static_cast<float>(src[readBufferLength - i - 1]&brr_mask) *
                                                  0.000030518509476f; // only 2 for linear interp
                     }
                 }
@@ -226,24 +245,24 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = endPos - readPos;
                     if (remainBuffer <= 0) {
                         readPos = loopPos;
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                        src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                         readPos += readBufferLength;
                     } else {
                         int16_t *bufPos = readBufferInt16;
-                        sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                        stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                         readPos = loopPos;
                         // read wrap from loop pos the rest of the buffer
                         if (readBufferLength > remainBuffer) {
                             bufPos = &readBufferInt16[remainBuffer];
                             remainBuffer = readBufferLength - remainBuffer;
-                            sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                            stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                             readPos += remainBuffer;
                         }
                     }
                 } else {
                     // obtain sample rom data
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // update read position
                     readPos += readBufferLength;
                 }
@@ -251,7 +270,7 @@ namespace CTAG::SYNTHESIS {
                 // and write convert to float buffer
                 for (int i = 0; i < readBufferLength; i++) {
                     readBufferFloat[i + 4] =
-                            static_cast<float>(readBufferInt16[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
+                            static_cast<float>(src[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
                 }
 
                 // interpolate process buffer
@@ -270,10 +289,10 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = readPos - loopPos + readBufferLength;
                     if (remainBuffer <= 0) {
                         readPos = endPos - readBufferLength;
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                        src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                         // and write convert reversed to float buffer
                         for (int i = 0; i < readBufferLength; i++) { // read convert reverse
-                            readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
+                            readBufferFloat[i + 4] = static_cast<float>(src[readBufferLength - i - 1]&brr_mask) *
                                                      0.000030518509476f; // only 2 for linear interp
                         }
                         // interpolate process buffer
@@ -282,13 +301,13 @@ namespace CTAG::SYNTHESIS {
                     } else {
                         readPos = loopPos;
                         int16_t *bufPos = &readBufferInt16[readBufferLength - remainBuffer];;
-                        sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                        stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                         if (readBufferLength > remainBuffer) {
                             // read remaining elements
                             bufPos = readBufferInt16;
                             remainBuffer = readBufferLength - remainBuffer;
                             readPos = endPos - remainBuffer;
-                            sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                            stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                         }
                         // and write convert reversed to float buffer
                         for (int i = 0; i < readBufferLength; i++) { // read convert reverse
@@ -302,10 +321,10 @@ namespace CTAG::SYNTHESIS {
                 } else { // normal reverse read
                     // obtain sample rom forward
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // and write convert reversed to float buffer
                     for (int i = 0; i < readBufferLength; i++) { // read convert reverse
-                        readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
+                        readBufferFloat[i + 4] = static_cast<float>(src[readBufferLength - i - 1]&brr_mask) *
                                                  0.000030518509476f; // only 2 for linear interp
                     }
                     // interpolate process buffer
@@ -328,10 +347,10 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = endPos - readPos;
                     if (remainBuffer <= 0) { // pipo event
                         readPos = endPos - readBufferLength;
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                        src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                         // and write convert reversed to float buffer
                         for (int i = 0; i < readBufferLength; i++) { // read convert reverse
-                            readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
+                            readBufferFloat[i + 4] = static_cast<float>(src[readBufferLength - i - 1]&brr_mask) *
                                                      0.000030518509476f; // only 2 for linear interp
                         }
                         // interpolate process buffer
@@ -339,7 +358,7 @@ namespace CTAG::SYNTHESIS {
                         pipoFlip ^= true; // toggle flip
                         readPos -= static_cast<uint32_t>(phaseIncrement * float(size) + readBufferPhase);
                     } else {
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
+                        stream.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
                         int i;
                         for (i = 0; i < remainBuffer; i++) { // still fwd
                             readBufferFloat[i + 4] =
@@ -351,7 +370,7 @@ namespace CTAG::SYNTHESIS {
                             // read remaining elements
                             remainBuffer = readBufferLength - remainBuffer;
                             readPos = readPos - remainBuffer;
-                            sampleRom.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
+                            stream.ReadSlice(readBufferInt16, slice, readPos, remainBuffer);
                             for (; i < readBufferLength; i++) { // read convert reverse
                                 readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
                                                          0.000030518509476f; // only 2 for linear interp
@@ -365,13 +384,13 @@ namespace CTAG::SYNTHESIS {
                 } else {
                     // obtain sample rom data
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // update read position
                     readPos += readBufferLength;
                     // and write convert to float buffer
                     for (int i = 0; i < readBufferLength; i++) {
                         readBufferFloat[i + 4] =
-                                static_cast<float>(readBufferInt16[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
+                                static_cast<float>(src[i]&brr_mask) * 0.000030518509476f; // only 2 for linear interp
                     }
                     // interpolate process buffer
                     processBlock(out, size);
@@ -390,11 +409,11 @@ namespace CTAG::SYNTHESIS {
                     int32_t remainBuffer = readPos - loopPos + readBufferLength;
                     readPos = loopPos;
                     if (remainBuffer <= 0) { // jump to loop marker and read entire buffer from there
-                        sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                        src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                         // and write convert to float buffer
                         for (int i = 0; i < readBufferLength; i++) { // forward play
                             readBufferFloat[i + 4] =
-                                    static_cast<float>(readBufferInt16[i]&brr_mask) *
+                                    static_cast<float>(src[i]&brr_mask) *
                                     0.000030518509476f; // only 2 for linear interp
                         }
                         // interpolate process buffer
@@ -403,7 +422,7 @@ namespace CTAG::SYNTHESIS {
                         pipoFlip ^= true;
                     } else {
                         int16_t *bufPos = readBufferInt16;
-                        sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                        stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                         // still reverse
                         int i;
                         // and write convert reversed to float buffer
@@ -416,7 +435,7 @@ namespace CTAG::SYNTHESIS {
                             // read remaining elements
                             bufPos = &readBufferInt16[i];
                             remainBuffer = readBufferLength - remainBuffer;
-                            sampleRom.ReadSlice(bufPos, slice, readPos, remainBuffer);
+                            stream.ReadSlice(bufPos, slice, readPos, remainBuffer);
                             readPos += remainBuffer;
                             for (; i < readBufferLength; i++) { // rest forward
                                 readBufferFloat[i + 4] =
@@ -431,10 +450,10 @@ namespace CTAG::SYNTHESIS {
                 } else { // normal reverse read
                     // obtain sample rom forward
                     assert(readBufferLength <= (readBufferMaxSize - 4)); // beyond buffer size?
-                    sampleRom.ReadSlice(readBufferInt16, slice, readPos, readBufferLength);
+                    src = stream.ReadSpan(readBufferInt16, slice, readPos, readBufferLength);
                     // and write convert reversed to float buffer
                     for (int i = 0; i < readBufferLength; i++) { // read convert reverse
-                        readBufferFloat[i + 4] = static_cast<float>(readBufferInt16[readBufferLength - i - 1]&brr_mask) *
+                        readBufferFloat[i + 4] = static_cast<float>(src[readBufferLength - i - 1]&brr_mask) *
                                                  0.000030518509476f; // only 2 for linear interp
                     }
                     // interpolate process buffer
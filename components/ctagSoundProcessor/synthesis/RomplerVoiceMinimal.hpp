@@ -22,6 +22,7 @@ respective component folders / files if different from this license.
 #pragma once
 #include <cstdint>
 #include "helpers/ctagSampleRom.hpp"
+#include "helpers/ctagSampleStream.hpp"
 #include "helpers/ctagADEnv.hpp"
 #include "stmlib/dsp/filter.h"
 
@@ -67,6 +68,7 @@ namespace CTAG::SYNTHESIS{
         void processBlock(float *out, const uint32_t size);
         // sample data
         ctagSampleRom sampleRom;
+        ctagSampleStream stream; // sample data read by audio thread
         uint32_t slice = 0;
         // anti aliasing filter data
         float coeffs_lpf[5]{0.f};
@@ -134,7 +134,7 @@ void Codec::setupI2SWM8731() {
     i2s_config.communication_format = (i2s_comm_format_t) I2S_COMM_FORMAT_STAND_I2S;
     i2s_config.intr_alloc_flags = ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL3; // default interrupt priority would be 0
     i2s_config.dma_buf_count = 4;
-    i2s_config.dma_buf_len = 32;
+    i2s_config.dma_buf_len = TBD_BLOCK_SIZE; // one audio block per dma buffer
     i2s_config.use_apll = true;
 
     static i2s_pin_config_t pin_config;
@@ -341,6 +341,11 @@ void IRAM_ATTR Codec::WriteBuffer(float *buf, uint32_t sz) {
 #endif
 }
 
+void IRAM_ATTR Codec::WriteNativeBuffer(const OutSample *buf, uint32_t sz) {
+    size_t nb;
+    i2s_write(I2S_NUM_0, buf, sz * sizeof(OutSample) * 2, &nb, portMAX_DELAY);
+}
+
 
 void Codec::setupSPIWM8978() {
     WM8978_Init();
@@ -402,7 +407,7 @@ void Codec::setupI2SWM8978() {
     i2s_config.communication_format = (i2s_comm_format_t)I2S_COMM_FORMAT_STAND_I2S;
     i2s_config.intr_alloc_flags = ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL3; // default interrupt priority would be 0
     i2s_config.dma_buf_count = 4;
-    i2s_config.dma_buf_len = 32;
+    i2s_config.dma_buf_len = TBD_BLOCK_SIZE; // one audio block per dma buffer
     i2s_config.mclk_multiple = I2S_MCLK_MULTIPLE_128;
     i2s_config.use_apll = true;
 
@@ -22,6 +22,8 @@ respective component folders / files if different from this license.
 
 #pragma once
 
+#include <cstdint>
+#include "sdkconfig.h"
 #include "driver/spi_master.h"
 
 namespace CTAG {
@@ -46,6 +48,30 @@ namespace CTAG {
 
             static void WriteBuffer(float *buf, uint32_t sz);
 
+            // native output word of codec, allows fusing the float conversion into other per sample loops
+#if defined(CONFIG_TBD_PLATFORM_V1) || defined(CONFIG_TBD_PLATFORM_STR)
+            using OutSample = int32_t;
+
+            static inline OutSample ToNative(const float v) {
+                int32_t s = static_cast<int32_t>(8388608.f * v);
+                s = s < -8388608 ? -8388608 : s;
+                s = s > 8388607 ? 8388607 : s;
+                return s << 8; // 24 bit data in 32 bit word
+            }
+#else
+            using OutSample = int16_t;
+
+            static inline OutSample ToNative(const float v) {
+                int32_t s = static_cast<int32_t>(32767.f * v);
+                s = s < -32767 ? -32767 : s;
+                s = s > 32767 ? 32767 : s;
+                return static_cast<OutSample>(s);
+            }
+#endif
+
+            // interleaved stereo of ToNative converted samples, AEM only outputs left channel
+            static void WriteNativeBuffer(const OutSample *buf, uint32_t sz);
+
         private:
 
             static void initSPI();
@@ -47,7 +47,7 @@ void Codec::InitCodec() {
     // TODO is 4 dma descriptors enough? -> any effect on latency, started with 4 but sometime there was noise
     // TODO can be estimated from this https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/peripherals/i2s.html
     chan_cfg.dma_desc_num = 4;
-    chan_cfg.dma_frame_num = 32;
+    chan_cfg.dma_frame_num = TBD_BLOCK_SIZE; // one audio block per dma frame
 
     ESP_ERROR_CHECK(i2s_new_channel(&chan_cfg, &tx_handle, &rx_handle));
 
@@ -179,4 +179,9 @@ void IRAM_ATTR Codec::WriteBuffer(float *buf, uint32_t sz) {
     }
     i2s_channel_write(tx_handle, tmp, sz*2*4, &nb, portMAX_DELAY);
 #endif
+}
+
+void IRAM_ATTR Codec::WriteNativeBuffer(const OutSample *buf, uint32_t sz) {
+    size_t nb;
+    i2s_channel_write(tx_handle, buf, sz * sizeof(OutSample) * 2, &nb, portMAX_DELAY);
 }
\ No newline at end of file
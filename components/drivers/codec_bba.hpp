@@ -51,6 +51,30 @@ namespace CTAG {
 
             static void WriteBuffer(float *buf, uint32_t sz);
 
+            // native output word of codec, allows fusing the float conversion into other per sample loops
+#ifdef CONFIG_TBD_BBA_CODEC_ES8388
+            using OutSample = int16_t;
+
+            static inline OutSample ToNative(const float v) {
+                int32_t s = static_cast<int32_t>(32767.f * v);
+                s = s < -32767 ? -32767 : s;
+                s = s > 32767 ? 32767 : s;
+                return static_cast<OutSample>(s);
+            }
+#else
+            using OutSample = int32_t;
+
+            static inline OutSample ToNative(const float v) {
+                // clamp in float domain, 1.f * 2^31 does not fit into int32
+                float c = v < -1.f ? -1.f : v;
+                c = c > 0.99999994f ? 0.99999994f : c;
+                return static_cast<OutSample>(2147483647.f * c);
+            }
+#endif
+
+            // interleaved stereo of ToNative converted samples
+            static void WriteNativeBuffer(const OutSample *buf, uint32_t sz);
+
         private:
 #ifdef CONFIG_TBD_BBA_CODEC_ES8388
             static es8388 codec;
@@ -13,15 +13,15 @@ void ctagSoundProcessorTemplate::Init(std::size_t blockSize, void *blockPtr) {
 
     // check if blockMem is large enough
     // blockMem is used just like larger blocks of heap memory
-    // assert(blockSize >= memLen);
-    // if memory larger than blockMem is needed, use heap_caps_malloc() instead with MALLOC_CAPS_SPIRAM
+    // assert(blockSize >= blockMemSize);
+    // if memory larger than blockMem is needed, use ctagSPAllocator::Allocate() instead with Region::SPIRAM
 }
 
 // no ctor, use Init() instead, is called from factory after successful creation
 // dtor
 ctagSoundProcessorTemplate::~ctagSoundProcessorTemplate() {
     // no explicit freeing for blockMem needed, done by ctagSPAllocator
-    // explicit free is only needed when using heap_caps_malloc() with MALLOC_CAPS_SPIRAM
+    // memory from ctagSPAllocator::Allocate() is released with the arena, too
 }
 
 void ctagSoundProcessorTemplate::knowYourself(){
@@ -8,6 +8,8 @@ namespace CTAG {
             virtual void Process(const ProcessData &) override;
             // no ctor, use Init() instead, is called from factory after successful creation
             virtual void Init(std::size_t blockSize, void *blockPtr) override;
+            // declare blockMem needed in Init, mono plugins get exactly this much internal memory
+            // static constexpr std::size_t blockMemSize = memLen;
             virtual ~ctagSoundProcessorTemplate();
 
         private:
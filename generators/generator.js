@@ -69,7 +69,10 @@ let smp = {}; // preset object to be written as json
 smp.activePatch = 0;
 smp.patches = [];
 smp.patches.push({"name": "Default", "params": []});
+sCpp1 += '\tstatic constexpr ctagParamDesc params[] {\n';
 mui.params.forEach(el => parseData(el));
+sCpp1 += '\t};\n';
+sCpp1 += '\tsetParamTable(params);\n';
 sCpp1 += '\tisStereo = ' + mui.isStereo + ';\n';
 sCpp1 += '\tid = "' + mui.id + '";\n';
 // create mp preset model
@@ -116,14 +119,9 @@ function hppSource(el){
 }
 
 function cppSource1(el){
-    let s = '';
-    s += '\tpMapPar.emplace("' + el.id + '", [&](const int val){ ' + el.id + ' = val;});\n';
-    if(el.type == 'bool'){
-        s += '\tpMapTrig.emplace("' + el.id + '", [&](const int val){ trig_' + el.id + ' = val;});\n';
-    }else{
-        s += '\tpMapCv.emplace("' + el.id + '", [&](const int val){ cv_' + el.id + ' = val;});\n';
-    }
-    sCpp1 += s;
+    // constexpr parameter table entry, bool params are modulated by trig, all others by cv
+    let macro = el.type == 'bool' ? 'MK_PARAM_BOOL' : 'MK_PARAM_INT';
+    sCpp1 += '\t\t' + macro + '(ctagSoundProcessor' + mui.id + ', ' + el.id + '),\n';
 }
 
 function smpSource(el){
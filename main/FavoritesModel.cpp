@@ -79,9 +79,9 @@ int CTAG::FAV::FavoritesModel::GetFavoritePreset(int const &i, const int &channe
 
 void CTAG::FAV::FavoritesModel::SetFavorite(int const &id, const string &data) {
     loadJSON(m, CTAG::RESOURCES::spiffsRoot + "/data/favs.jsn");
-    if (!m.IsArray()) return;
+    if (!m.IsArray() || id < 0 || id >= (int) m.Size()) return;
     Document d;
     d.Parse(data);
     m[id] = d.Move();
-    storeJSON(m, CTAG::RESOURCES::spiffsRoot + "/data/favs.jsn");
+    storeJSONDeferred(m, CTAG::RESOURCES::spiffsRoot + "/data/favs.jsn");
 }
@@ -271,6 +271,8 @@ esp_err_t OTAManager::InitiateOTA(httpd_req_t *req) {
     // stop audio task
     ESP_LOGI("OTA", "Initiating OTA, stopping audio task.");
     CTAG::AUDIO::SoundProcessorManager::KillAudioTask();
+    // pending writes must not end up in the new file system image
+    CTAG::SP::ctagDataModelBase::FlushDeferred(true);
     return ESP_OK;
 }
 
@@ -0,0 +1,134 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// cpu cycle statistics of one stage of the audio task
+// Record is called by one real-time task per block (single writer), statistics are accumulated over a window
+// of PERF_WINDOW_BLOCKS blocks and then published, GetStats may be called by any other task
+// p99 is estimated from a histogram with bins of 1/32 of the block budget up to twice the budget
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include "esp_attr.h"
+
+#define PERF_WINDOW_BLOCKS 1024
+#define PERF_HIST_BINS 64
+
+namespace CTAG {
+    namespace AUDIO {
+        class PerfCounter final {
+        public:
+            struct Stats {
+                uint32_t min, avg, max, p99; // cycles per block of last window
+                uint32_t overruns; // blocks above budget since reset
+                uint32_t windows; // windows since reset
+            };
+
+            void SetBudget(const uint32_t cycles) {
+                budget = cycles;
+                binWidth = cycles / (PERF_HIST_BINS / 2);
+                if (binWidth == 0) binWidth = 1;
+            }
+
+            // any task, counter is cleared by writer with its next Record
+            void RequestReset() { resetRequested = true; }
+
+            // real-time task, once per block
+            void IRAM_ATTR Record(const uint32_t cycles) {
+                if (resetRequested.exchange(false)) {
+                    clearWindow();
+                    overruns = 0;
+                    beginPublish();
+                    published = Stats {0, 0, 0, 0, 0, 0};
+                    endPublish();
+                }
+                if (cycles < wMin) wMin = cycles;
+                if (cycles > wMax) wMax = cycles;
+                wSum += cycles;
+                if (cycles > budget) overruns++;
+                uint32_t bin = cycles / binWidth;
+                if (bin >= PERF_HIST_BINS) bin = PERF_HIST_BINS - 1;
+                hist[bin]++;
+                if (++wCount < PERF_WINDOW_BLOCKS) return;
+                // window complete, publish
+                uint32_t p99Bin = 0, acc = 0;
+                const uint32_t p99Count = wCount - wCount / 100;
+                for (; p99Bin < PERF_HIST_BINS; p99Bin++) {
+                    acc += hist[p99Bin];
+                    if (acc >= p99Count) break;
+                }
+                uint32_t p99 = (p99Bin + 1) * binWidth;
+                if (p99 > wMax) p99 = wMax;
+                beginPublish();
+                published.min = wMin;
+                published.avg = static_cast<uint32_t>(wSum / wCount);
+                published.max = wMax;
+                published.p99 = p99;
+                published.overruns = overruns;
+                published.windows++;
+                endPublish();
+                clearWindow();
+            }
+
+            Stats GetStats() const {
+                Stats s;
+                uint32_t s0, s1;
+                do {
+                    s0 = seq.load(std::memory_order_acquire);
+                    memcpy(&s, &published, sizeof(Stats));
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    s1 = seq.load(std::memory_order_relaxed);
+                } while ((s0 & 1) || s0 != s1);
+                return s;
+            }
+
+        private:
+            // seqlock, sequence is odd while published stats are written
+            void beginPublish() {
+                seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+
+            void endPublish() {
+                seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            void clearWindow() {
+                wMin = UINT32_MAX;
+                wMax = 0;
+                wSum = 0;
+                wCount = 0;
+                memset(hist, 0, sizeof(hist));
+            }
+
+            uint32_t hist[PERF_HIST_BINS] {};
+            uint64_t wSum {0};
+            uint32_t wMin {UINT32_MAX}, wMax {0}, wCount {0};
+            uint32_t overruns {0};
+            uint32_t budget {UINT32_MAX}, binWidth {1};
+            Stats published {0, 0, 0, 0, 0, 0};
+            std::atomic<uint32_t> seq {0};
+            std::atomic<bool> resetRequested {false};
+        };
+    }
+}
@@ -42,6 +42,8 @@ respective component folders / files if different from this license.
 #include "OTAManager.hpp"
 #include "sdkconfig.h"
 #include "esp_flash.h"
+#include "ctagPathMatch.hpp"
+#include "helpers/ctagSampleCodec.hpp"
 
 using namespace CTAG;
 using namespace CTAG::REST;
@@ -78,6 +80,12 @@ static esp_err_t set_content_type_from_file(httpd_req_t *req, const char *filepa
     return httpd_resp_set_type(req, type);
 }
 
+/* Channel number from last path segment of uri, -1 if not a valid channel */
+static int uriChannel(const httpd_req_t *req) {
+    const int ch = SP::ctagPathMatch::ToInt(SP::ctagPathMatch::LastSegment(req->uri));
+    return ch == 0 || ch == 1 ? ch : -1;
+}
+
 /* Send HTTP response with the contents of the requested file */
 static esp_err_t rest_common_get_handler(httpd_req_t *req) {
     char filepath[FILE_PATH_MAX];
@@ -146,10 +154,7 @@ esp_err_t RestServer::get_active_plugin_get_handler(httpd_req_t *req) {
              heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
              heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
              heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
-    char ch = req->uri[urilen - qlen - 1];
-    ch -= 0x30;
+    int ch = uriChannel(req);
     ESP_LOGD(REST_TAG, "Get active plugin for channel %d", ch);
     string res;
     if (ch == 0 || ch == 1) {
@@ -166,11 +171,8 @@ esp_err_t RestServer::get_params_plugin_get_handler(httpd_req_t *req) {
              heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
              heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
              heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
-    char ch = req->uri[urilen - qlen - 1];
+    int ch = uriChannel(req);
     httpd_resp_set_type(req, "application/json");
-    ch -= 0x30;
     ESP_LOGD(REST_TAG, "Get plugin params for channel %d", ch);
     if (ch == 0 || ch == 1){
         const char *res = CTAG::AUDIO::SoundProcessorManager::GetCStrJSONActivePluginParams(ch);
@@ -189,14 +191,11 @@ esp_err_t RestServer::set_active_plugin_get_handler(httpd_req_t *req) {
              heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
     char s[128];
     char v[128];
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
-    char ch = req->uri[urilen - qlen - 2];
+    int ch = uriChannel(req);
     httpd_resp_set_type(req, "application/json");
     httpd_req_get_url_query_str(req, s, 128);
     httpd_query_key_value(s, "id", v, 128);
     std::string id(v);
-    ch -= 0x30;
     ESP_LOGD(REST_TAG, "Set active plugin for channel %d %s %s", ch, v, s);
     if (ch == 0 || ch == 1){
         CTAG::AUDIO::SoundProcessorManager::SetSoundProcessorChannel(ch, id);
@@ -219,15 +218,13 @@ esp_err_t RestServer::set_plugin_param_get_handler(httpd_req_t *req) {
     char cstrvalue[128];
     string key("");
     int val = 0;
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
     httpd_req_get_url_query_str(req, query, 128);
     httpd_query_key_value(query, "id", id, 128);
-    char ch = req->uri[urilen - qlen - 2];
-    if (strstr(req->uri, "TRIG")) {
+    int ch = uriChannel(req);
+    if (SP::ctagPathMatch::StartsWith(req->uri, "/api/v1/setPluginParamTRIG/")) {
         httpd_query_key_value(query, "trig", cstrvalue, 128);
         key = "trig";
-    } else if (strstr(req->uri, "CV")) {
+    } else if (SP::ctagPathMatch::StartsWith(req->uri, "/api/v1/setPluginParamCV/")) {
         httpd_query_key_value(query, "cv", cstrvalue, 128);
         key = "cv";
     } else {
@@ -236,7 +233,6 @@ esp_err_t RestServer::set_plugin_param_get_handler(httpd_req_t *req) {
     }
     val = atoi(cstrvalue);
     std::string sid(id);
-    ch -= 0x30;
     ESP_LOGD(REST_TAG, "Setting chan %d param %s key %s value %d", ch, id, key.c_str(), val);
     if (ch == 0 || ch == 1)
         CTAG::AUDIO::SoundProcessorManager::SetChannelParamValue(ch, sid, key, val);
@@ -247,12 +243,9 @@ esp_err_t RestServer::set_plugin_param_get_handler(httpd_req_t *req) {
 
 esp_err_t RestServer::get_presets_get_handler(httpd_req_t *req) {
     char query[128];
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
     httpd_req_get_url_query_str(req, query, 128);
-    char ch = req->uri[urilen - qlen - 1];
+    int ch = uriChannel(req);
     httpd_resp_set_type(req, "application/json");
-    ch -= 0x30;
     ESP_LOGD(REST_TAG, "Querying presets for channel %d", ch);
     if (ch == 0 || ch == 1){
         const char* res = CTAG::AUDIO::SoundProcessorManager::GetCStrJSONGetPresets(ch);
@@ -272,13 +265,10 @@ esp_err_t RestServer::save_preset_get_handler(httpd_req_t *req) {
     char query[128];
     char name[128];
     char number[16];
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
     httpd_req_get_url_query_str(req, query, 128);
     httpd_query_key_value(query, "name", name, 128);
     httpd_query_key_value(query, "number", number, 16);
-    char ch = req->uri[urilen - qlen - 2];
-    ch -= 0x30;
+    int ch = uriChannel(req);
     ESP_LOGD(REST_TAG, "Store preset for channel %s %d", req->uri, ch);
     if (ch == 0 || ch == 1)
         CTAG::AUDIO::SoundProcessorManager::ChannelSavePreset(ch, string(name), atoi(number));
@@ -295,13 +285,10 @@ esp_err_t RestServer::load_preset_get_handler(httpd_req_t *req) {
              heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
     char query[128];
     char number[16];
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
     httpd_req_get_url_query_str(req, query, 128);
     httpd_query_key_value(query, "number", number, 16);
-    char ch = req->uri[urilen - qlen - 2];
-    ch -= 0x30;
-    ESP_LOGD("HTTPD", "Load preset for channel %s %c", req->uri, ch);
+    int ch = uriChannel(req);
+    ESP_LOGD("HTTPD", "Load preset for channel %s %d", req->uri, ch);
     if (ch == 0 || ch == 1){
         CTAG::AUDIO::SoundProcessorManager::ChannelLoadPreset(ch, atoi(number));
         FAV::Favorites::DeactivateFavorite();
@@ -311,6 +298,26 @@ esp_err_t RestServer::load_preset_get_handler(httpd_req_t *req) {
     return ESP_OK;
 }
 
+esp_err_t RestServer::morph_presets_get_handler(httpd_req_t *req) {
+    char query[128];
+    char value[16];
+    int a = 0, b = 0, time = 0, cv = -1;
+    httpd_req_get_url_query_str(req, query, 128);
+    if (httpd_query_key_value(query, "a", value, 16) == ESP_OK) a = atoi(value);
+    if (httpd_query_key_value(query, "b", value, 16) == ESP_OK) b = atoi(value);
+    if (httpd_query_key_value(query, "time", value, 16) == ESP_OK) time = atoi(value);
+    if (httpd_query_key_value(query, "cv", value, 16) == ESP_OK) cv = atoi(value);
+    int ch = uriChannel(req);
+    ESP_LOGD(REST_TAG, "Morph presets %d -> %d for channel %d, time %d, cv %d", a, b, ch, time, cv);
+    if ((ch == 0 || ch == 1) && CTAG::AUDIO::SoundProcessorManager::ChannelMorphPresets(ch, a, b, time, cv)) {
+        httpd_resp_set_type(req, "text/html");
+        httpd_resp_send(req, NULL, 0);
+    } else {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Morph not possible");
+    }
+    return ESP_OK;
+}
+
 esp_err_t RestServer::StartRestServer() {
     const char *base_path = "/spiffs/www\0";
     rest_server_context_t *rest_context = (rest_server_context_t *) calloc(1, sizeof(rest_server_context_t));
@@ -322,7 +329,7 @@ esp_err_t RestServer::StartRestServer() {
     config.core_id = 0;
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.task_priority = tskIDLE_PRIORITY + 4;
-    config.max_uri_handlers = 20;
+    config.max_uri_handlers = 26;
     config.stack_size = 8192;
     config.recv_wait_timeout   = 20;
     config.send_wait_timeout = 20;
@@ -441,6 +448,15 @@ esp_err_t RestServer::StartRestServer() {
     };
     httpd_register_uri_handler(server, &load_preset_get_uri);
 
+    /* morph between two presets */
+    httpd_uri_t morph_presets_get_uri = {
+            .uri = "/api/v1/morphPresets*",
+            .method = HTTP_GET,
+            .handler = &RestServer::morph_presets_get_handler,
+            .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &morph_presets_get_uri);
+
     /* get configuration*/
     httpd_uri_t get_configuration_get_uri = {
             .uri = "/api/v1/getConfiguration",
@@ -477,6 +493,42 @@ esp_err_t RestServer::StartRestServer() {
     };
     httpd_register_uri_handler(server, &io_caps_handler_get_uri);
 
+    /* cpu load statistics of plugins */
+    httpd_uri_t perf_stats_get_uri = {
+            .uri = "/api/v1/getPerfStats",
+            .method = HTTP_GET,
+            .handler = &RestServer::get_perf_stats_handler,
+            .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &perf_stats_get_uri);
+
+    /* memory usage of plugins */
+    httpd_uri_t mem_stats_get_uri = {
+            .uri = "/api/v1/getMemStats",
+            .method = HTTP_GET,
+            .handler = &RestServer::get_mem_stats_handler,
+            .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &mem_stats_get_uri);
+
+    /* parameters changed since version */
+    httpd_uri_t param_delta_get_uri = {
+            .uri = "/api/v1/getParamDelta*",
+            .method = HTTP_GET,
+            .handler = &RestServer::get_param_delta_handler,
+            .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &param_delta_get_uri);
+
+    /* set several parameters at once */
+    httpd_uri_t param_patch_post_uri = {
+            .uri = "/api/v1/setParamPatch*",
+            .method = HTTP_POST,
+            .handler = &RestServer::set_param_patch_post_handler,
+            .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &param_patch_post_uri);
+
     /* set configuration */
     httpd_uri_t set_configuration_post_uri = {
             .uri = "/api/v1/setConfiguration",
@@ -603,11 +655,23 @@ esp_err_t RestServer::get_preset_json_handler(httpd_req_t *req) {
     if (pLastSlash) {
         strcpy(pluginID, pLastSlash + 1);
         ESP_LOGD(REST_TAG, "Sending all preset data of plugin %s as JSON", pluginID);
-        const char *json = CTAG::AUDIO::SoundProcessorManager::GetCStrJSONSoundProcessorPresets(string(pluginID));
-        if (nullptr != json)
-            httpd_resp_sendstr(req, json);
+        // streamed in chunks, presets of large plugins are never held in memory as a whole
+        struct { httpd_req_t *req; bool sent; } out {req, false};
+        CTAG::SP::ctagChunkedStream os([](void *ctx, const char *data, size_t len) {
+            auto o = static_cast<decltype(out) *>(ctx);
+            o->sent = true;
+            return httpd_resp_send_chunk(o->req, data, len) == ESP_OK;
+        }, &out);
+        if (!CTAG::AUDIO::SoundProcessorManager::WriteJSONSoundProcessorPresets(string(pluginID), os)) {
+            ESP_LOGE(REST_TAG, "Sending preset data of plugin %s failed", pluginID);
+            // the file is only validated while it is streamed, so a parse error can occur after the status line
+            // and first chunks are out; ending the chunked response with the zero-length chunk would hand the
+            // client a 200 with truncated json, returning ESP_FAIL closes the socket instead so the transfer fails
+            if (!out.sent) httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Preset data corrupt");
+            return ESP_FAIL;
+        }
     }
-    httpd_resp_send(req, NULL, 0);
+    httpd_resp_send_chunk(req, NULL, 0);
     return ESP_OK;
 }
 
@@ -621,6 +685,7 @@ esp_err_t RestServer::reboot_handler(httpd_req_t *req) {
     if (doCal) CTAG::CAL::Calibration::RequestCalibrationOnReboot();
     httpd_resp_set_type(req, "text/html");
     httpd_resp_send(req, NULL, 0);
+    CTAG::SP::ctagDataModelBase::FlushDeferred(true);
     esp_restart();
     return ESP_OK;
 }
@@ -644,10 +709,7 @@ esp_err_t RestServer::get_calibration_get_handler(httpd_req_t *req) {
 
 esp_err_t RestServer::ota_handler(httpd_req_t *req) {
     static int lastOtaRequest = 0;
-    size_t qlen = httpd_req_get_url_query_len(req);
-    size_t urilen = strlen(req->uri);
-    char otaRequest = req->uri[urilen - qlen - 1];
-    otaRequest -= 0x30;
+    int otaRequest = SP::ctagPathMatch::ToInt(SP::ctagPathMatch::LastSegment(req->uri));
     esp_err_t err = ESP_ERR_NOT_FOUND;
     ESP_LOGI("HTTPD", "OTA request type %d, last request was %d, expecting %d", otaRequest, lastOtaRequest,
              lastOtaRequest + 1);
@@ -776,18 +838,17 @@ esp_err_t RestServer::set_preset_json_handler(httpd_req_t *req) {
 }
 
 esp_err_t RestServer::srom_handler(httpd_req_t *req) {
-    char *s = strrchr(req->uri, '/');
-    string cmd = ++s;
+    const std::string_view cmd = SP::ctagPathMatch::LastSegment(req->uri);
 
-    ESP_LOGE("REST", "Sample ROM command: %s", cmd.c_str());
+    ESP_LOGE("REST", "Sample ROM command: %.*s", (int) cmd.size(), cmd.data());
 
-    if(cmd.compare("getSize") == 0){
+    if(cmd == "getSize"){
         httpd_resp_set_type(req, "text/plain");
         httpd_resp_sendstr(req, to_string(CONFIG_SAMPLE_ROM_SIZE).c_str());
         return ESP_OK;
     }
 
-    if(cmd.compare("erase") == 0){
+    if(cmd == "erase"){
         CTAG::AUDIO::SoundProcessorManager::DisablePluginProcessing();
         CTAG::FAV::Favorites::DisableFavoritesUI();
         // erase flash / lengthy operation
@@ -801,7 +862,7 @@ esp_err_t RestServer::srom_handler(httpd_req_t *req) {
         return ESP_OK;
     }
 
-    if(cmd.compare("upRaw") == 0){
+    if(cmd == "upRaw"){
         ESP_LOGI("REST", "Sample ROM flashing!");
         int data_read, remaining = req->content_len, offset = 0;
         char *buffer = (char*)heap_caps_malloc(4096, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
@@ -830,7 +891,8 @@ esp_err_t RestServer::srom_handler(httpd_req_t *req) {
             offset += data_read;
             remaining -= data_read;
             if(blockCnt == 0){
-                if(((uint32_t*)buffer)[0] != 0xdeadface){
+                const uint32_t magic = ((uint32_t*)buffer)[0];
+                if(magic != SAMPLE_ROM_MAGIC && magic != SAMPLE_ROM_MAGIC_ADPCM){
                     ESP_LOGE("REST", "Not a valid sample rom file!");
                     httpd_resp_send_500(req);
                     heap_caps_free(buffer);
@@ -865,23 +927,93 @@ esp_err_t RestServer::get_iocaps_handler(httpd_req_t *req) {
     return ESP_OK;
 }
 
+esp_err_t RestServer::get_perf_stats_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, CTAG::AUDIO::SoundProcessorManager::GetJSONPerfStats().c_str());
+    return ESP_OK;
+}
+
+esp_err_t RestServer::get_mem_stats_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, CTAG::AUDIO::SoundProcessorManager::GetJSONMemStats().c_str());
+    return ESP_OK;
+}
+
+esp_err_t RestServer::get_param_delta_handler(httpd_req_t *req) {
+    char query[64];
+    char v[16];
+    uint32_t since = 0;
+    int ch = uriChannel(req);
+    if (httpd_req_get_url_query_str(req, query, 64) == ESP_OK &&
+        httpd_query_key_value(query, "since", v, 16) == ESP_OK)
+        since = strtoul(v, nullptr, 10);
+    ESP_LOGD(REST_TAG, "Get param delta for channel %d since %lu", ch, (unsigned long) since);
+    httpd_resp_set_type(req, "application/json");
+    if (ch == 0 || ch == 1) {
+        httpd_resp_sendstr(req, CTAG::AUDIO::SoundProcessorManager::GetJSONParamDelta(ch, since).c_str());
+        return ESP_OK;
+    }
+    httpd_resp_send(req, NULL, 0);
+    return ESP_OK;
+}
+
+esp_err_t RestServer::set_param_patch_post_handler(httpd_req_t *req) {
+    int ch = uriChannel(req);
+    char *content = (char *) heap_caps_malloc(req->content_len + 1, MALLOC_CAP_SPIRAM);
+    if (content == nullptr) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    // patches of plugins with many parameters span several tcp segments
+    int remaining = req->content_len;
+    char *ptrContent = content;
+    while (remaining > 0) {
+        int ret = httpd_req_recv(req, ptrContent, remaining > 4096 ? 4096 : remaining);
+        if (ret <= 0) {  /* 0 return value indicates connection closed */
+            heap_caps_free(content);
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT) httpd_resp_send_408(req);
+            else httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        ptrContent += ret;
+        remaining -= ret;
+    }
+    content[req->content_len] = 0;
+    ESP_LOGD(REST_TAG, "Set param patch for channel %d", ch);
+    bool ok = false;
+    if (ch == 0 || ch == 1)
+        ok = CTAG::AUDIO::SoundProcessorManager::SetChannelParamPatch(ch, string(content));
+    heap_caps_free(content);
+    if (!ok) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid parameter patch");
+        return ESP_OK;
+    }
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_send(req, NULL, 0);
+    return ESP_OK;
+}
+
 esp_err_t RestServer::favorite_post_handler(httpd_req_t *req) {
     ESP_LOGD("favorite_post_handler", "1: Mem freesize internal %d, largest block %d, free SPIRAM %d, largest block SPIRAM %d!",
              heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
              heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
              heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
              heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
-    string cmd{req->uri};
+    std::string_view id;
 
-    ESP_LOGD("REST", "Favorite handler cmd: %s", cmd.c_str());
+    ESP_LOGD("REST", "Favorite handler cmd: %s", req->uri);
 
-    if(cmd.rfind("getAll") != string::npos){
+    if(SP::ctagPathMatch::Match("/api/v1/favorites/getAll", req->uri)){
         httpd_resp_set_type(req, "application/json");
         httpd_resp_sendstr(req, FAV::Favorites::GetAllFavorites().c_str());
         return ESP_OK;
     }
 
-    if(cmd.rfind("store") != string::npos){
+    if(SP::ctagPathMatch::Match("/api/v1/favorites/store/:id", req->uri, &id, 1)){
+        if(SP::ctagPathMatch::ToInt(id) < 0 || SP::ctagPathMatch::ToInt(id) > 9){ // 10 favorites
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid favorite id");
+            return ESP_OK;
+        }
         char *content = (char *) heap_caps_malloc(req->content_len + 1, MALLOC_CAP_SPIRAM);
         int ret = httpd_req_recv(req, content, req->content_len);
         if (ret <= 0) {  /* 0 return value indicates connection closed */
@@ -899,18 +1031,20 @@ esp_err_t RestServer::favorite_post_handler(httpd_req_t *req) {
         }
         content[req->content_len] = 0;
         // call upstream API here
-        int id = stoi((cmd.substr(cmd.length() - 1, 1)));
-        CTAG::FAV::Favorites::StoreFavorite(id, string(content));
+        CTAG::FAV::Favorites::StoreFavorite(SP::ctagPathMatch::ToInt(id), string(content));
         free(content);
         httpd_resp_set_type(req, "text/html");
         httpd_resp_send(req, NULL, 0);
         return ESP_OK;
     }
 
-    if(cmd.rfind("recall") != string::npos){
+    if(SP::ctagPathMatch::Match("/api/v1/favorites/recall/:id", req->uri, &id, 1)){
+        if(SP::ctagPathMatch::ToInt(id) < 0 || SP::ctagPathMatch::ToInt(id) > 9){ // 10 favorites
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid favorite id");
+            return ESP_OK;
+        }
         // call upstream API here
-        int id = stoi((cmd.substr(cmd.length() - 1, 1)));
-        FAV::Favorites::ActivateFavorite(id);
+        FAV::Favorites::ActivateFavorite(SP::ctagPathMatch::ToInt(id));
         httpd_resp_set_type(req, "text/html");
         httpd_resp_send(req, NULL, 0);
         return ESP_OK;
@@ -48,6 +48,8 @@ namespace CTAG {
 
             static esp_err_t load_preset_get_handler(httpd_req_t *req);
 
+            static esp_err_t morph_presets_get_handler(httpd_req_t *req);
+
             static esp_err_t set_configuration_post_handler(httpd_req_t *req);
 
             static esp_err_t get_configuration_get_handler(httpd_req_t *req);
@@ -69,6 +71,14 @@ namespace CTAG {
             static esp_err_t srom_handler(httpd_req_t *req);
 
             static esp_err_t get_iocaps_handler(httpd_req_t *req);
+
+            static esp_err_t get_perf_stats_handler(httpd_req_t *req);
+
+            static esp_err_t get_mem_stats_handler(httpd_req_t *req);
+
+            static esp_err_t get_param_delta_handler(httpd_req_t *req);
+
+            static esp_err_t set_param_patch_post_handler(httpd_req_t *req);
         };
     }
 }
\ No newline at end of file
@@ -35,14 +35,21 @@ respective component folders / files if different from this license.
 #include "Control.hpp"
 #include "Favorites.hpp"
 #include <math.h>
+#include <array>
+#include <utility>
 #include "helpers/ctagFastMath.hpp"
 #include "helpers/ctagSampleRom.hpp"
+#include "helpers/ctagSampleStream.hpp"
+#include "helpers/ctagCVInterpolator.hpp"
+#include "PerfCounter.hpp"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
 #include "freeverb3/efilter.hpp"
 #include "stmlib/dsp/dsp.h"
 
 #define MAX(x, y) ((x)>(y)) ? (x) : (y)
 #define MIN(x, y) ((x)<(y)) ? (x) : (y)
-#define BUF_SZ 32
+#define BUF_SZ TBD_BLOCK_SIZE
 //#define NOISE_GATE_LEVEL_CLOSE 0.000065f
 #define NOISE_GATE_LEVEL_CLOSE 0.0001f
 #define NOISE_GATE_LEVEL_OPEN 0.0003f
@@ -55,7 +62,9 @@ using namespace CTAG::DRIVERS;
 #define NG_BOTH 1
 #define NG_LEFT 2
 #define NG_RIGHT 3
-#define CPU_MAX_ALLOWED_CYCLES 174150 // is 32/44100kHz * 240MHz
+#define SWAP_FADE_FRAMES 256 // fade length of channel when swapping plugins, ~6ms
+#define AUDIO_RATE_CVS (N_CVS > 22 ? 22 : N_CVS) // cvs interpolated to audio rate, caps DRAM use of midi cvs on BBA
+#define CPU_MAX_ALLOWED_CYCLES ((uint32_t) (BUF_SZ * 240000000ULL / 44100)) // is BUF_SZ/44100kHz * 240MHz, 174150 @ 32 frames
 
 // global variable, spiffs base directory
 namespace CTAG {
@@ -64,9 +73,102 @@ namespace CTAG {
     }
 }
 
+// gains of channel fades when swapping plugins, only accessed by audio task
+DRAM_ATTR static float chFadeGain[2] {1.f, 1.f};
+
+// master bus kernel, ROUTE is toStereoCH0 * 3 + toStereoCH1, returns level of last frame for meter
+// one instance per configuration, i.e. no branches per sample
+template<uint32_t ROUTE, bool CLIP0, bool CLIP1>
+static float IRAM_ATTR masterBusKernel(const float *in, DRIVERS::Codec::OutSample *out) {
+    constexpr uint32_t toStereo0 = ROUTE / 3, toStereo1 = ROUTE % 3;
+    float l = 0.f, r = 0.f;
+    for (uint32_t i = 0; i < BUF_SZ; i++) {
+        const float a = in[i * 2], b = in[i * 2 + 1];
+        if constexpr (toStereo0 == 1 && toStereo1 == 0) { // spread CH0 to both channels
+            l = 0.5f * a;
+            r = 0.5f * a + b;
+        } else if constexpr (toStereo0 == 0 && toStereo1 == 1) { // spread CH1 to both channels
+            l = 0.5f * b + a;
+            r = 0.5f * b;
+        } else if constexpr (toStereo0 == 1 && toStereo1 == 1) { // spread CH0 + CH1 to both channels
+            l = r = 0.5f * (a + b);
+        } else if constexpr (toStereo0 == 2 && toStereo1 == 2) { // swap channels
+            l = b;
+            r = a;
+        } else if constexpr (toStereo0 == 2 && toStereo1 == 0) { // mix CH0 with CH1 on CH1
+            l = 0.f;
+            r = b + a;
+        } else if constexpr (toStereo0 == 0 && toStereo1 == 2) { // mix CH1 with CH0 on CH0
+            l = a + b;
+            r = 0.f;
+        } else if constexpr (toStereo0 == 2 && toStereo1 == 1) { // move CH0 to CH1, spread CH1 to both
+            l = 0.5f * b;
+            r = 0.5f * b + a;
+        } else if constexpr (toStereo0 == 1 && toStereo1 == 2) { // move CH1 to CH0, spread CH0 to both
+            l = 0.5f * a + b;
+            r = 0.5f * a;
+        } else { // no routing
+            l = a;
+            r = b;
+        }
+        // soft limiting
+        if constexpr (CLIP0) l = stmlib::SoftClip(l);
+        if constexpr (CLIP1) r = stmlib::SoftClip(r);
+        out[i * 2] = DRIVERS::Codec::ToNative(l);
+        out[i * 2 + 1] = DRIVERS::Codec::ToNative(r);
+    }
+    return fabsf(l + r) * 0.5f;
+}
+
+typedef float (*MasterBusKernel)(const float *in, DRIVERS::Codec::OutSample *out);
+
+// kernel index is ROUTE * 4 + CLIP0 * 2 + CLIP1, index & 3 is no routing with same clipping
+template<uint32_t... I>
+static constexpr std::array<MasterBusKernel, sizeof...(I)> makeMasterBusKernels(std::integer_sequence<uint32_t, I...>) {
+    return {&masterBusKernel<I / 4, (I & 2) != 0, (I & 1) != 0>...};
+}
+
+DRAM_ATTR static constexpr auto masterBusKernels = makeMasterBusKernels(std::make_integer_sequence<uint32_t, 36>{});
+
+// cpu cycle statistics of audio task stages, ch1 is recorded by ch1 worker if dual core
+enum PerfStage {
+    PERF_CH0,
+    PERF_CH1,
+    PERF_CONTROL,
+    PERF_MASTER_BUS,
+    PERF_TOTAL,
+    PERF_N_STAGES
+};
+DRAM_ATTR static PerfCounter perf[PERF_N_STAGES];
+
+// audio rate cvs for plugins which use them, only accessed by audio task
+DRAM_ATTR static SP::HELPERS::ctagCVInterpolator<AUDIO_RATE_CVS, BUF_SZ> cvInterpolator;
+
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+// buffers of channel 1 worker, ch1_fbuf is processed on core 0, ch1_daisy holds channel 0 output of previous block
+DRAM_ATTR static float ch1_fbuf[BUF_SZ * 2];
+DRAM_ATTR static float ch1_daisy[BUF_SZ];
+
+// channel 1 real-time worker task, is triggered by audio_task for every block
+void IRAM_ATTR SoundProcessorManager::ch1_task(void *pvParams) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // plugin is the snapshot audio_task took of sp[1], it stays valid as audio_task waits for this block
+        // before it completes a fade or gives processMutex, i.e. before channel 1 can become silent and be swapped
+        if (ch1Data.sp != nullptr) {
+            const esp_cpu_cycle_count_t t = esp_cpu_get_cycle_count();
+            ch1Data.sp->Process(ch1Data.pd);
+            perf[PERF_CH1].Record(esp_cpu_get_cycle_count() - t);
+        }
+        xTaskNotifyGive(audioTaskH);
+    }
+}
+#endif
+
 // audio real-time task
 void IRAM_ATTR SoundProcessorManager::audio_task(void *pvParams) {
     float fbuf[BUF_SZ * 2];
+    DRIVERS::Codec::OutSample obuf[BUF_SZ * 2];
     float peakIn = 0.f, peakOut = 0.f;
     float peakL = 0.f, peakR = 0.f;
     int ngState = NG_OPEN;
@@ -96,7 +198,9 @@ void IRAM_ATTR SoundProcessorManager::audio_task(void *pvParams) {
     while (runAudioTask) {
 
         // update data from ADCs and GPIOs for real-time control
+        esp_cpu_cycle_count_t t = esp_cpu_get_cycle_count();
         CTAG::CTRL::Control::Update(&pd.trig, &pd.cv);
+        perf[PERF_CONTROL].Record(esp_cpu_get_cycle_count() - t);
 
         // get normalized raw data from CODEC
         DRIVERS::Codec::ReadBuffer(fbuf, BUF_SZ);
@@ -183,10 +287,71 @@ void IRAM_ATTR SoundProcessorManager::audio_task(void *pvParams) {
 
         // sound processors
         if (xSemaphoreTake(processMutex, 0) == pdTRUE) {
+            // plugins of silent channels are being swapped and must not be touched
+            const int state0 = chState[0].load(std::memory_order_acquire);
+            const int state1 = chState[1].load(std::memory_order_acquire);
+            ctagSoundProcessor *sp0 = state0 != CH_SILENT ? sp[0] : nullptr;
+            ctagSoundProcessor *sp1 = state1 != CH_SILENT ? sp[1] : nullptr;
+            // apply parameter updates queued by api since last block
+            if (sp0 != nullptr) {
+                sp0->ApplyParamEvents();
+                sp0->ProcessMorph(pd.cv);
+            }
+            if (sp1 != nullptr) {
+                sp1->ApplyParamEvents();
+                sp1->ProcessMorph(pd.cv);
+            }
+            // interpolate cvs to audio rate only if a plugin uses them
+            const bool arCV0 = sp0 != nullptr && sp0->GetUsesAudioRateCV();
+            const bool arCV1 = sp1 != nullptr && sp1->GetUsesAudioRateCV();
+            const float *cvBlock = nullptr;
+            if (arCV0 || arCV1) cvBlock = cvInterpolator.Process(pd.cv);
+            else cvInterpolator.Track(pd.cv);
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+            // channel 1 runs in parallel on core 0, it works on a copy of the input block
+            // if ch0 -> ch1 daisy chain, it receives the output of ch0 from the previous block (one block pipeline)
+            bool isCH1Parallel = false;
+            if (sp0 != nullptr) isStereoCH0 = sp0->GetIsStereo();
+            if (!isStereoCH0 && sp1 != nullptr) {
+                if (ch01Daisy) {
+                    for (uint32_t i = 0; i < BUF_SZ; i++) {
+                        ch1_fbuf[i * 2] = ch1_fbuf[i * 2 + 1] = ch1_daisy[i];
+                    }
+                } else {
+                    memcpy(ch1_fbuf, fbuf, BUF_SZ * 2 * sizeof(float));
+                }
+                ch1Data.sp = sp1;
+                ch1Data.pd.cv = pd.cv;
+                ch1Data.pd.trig = pd.trig;
+                ch1Data.pd.cvBlock = arCV1 ? cvBlock : nullptr;
+                ch1Data.pd.nCVBlock = arCV1 ? AUDIO_RATE_CVS : 0;
+                xTaskNotifyGive(ch1TaskH);
+                isCH1Parallel = true;
+            }
+            pd.cvBlock = arCV0 ? cvBlock : nullptr;
+            pd.nCVBlock = arCV0 ? AUDIO_RATE_CVS : 0;
+            if (sp0 != nullptr) {
+                t = esp_cpu_get_cycle_count();
+                sp0->Process(pd);
+                perf[PERF_CH0].Record(esp_cpu_get_cycle_count() - t);
+            }
+            if (isCH1Parallel) {
+                // wait for ch1 worker, then merge its channel into the output block
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                for (uint32_t i = 0; i < BUF_SZ; i++) {
+                    ch1_daisy[i] = fbuf[i * 2];
+                    fbuf[i * 2 + 1] = ch1_fbuf[i * 2 + 1];
+                }
+            }
+#else
             // apply sound processors
-            if (sp[0] != nullptr) {
-                isStereoCH0 = sp[0]->GetIsStereo();
-                sp[0]->Process(pd);
+            if (sp0 != nullptr) {
+                isStereoCH0 = sp0->GetIsStereo();
+                pd.cvBlock = arCV0 ? cvBlock : nullptr;
+                pd.nCVBlock = arCV0 ? AUDIO_RATE_CVS : 0;
+                t = esp_cpu_get_cycle_count();
+                sp0->Process(pd);
+                perf[PERF_CH0].Record(esp_cpu_get_cycle_count() - t);
             }
             if (!isStereoCH0){
                 // check if ch0 -> ch1 daisy chain, i.e. use output of ch0 as input for ch1
@@ -195,91 +360,45 @@ void IRAM_ATTR SoundProcessorManager::audio_task(void *pvParams) {
                         fbuf[i * 2 + 1] = fbuf[i * 2];
                     }
                 }
-                if (sp[1] != nullptr) sp[1]->Process(pd); // 0 is not a stereo processor
+                pd.cvBlock = arCV1 ? cvBlock : nullptr;
+                pd.nCVBlock = arCV1 ? AUDIO_RATE_CVS : 0;
+                if (sp1 != nullptr) { // 0 is not a stereo processor
+                    t = esp_cpu_get_cycle_count();
+                    sp1->Process(pd);
+                    perf[PERF_CH1].Record(esp_cpu_get_cycle_count() - t);
+                }
             }
+#endif
+            // fade channels in / out which are swapped
+            fadeChannel(fbuf, 0, state0, isStereoCH0);
+            if (!isStereoCH0) fadeChannel(fbuf, 1, state1, false);
             xSemaphoreGive(processMutex);
         } else {
             // mute audio
             memset(fbuf, 0, BUF_SZ * 2 * sizeof(float));
         }
 
-        // to stereo conversion
-        if (!isStereoCH0) {
-            if (toStereoCH0 || toStereoCH1) {
-                float sb[BUF_SZ * 2];
-                memcpy(sb, fbuf, BUF_SZ * 2 * sizeof(float));
-                if (toStereoCH0 == 1 && toStereoCH1 == 0) { // spread CH0 to both channels
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = 0.5f * sb[i * 2];
-                        fbuf[i * 2 + 1] = 0.5f * sb[i * 2] + sb[i * 2 + 1];
-                    }
-                } else if (toStereoCH1 == 1 && toStereoCH0 == 0) { // spread CH1 to both channels
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = 0.5f * sb[i * 2 + 1] + sb[i * 2];
-                        fbuf[i * 2 + 1] = 0.5f * sb[i * 2 + 1];
-                    }
-                } else if (toStereoCH0 == 1 && toStereoCH1 == 1) { // spread CH0 + CH1 to both channels
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = fbuf[i * 2 + 1] = 0.5f * (sb[i * 2] + sb[i * 2 + 1]);
-                    }
-                } else if (toStereoCH0 == 2 && toStereoCH1 == 2) { // swap channels
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = sb[i * 2 + 1];
-                        fbuf[i * 2 + 1] = sb[i * 2];
-                    }
-                } else if (toStereoCH0 == 2 && toStereoCH1 == 0) { // mix CH0 with CH1 on CH1
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = 0.f;
-                        fbuf[i * 2 + 1] += sb[i * 2];
-                    }
-                } else if (toStereoCH0 == 0 && toStereoCH1 == 2) { // mix CH1 with CH0 on CH0
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] += sb[i * 2 + 1];
-                        fbuf[i * 2 + 1] = 0.f;
-                    }
-                } else if (toStereoCH0 == 2 && toStereoCH1 == 1) { // move CH0 to CH1, spread CH1 to both
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = 0.5f * sb[i * 2 + 1];
-                        fbuf[i * 2 + 1] = 0.5f * sb[i * 2 + 1] + sb[i * 2];
-                    }
-                } else if (toStereoCH0 == 1 && toStereoCH1 == 2) { // move CH1 to CH0, spread CH0 to both
-                    for (uint32_t i = 0; i < BUF_SZ; i++) {
-                        fbuf[i * 2] = 0.5f * sb[i * 2] + sb[i * 2 + 1];
-                        fbuf[i * 2 + 1] = 0.5f * sb[i * 2];
-                    }
-                }
-            }
-        }
-
-        // Out peak detection, red for output
-        // limiting output
-        max = 0.f;
-        for (uint32_t i = 0; i < BUF_SZ; i++) {
-            // soft limiting
-            if (ch0_outputSoftClip) {
-                fbuf[i * 2] = stmlib::SoftClip(fbuf[i * 2]);
-            }
-            if (ch1_outputSoftClip) {
-                fbuf[i * 2 + 1] = stmlib::SoftClip(fbuf[i * 2 + 1]);
-            }
-            //if (fbuf[i * 2] > max) max = fbuf[i * 2];
-            //if (fbuf[i * 2 + 1] > max) max = fbuf[i * 2 + 1];
-        }
+        // master bus, stereo routing, soft clip and conversion to codec format in one pass
+        // routing does not apply to stereo plugins, kernel set is selected by updateConfiguration
+        const uint32_t busCfg = masterBusCfg.load(std::memory_order_relaxed);
+        t = esp_cpu_get_cycle_count();
+        const float levelOut = masterBusKernels[isStereoCH0 ? (busCfg & 3) : busCfg](fbuf, obuf);
+        perf[PERF_MASTER_BUS].Record(esp_cpu_get_cycle_count() - t);
 
-        // just take first sample of block for level meter
-        max = fabsf(fbuf[0] + fbuf[1]) / 2.f;
-        peakOut = 0.9f * peakOut + 0.1f * max;
+        // just take one sample of block for level meter, red for output
+        peakOut = 0.9f * peakOut + 0.1f * levelOut;
         //ESP_LOGW("PEAK", "max %.12f, peak %.12f", max, peakOut);
         max = 255.f + 3.2f * HELPERS::fast_dBV(peakOut);
         if (max > 0.f) ledData |= ((uint32_t) max) << 16; // red
 
         // get cpu cycles for audio task and tone led
         diff = esp_cpu_get_cycle_count() - start;
+        perf[PERF_TOTAL].Record(diff);
         if(diff > CPU_MAX_ALLOWED_CYCLES) ledData = 0xB39134; // orange code for cpu overflow
         ledStatus = ledData;
 
-        // write raw float data back to CODEC
-        DRIVERS::Codec::WriteBuffer(fbuf, BUF_SZ);
+        // write converted data back to CODEC
+        DRIVERS::Codec::WriteNativeBuffer(obuf, BUF_SZ);
     }
     memset(fbuf, 0, BUF_SZ * 2 * sizeof(float));
     DRIVERS::Codec::WriteBuffer(fbuf, BUF_SZ);
@@ -287,6 +406,52 @@ void IRAM_ATTR SoundProcessorManager::audio_task(void *pvParams) {
     vTaskDelete(NULL);
 }
 
+void IRAM_ATTR SoundProcessorManager::fadeChannel(float *buf, const int ch, const int state, const bool isStereo) {
+    if (state == CH_RUNNING) return;
+    // mono plugin outputs interleaved on its channel, stereo plugin on ch0 outputs both
+    const uint32_t ofs = isStereo ? 0 : ch;
+    const float step = 1.f / (float) SWAP_FADE_FRAMES;
+    float g = chFadeGain[ch];
+    for (uint32_t i = 0; i < BUF_SZ; i++) {
+        if (state == CH_FADE_OUT) {
+            g -= step;
+            if (g < 0.f) g = 0.f;
+        } else if (state == CH_FADE_IN) {
+            g += step;
+            if (g > 1.f) g = 1.f;
+        } else {
+            g = 0.f;
+        }
+        buf[i * 2 + ofs] *= g;
+        if (isStereo) buf[i * 2 + 1] *= g;
+    }
+    chFadeGain[ch] = g;
+    // state transitions, api may have requested a new state meanwhile, hence compare exchange
+    int expected = state;
+    if (state == CH_FADE_OUT && g == 0.f) chState[ch].compare_exchange_strong(expected, CH_SILENT);
+    else if (state == CH_FADE_IN && g == 1.f) chState[ch].compare_exchange_strong(expected, CH_RUNNING);
+}
+
+void SoundProcessorManager::silenceChannels(const bool ch0, const bool ch1) {
+    // audio task not running, channels can be silenced right away
+    if (runAudioTask != 1) {
+        if (ch0) chState[0] = CH_SILENT;
+        if (ch1) chState[1] = CH_SILENT;
+        return;
+    }
+    if (ch0) chState[0] = CH_FADE_OUT;
+    if (ch1) chState[1] = CH_FADE_OUT;
+    // wait for audio task to complete fade, if it is blocked (e.g. plugin processing disabled) stop it via mutex
+    for (int i = 0; i < 100 / portTICK_PERIOD_MS; i++) {
+        if ((!ch0 || chState[0] == CH_SILENT) && (!ch1 || chState[1] == CH_SILENT)) return;
+        vTaskDelay(1);
+    }
+    xSemaphoreTake(processMutex, portMAX_DELAY);
+    if (ch0) chState[0] = CH_SILENT;
+    if (ch1) chState[1] = CH_SILENT;
+    xSemaphoreGive(processMutex);
+}
+
 void SoundProcessorManager::SetSoundProcessorChannel(const int chan, const string &id) {
     ledBlink = 5;
 
@@ -299,27 +464,61 @@ void SoundProcessorManager::SetSoundProcessorChannel(const int chan, const strin
 
     ESP_LOGI("SPManager", "Switching ch%d to plugin %s", chan, id.c_str());
 
-    // destroy active plugin
-    xSemaphoreTake(processMutex, portMAX_DELAY);
+    // no parameter updates, preset loads or other swaps meanwhile
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    const bool isStereo = model->IsStereo(id) && chan == 0;
+    ctagSPAllocator::AllocationType aType = ctagSPAllocator::AllocationType::CH0;
+    if(chan == 1) aType = ctagSPAllocator::AllocationType::CH1;
+    if(model->IsStereo(id)) aType = ctagSPAllocator::AllocationType::STEREO;
+
+    // keep current plugin if new one does not fit into internal memory next to plugin of other channel, channels are
+    // switched one at a time, so e.g. swapping the plugins of ch0 and ch1 may need the smaller one to be set first
+    if(!ctagSPAllocator::Fits(aType, ctagSoundProcessorFactory::GetInternalMemRequirement(id))){
+        ESP_LOGE("SPManager", "Plugin %s does not fit into internal memory next to ch%d plugin %s!", id.c_str(),
+                 1 - chan, model->GetActiveProcessorID(1 - chan).c_str());
+        xSemaphoreGive(paramMutex);
+        return;
+    }
+
+    // stage json data model of new plugin while old plugin is still playing
+    ctagSPDataModel::Prefetch(id);
+
+    // fade out affected channels, the other channel keeps on playing
+    silenceChannels(chan == 0, chan == 1 || isStereo);
+
+    // destroy active plugin, audio task does not access silent channels, hence no need for processMutex
     if(nullptr != sp[chan]){
         delete sp[chan]; // destruct processor
         sp[chan] = nullptr;
     }
-    if (model->IsStereo(id) && chan == 0) {
+    if (isStereo) {
         if(nullptr != sp[1]){
             delete sp[1]; // destruct processor
             sp[1] = nullptr;
         }
     }
 
-    // create new plugin
-    ctagSPAllocator::AllocationType aType = ctagSPAllocator::AllocationType::CH0;
-    if(chan == 1) aType = ctagSPAllocator::AllocationType::CH1;
-    if(model->IsStereo(id)) aType = ctagSPAllocator::AllocationType::STEREO;
-    sp[chan] = ctagSoundProcessorFactory::Create(id, aType);
+    // create new plugin off the audio path
+    ctagSoundProcessor *newSp = ctagSoundProcessorFactory::Create(id, aType);
+    if (newSp == nullptr) {
+        // channel stays silent and empty, configuration keeps previous plugin
+        ESP_LOGE("SPManager", "Could not create plugin %s for ch%d!", id.c_str(), chan);
+        xSemaphoreGive(paramMutex);
+        return;
+    }
     model->SetActivePluginID(id, chan);
-    sp[chan]->LoadPreset(model->GetActivePatchNum(chan));
-    xSemaphoreGive(processMutex);
+    newSp->LoadPreset(model->GetActivePatchNum(chan));
+    const ctagSPAllocator::Usage usage = ctagSPAllocator::GetUsage(chan);
+    ESP_LOGI("SPManager", "Plugin %s uses %d of %d bytes internal arena, %d of %d bytes SPIRAM arena", id.c_str(),
+             usage.internalUsed, usage.internalSize, usage.spiramUsed, usage.spiramSize);
+
+    // publish new plugin and fade in, release order of chState makes sp[chan] visible to audio task
+    perf[chan].RequestReset();
+    perf[PERF_TOTAL].RequestReset();
+    sp[chan] = newSp;
+    chState[chan].store(CH_FADE_IN, std::memory_order_release);
+    if (isStereo) chState[1].store(CH_RUNNING, std::memory_order_release); // output of ch1 is faded by ch0
+    xSemaphoreGive(paramMutex);
 
 
     ESP_LOGI("SPManager", "Mem freesize internal %d, largest block %d, free SPIRAM %d, largest block SPIRAM %d!",
@@ -332,9 +531,16 @@ void SoundProcessorManager::SetSoundProcessorChannel(const int chan, const strin
 
 TaskHandle_t SoundProcessorManager::audioTaskH;
 TaskHandle_t SoundProcessorManager::ledTaskH;
+TaskHandle_t SoundProcessorManager::prefetchTaskH;
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+TaskHandle_t SoundProcessorManager::ch1TaskH;
+DRAM_ATTR SoundProcessorManager::Ch1Block SoundProcessorManager::ch1Data {nullptr, {ch1_fbuf, nullptr, nullptr}};
+#endif
 DRAM_ATTR ctagSoundProcessor* SoundProcessorManager::sp[2] {nullptr, nullptr};
 std::unique_ptr<SPManagerDataModel> SoundProcessorManager::model;
 DRAM_ATTR SemaphoreHandle_t SoundProcessorManager::processMutex;
+SemaphoreHandle_t SoundProcessorManager::paramMutex;
+DRAM_ATTR atomic<int> SoundProcessorManager::chState[2] {CH_RUNNING, CH_RUNNING};
 atomic<uint32_t> SoundProcessorManager::ledBlink;
 atomic<uint32_t> SoundProcessorManager::ledStatus;
 atomic<uint32_t> SoundProcessorManager::noiseGateCfg;
@@ -342,8 +548,10 @@ atomic<uint32_t> SoundProcessorManager::ch01Daisy;
 atomic<uint32_t> SoundProcessorManager::toStereoCH0;
 atomic<uint32_t> SoundProcessorManager::toStereoCH1;
 atomic<uint32_t> SoundProcessorManager::runAudioTask;
+atomic<uint32_t> SoundProcessorManager::runLedTask;
 atomic<uint32_t> SoundProcessorManager::ch0_outputSoftClip;
 atomic<uint32_t> SoundProcessorManager::ch1_outputSoftClip;
+atomic<uint32_t> SoundProcessorManager::masterBusCfg {0};
 
 void SoundProcessorManager::StartSoundProcessor() {
     ledBlink = 5;
@@ -402,13 +610,27 @@ void SoundProcessorManager::StartSoundProcessor() {
     if (processMutex == NULL) {
         ESP_LOGE("SPM", "Fatal couldn't create mutex!");
     }
+    paramMutex = xSemaphoreCreateMutex();
+    if (paramMutex == NULL) {
+        ESP_LOGE("SPM", "Fatal couldn't create param mutex!");
+    }
 #ifndef CONFIG_TBD_PLATFORM_STR
-    // create led indicator thread
-    xTaskCreatePinnedToCore(&SoundProcessorManager::led_task, "led_task", 4096, nullptr, tskIDLE_PRIORITY + 2,
+    // create led indicator thread, also stores deferred json writes, i.e. needs stack for file system access
+    runLedTask = 1;
+    xTaskCreatePinnedToCore(&SoundProcessorManager::led_task, "led_task", 4096 * 2, nullptr, tskIDLE_PRIORITY + 2,
                             &ledTaskH, 0);
 #endif
+    // sample rom prefetching on core 0, below audio and channel 1 worker
+    xTaskCreatePinnedToCore(&SoundProcessorManager::prefetch_task, "prefetch_task", 4096, nullptr, 20,
+                            &prefetchTaskH, 0);
+    SP::HELPERS::ctagSampleStream::SetWakeup(&SoundProcessorManager::wakePrefetch);
     CTRL::Control::FlushBuffers();
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+    // create channel 1 worker thread on core 0, must exist before audio thread hands blocks over
+    xTaskCreatePinnedToCore(&SoundProcessorManager::ch1_task, "ch1_task", 4096, nullptr, 22, &ch1TaskH, 0);
+#endif
     // create audio thread
+    for (auto &p : perf) p.SetBudget(CPU_MAX_ALLOWED_CYCLES);
     runAudioTask = 1;
     xTaskCreatePinnedToCore(&SoundProcessorManager::audio_task, "audio_task", 4096, nullptr, 23, &audioTaskH, 1);
 
@@ -427,25 +649,168 @@ void SoundProcessorManager::StartSoundProcessor() {
 
 void SoundProcessorManager::SetChannelParamValue(const int chan, const string &id, const string &key, const int val) {
     ledBlink = 3;
-    sp[chan]->SetParamValue(id, key, val);
+    // parameter queues of sound processors are single producer, serialize rest, serial and favorites
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) sp[chan]->SetParamValue(id, key, val);
+    xSemaphoreGive(paramMutex);
+}
+
+string SoundProcessorManager::GetJSONParamDelta(const int chan, const uint32_t since) {
+    ledBlink = 1;
+    string s("{}"); // no plugin on channel
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) s = sp[chan]->GetCStrJSONParamDelta(since);
+    xSemaphoreGive(paramMutex);
+    return s;
+}
+
+bool SoundProcessorManager::SetChannelParamPatch(const int chan, const string &data) {
+    rapidjson::Document d;
+    d.Parse(data.c_str());
+    if (d.HasParseError() || !d.IsObject() || !d.HasMember("params") || !d["params"].IsArray()) {
+        ESP_LOGW("SPManager", "Invalid parameter patch for channel %d", chan);
+        return false;
+    }
+    static const char *keys[] {"current", "cv", "trig"};
+    ledBlink = 3;
+    // all values of one patch are queued without other api calls in between
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) {
+        for (const auto &p : d["params"].GetArray()) {
+            if (!p.IsObject() || !p.HasMember("id") || !p["id"].IsString()) continue;
+            const string id(p["id"].GetString(), p["id"].GetStringLength());
+            for (const auto key : keys) {
+                auto v = p.FindMember(key);
+                if (v != p.MemberEnd() && v->value.IsInt()) sp[chan]->SetParamValue(id, key, v->value.GetInt());
+            }
+        }
+    }
+    xSemaphoreGive(paramMutex);
+    return true;
 }
 
 void SoundProcessorManager::ChannelSavePreset(const int chan, const string &name, const int number) {
     ledBlink = 3;
-    if (sp[chan] == nullptr) return;
-    xSemaphoreTake(processMutex, portMAX_DELAY);
-    sp[chan]->SavePreset(name, number);
-    model->SetActivePatchNum(number, chan);
-    xSemaphoreGive(processMutex);
+    // only touches data model, audio keeps running
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) {
+        sp[chan]->SavePreset(name, number);
+        model->SetActivePatchNum(number, chan);
+    }
+    xSemaphoreGive(paramMutex);
 }
 
 void SoundProcessorManager::ChannelLoadPreset(const int chan, const int number) {
     ledBlink = 3;
-    if (sp[chan] == nullptr) return;
-    xSemaphoreTake(processMutex, portMAX_DELAY);
-    sp[chan]->LoadPreset(number);
-    model->SetActivePatchNum(number, chan);
-    xSemaphoreGive(processMutex);
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) {
+        // read preset while audio keeps running, then hold processing only to apply values
+        sp[chan]->PrepareLoadPreset(number);
+        xSemaphoreTake(processMutex, portMAX_DELAY);
+        sp[chan]->ApplyLoadedPreset();
+        xSemaphoreGive(processMutex);
+        perf[chan].RequestReset();
+        perf[PERF_TOTAL].RequestReset();
+        model->SetActivePatchNum(number, chan);
+    }
+    xSemaphoreGive(paramMutex);
+}
+
+bool SoundProcessorManager::ChannelMorphPresets(const int chan, const int presetA, const int presetB, const int timeMs,
+                                                const int cv) {
+    ledBlink = 3;
+    bool ok = false;
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    if (sp[chan] != nullptr) {
+        // parameter vectors are computed while audio keeps running, processing is held only to hand them over
+        ok = sp[chan]->PrepareMorph(presetA, presetB, timeMs, cv);
+        if (ok) {
+            xSemaphoreTake(processMutex, portMAX_DELAY);
+            sp[chan]->ApplyPreparedMorph();
+            xSemaphoreGive(processMutex);
+        }
+    }
+    xSemaphoreGive(paramMutex);
+    if (!ok) ESP_LOGW("SPManager", "Morph of presets %d, %d not possible on channel %d", presetA, presetB, chan);
+    return ok;
+}
+
+string SoundProcessorManager::GetJSONPerfStats() {
+    static const char *names[PERF_N_STAGES] {"ch0", "ch1", "control", "masterBus", "total"};
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("budget");
+    writer.Uint(CPU_MAX_ALLOWED_CYCLES);
+    writer.Key("blockSize");
+    writer.Uint(BUF_SZ);
+    writer.Key("windowBlocks");
+    writer.Uint(PERF_WINDOW_BLOCKS);
+    for (int i = 0; i < PERF_N_STAGES; i++) {
+        const PerfCounter::Stats st = perf[i].GetStats();
+        writer.Key(names[i]);
+        writer.StartObject();
+        if (i == PERF_CH0 || i == PERF_CH1) {
+            writer.Key("id");
+            writer.String(model->GetActiveProcessorID(i).c_str());
+            writer.Key("preset");
+            writer.Int(model->GetActivePatchNum(i));
+        }
+        writer.Key("min");
+        writer.Uint(st.min);
+        writer.Key("avg");
+        writer.Uint(st.avg);
+        writer.Key("max");
+        writer.Uint(st.max);
+        writer.Key("p99");
+        writer.Uint(st.p99);
+        writer.Key("overruns");
+        writer.Uint(st.overruns);
+        writer.Key("windows");
+        writer.Uint(st.windows);
+        writer.EndObject();
+    }
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+string SoundProcessorManager::GetJSONMemStats() {
+    auto writeUsage = [](rapidjson::Writer<rapidjson::StringBuffer> &writer, const ctagSPAllocator::Usage &u) {
+        writer.Key("internal");
+        writer.Uint(u.internalUsed);
+        writer.Key("internalSize");
+        writer.Uint(u.internalSize);
+        writer.Key("spiram");
+        writer.Uint(u.spiramUsed);
+        writer.Key("spiramSize");
+        writer.Uint(u.spiramSize);
+    };
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    // no plugin creation meanwhile
+    xSemaphoreTake(paramMutex, portMAX_DELAY);
+    writer.StartObject();
+    for (int i = 0; i < 2; i++) {
+        writer.Key(i == 0 ? "ch0" : "ch1");
+        writer.StartObject();
+        writer.Key("id");
+        writer.String(model->GetActiveProcessorID(i).c_str());
+        writeUsage(writer, ctagSPAllocator::GetUsage(i));
+        writer.EndObject();
+    }
+    writer.Key("peaks");
+    writer.StartArray();
+    for (const auto &p : ctagSPAllocator::GetPeakUsage()) {
+        writer.StartObject();
+        writer.Key("id");
+        writer.String(p.first.c_str());
+        writeUsage(writer, p.second);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    xSemaphoreGive(paramMutex);
+    return buffer.GetString();
 }
 
 string SoundProcessorManager::GetStringID(const int chan) {
@@ -515,6 +880,8 @@ void SoundProcessorManager::updateConfiguration() {
     } else if (model->GetConfigurationData("ch1_outputSoftClip").compare("on") == 0) {
         ch1_outputSoftClip = 1;
     }
+    // select master bus kernel for routing and clipping configuration
+    masterBusCfg = (toStereoCH0 * 3 + toStereoCH1) * 4 + ch0_outputSoftClip * 2 + ch1_outputSoftClip;
 
     // output levels of codec
     if(model->GetConfigurationData("ch0_codecLvlOut").compare("") != 0){
@@ -536,7 +903,9 @@ void SoundProcessorManager::updateConfiguration() {
 void SoundProcessorManager::led_task(void *pvParams) {
     uint32_t r = 0, g = 0, b = 0;
     uint32_t data = 0;
-    while (1) {
+    CTAG::SP::ctagDataModelBase::EnableDeferredWrites();
+    while (runLedTask == 1) {
+        CTAG::SP::ctagDataModelBase::FlushDeferred();
         data = ledStatus;
         r = data & 0x00FF0000;
         r >>= 16;
@@ -552,6 +921,21 @@ void SoundProcessorManager::led_task(void *pvParams) {
         if (ledBlink == 42) ledBlink = 44;
         vTaskDelay(50 / portTICK_PERIOD_MS); // 50ms refresh rate for led
     }
+    // stopped outside of FlushDeferred, i.e. task does not hold writeMutex of model base when deleted
+    runLedTask = 2;
+    vTaskDelete(NULL);
+}
+
+void SoundProcessorManager::prefetch_task(void *pvParams) {
+    while (1) {
+        // periodic wake up fills slice cache for reads which did not wake the task
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+        while (SP::HELPERS::ctagSampleStream::Service() > 0);
+    }
+}
+
+void IRAM_ATTR SoundProcessorManager::wakePrefetch() {
+    xTaskNotifyGive(prefetchTaskH);
 }
 
 void SoundProcessorManager::KillAudioTask() {
@@ -560,13 +944,20 @@ void SoundProcessorManager::KillAudioTask() {
     // stop audio Task, delete plugins
     runAudioTask = 0;
     while (runAudioTask != 2); // wait for audio task to be dead
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+    vTaskDelete(ch1TaskH);
+    ch1TaskH = NULL;
+#endif
     if(nullptr!=sp[0]) delete sp[0];
     if(nullptr!=sp[1]) delete sp[1];
     sp[0] = nullptr;
     sp[1] = nullptr;
     ctagSPAllocator::ReleaseInternalBuffer();
+    ctagSPAllocator::ReleaseSPIRAMBuffer();
 #ifndef CONFIG_TBD_PLATFORM_STR
-    vTaskDelete(ledTaskH);
+    // led task may be storing deferred writes, it is asked to stop instead of being deleted
+    runLedTask = 0;
+    while (runLedTask != 2) vTaskDelay(10 / portTICK_PERIOD_MS);
     ledTaskH = NULL;
     vTaskDelay(100 / portTICK_PERIOD_MS);
     DRIVERS::LedRGB::SetLedRGB(255, 0, 255);
@@ -580,11 +971,14 @@ void SoundProcessorManager::KillAudioTask() {
 
 void SoundProcessorManager::DisablePluginProcessing() {
     xSemaphoreTake(processMutex, portMAX_DELAY);
+    // sample rom may be written, no flash reads from prefetch task
+    SP::HELPERS::ctagSampleStream::Pause();
     ledBlink = 42;
 }
 
 void SoundProcessorManager::EnablePluginProcessing() {
     ledBlink = 5;
+    SP::HELPERS::ctagSampleStream::Resume();
     xSemaphoreGive(processMutex);
 }
 
@@ -72,6 +72,11 @@ namespace CTAG {
                 return model->GetCStrJSONSoundProcessorPresets(id);
             }
 
+            static bool WriteJSONSoundProcessorPresets(const string &id, CTAG::SP::ctagChunkedStream &os) {
+                ledBlink = 1;
+                return model->WriteJSONSoundProcessorPresets(id, os);
+            }
+
             static void SetCStrJSONSoundProcessorPreset(const char* id, const char *data) {
                 ledBlink = 1;
                 model->SetCStrJSONSoundProcessorPreset(id, data);
@@ -81,14 +86,30 @@ namespace CTAG {
 
             static string GetStringID(const int chan);
 
+            // cpu cycles per block of plugins and audio task stages, statistics of last window as JSON
+            static string GetJSONPerfStats();
+
+            // arena usage of active plugins and peak usage per plugin id as JSON
+            static string GetJSONMemStats();
+
             static void SetSoundProcessorChannel(const int chan, const string &id);
 
             static void SetChannelParamValue(const int chan, const string &id, const string &key, const int val);
 
+            // parameters of active plugin changed after version since as JSON, see ctagSPDataModel
+            static string GetJSONParamDelta(const int chan, const uint32_t since);
+
+            // applies {"params": [{"id": .., "current": .., "cv": .., "trig": ..}, ..]}, keys are optional
+            static bool SetChannelParamPatch(const int chan, const string &data);
+
             static void ChannelSavePreset(const int chan, const string &name, const int number);
 
             static void ChannelLoadPreset(const int chan, const int number);
 
+            // morphs parameters of active plugin from preset a to b in timeMs, or controlled by cv channel if cv >= 0
+            static bool ChannelMorphPresets(const int chan, const int presetA, const int presetB, const int timeMs,
+                                            const int cv);
+
             static void KillAudioTask();
 
             static void DisablePluginProcessing();
@@ -100,12 +121,47 @@ namespace CTAG {
 
             static void led_task(void *pvParams);
 
+            // reads sample rom data requested by voices of plugins ahead of playback, audio task never reads flash
+            static void prefetch_task(void *pvParams);
+
+            static void wakePrefetch();
+
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+            // worker processing channel 1 on core 0 while audio_task processes channel 0 on core 1
+            static void ch1_task(void *pvParams);
+#endif
+
             static void updateConfiguration();
 
-            static TaskHandle_t audioTaskH, ledTaskH;
+            // plugin swap state of a channel, audio task does not access sp[ch] of silent channel
+            enum ChannelState {
+                CH_RUNNING,
+                CH_FADE_OUT,
+                CH_SILENT,
+                CH_FADE_IN
+            };
+
+            // applies fade of channel state to output of channel, called by audio task
+            static void fadeChannel(float *buf, const int ch, const int state, const bool isStereo);
+
+            // fades out channels and waits until audio task has silenced them
+            static void silenceChannels(const bool ch0, const bool ch1);
+
+            static TaskHandle_t audioTaskH, ledTaskH, prefetchTaskH;
+#ifdef CONFIG_TBD_DUAL_CORE_AUDIO
+            static TaskHandle_t ch1TaskH;
+            // block handed to ch1_task, sp is the channel 1 plugin snapshot of audio_task
+            struct Ch1Block {
+                ctagSoundProcessor *sp;
+                SP::ProcessData pd;
+            };
+            static Ch1Block ch1Data;
+#endif
             static ctagSoundProcessor *sp[2];
             static std::unique_ptr<SPManagerDataModel> model;
             static SemaphoreHandle_t processMutex;
+            static SemaphoreHandle_t paramMutex; // serializes api access to plugins (param queues, presets, swaps)
+            static atomic<int> chState[2];
             static atomic<uint32_t> ledBlink;
             static atomic<uint32_t> ledStatus;
             static atomic<uint32_t> noiseGateCfg;
@@ -113,8 +169,10 @@ namespace CTAG {
             static atomic<uint32_t> toStereoCH0;
             static atomic<uint32_t> toStereoCH1;
             static atomic<uint32_t> runAudioTask;
+            static atomic<uint32_t> runLedTask; // 1 running, 0 stop requested, 2 stopped
             static atomic<uint32_t> ch0_outputSoftClip;
             static atomic<uint32_t> ch1_outputSoftClip;
+            static atomic<uint32_t> masterBusCfg; // index into master bus kernels, set by updateConfiguration
         };
     }
 }
@@ -30,6 +30,8 @@ respective component folders / files if different from this license.
 #include <dirent.h>
 #include "esp_log.h"
 #include "ctagResources.hpp"
+#include "ctagSPPresetStore.hpp"
+#include "ctagSPIndex.hpp"
 
 using namespace CTAG::AUDIO;
 
@@ -45,9 +47,19 @@ SPManagerDataModel::SPManagerDataModel() {
 SPManagerDataModel::~SPManagerDataModel() {
 }
 
-// checks for available sound processors based on data/sp json file entries
+// checks for available sound processors, taken from build time plugin index or data/sp json file entries
 void SPManagerDataModel::getSoundProcessors() {
     if (m.HasMember("availableProcessors")) return;
+    Document index;
+    index.Parse(CTAG::SP::spIndexJSON);
+    if (!index.HasParseError() && index.IsArray() && index.Size() > 0) {
+        ESP_LOGI("SPModel", "Using plugin index of %d sound processors", index.Size());
+        Value sparray(kArrayType);
+        sparray.CopyFrom(index, m.GetAllocator());
+        m.AddMember("availableProcessors", sparray, m.GetAllocator());
+        storeModel();
+        return;
+    }
     DIR *dir;
     struct dirent *ent;
     Value sparray(kArrayType);
@@ -75,16 +87,23 @@ void SPManagerDataModel::getSoundProcessors() {
         }
         closedir(dir);
     }
-    storeJSON(m, MODELJSONFN);
+    storeModel();
+}
+
+// m is only modified by this class and stored on each change, responses are serialized once until next change
+void SPManagerDataModel::storeModel(const bool deferred) {
+    processorsJSON.Clear();
+    configurationJSON.Clear();
+    if (deferred) storeJSONDeferred(m, MODELJSONFN);
+    else storeJSON(m, MODELJSONFN);
 }
 
 const char *SPManagerDataModel::GetCStrJSONSoundProcessors() {
-    loadJSON(m, MODELJSONFN);
-    json.Clear();
-    Writer<StringBuffer> writer(json);
+    if (processorsJSON.GetSize() > 0) return processorsJSON.GetString();
     if (!m.HasMember("availableProcessors")) return nullptr;
+    Writer<StringBuffer> writer(processorsJSON);
     m["availableProcessors"].Accept(writer);
-    return json.GetString();
+    return processorsJSON.GetString();
 }
 
 string SPManagerDataModel::GetActiveProcessorID(const int chan) {
@@ -101,7 +120,7 @@ void SPManagerDataModel::SetActivePluginID(const string &id, const int chan) {
     if (!m["activeProcessors"].IsArray()) return;
     if (m["activeProcessors"].Size() == 0) return;
     m["activeProcessors"][chan].SetString(id, m.GetAllocator());
-    storeJSON(m, MODELJSONFN);
+    storeModel(true);
 }
 
 void SPManagerDataModel::SetActivePatchNum(const int patchNum, const int chan) {
@@ -118,7 +137,7 @@ void SPManagerDataModel::SetActivePatchNum(const int patchNum, const int chan) {
             break;
         }
     }
-    storeJSON(m, MODELJSONFN);
+    storeModel(true);
 }
 
 int SPManagerDataModel::GetActivePatchNum(const int chan) {
@@ -154,6 +173,7 @@ bool SPManagerDataModel::IsStereo(const string &id) {
 void SPManagerDataModel::validatePatches() {
     if (!m.HasMember("lastPatches")) return;
     if (!m["lastPatches"].IsArray()) return;
+    bool changed = false;
     for (auto &chanPatches : m["lastPatches"].GetArray()) {
         //ESP_LOGD("SPModel", "chanP %d, avaiP %d", chanPatches.Size(), m["availableProcessors"].GetArray().Size());
         if (!m.HasMember("availableProcessors")) return;
@@ -166,9 +186,10 @@ void SPManagerDataModel::validatePatches() {
                 obj.AddMember("patchNumber", 0, m.GetAllocator());
                 chanPatches.PushBack(obj, m.GetAllocator());
             }
+            changed = true;
         }
     }
-    storeJSON(m, MODELJSONFN);
+    if (changed) storeModel();
 }
 
 void SPManagerDataModel::validateActiveProcessors() {
@@ -182,11 +203,11 @@ void SPManagerDataModel::validateActiveProcessors() {
                 Value id2(v["id"].GetString(), m.GetAllocator());
                 m["activeProcessors"].PushBack(id1.Move(), m.GetAllocator());
                 m["activeProcessors"].PushBack(id2.Move(), m.GetAllocator());
+                storeModel();
                 break;
             }
         }
     }
-    storeJSON(m, MODELJSONFN);
 }
 
 void SPManagerDataModel::PrintSelf() {
@@ -194,11 +215,11 @@ void SPManagerDataModel::PrintSelf() {
 }
 
 const char *SPManagerDataModel::GetCStrJSONConfiguration() {
+    if (configurationJSON.GetSize() > 0) return configurationJSON.GetString();
     if (!m.HasMember("configuration")) return nullptr;
-    json.Clear();
-    Writer<StringBuffer> writer(json);
+    Writer<StringBuffer> writer(configurationJSON);
     m["configuration"].Accept(writer);
-    return json.GetString();
+    return configurationJSON.GetString();
 }
 
 void SPManagerDataModel::SetConfigurationFromJSON(const string &data) {
@@ -209,7 +230,7 @@ void SPManagerDataModel::SetConfigurationFromJSON(const string &data) {
     Value obj(kObjectType);
     obj.CopyFrom(d, m.GetAllocator());
     m["configuration"] = obj.Move();
-    storeJSON(m, MODELJSONFN);
+    storeModel();
     //PrintSelf();
 }
 
@@ -238,7 +259,7 @@ void SPManagerDataModel::ResetNetworkConfiguration() {
     m["configuration"]["wifi"]["ssid"] = ssid.Move();
     m["configuration"]["wifi"]["pwd"] = pwd.Move();
     m["configuration"]["wifi"]["mode"] = mode.Move();
-    storeJSON(m, MODELJSONFN);
+    storeModel();
 }
 
 const char *SPManagerDataModel::GetCStrJSONSoundProcessorPresets(const string &id) {
@@ -255,12 +276,26 @@ const char *SPManagerDataModel::GetCStrJSONSoundProcessorPresets(const string &i
     return json.GetString();
 }
 
+bool SPManagerDataModel::WriteJSONSoundProcessorPresets(const string &id, CTAG::SP::ctagChunkedStream &os) {
+    Writer<CTAG::SP::ctagChunkedStream> writer(os);
+    writer.StartObject();
+    writer.Key("id");
+    writer.String(id);
+    writer.Key("presets");
+    if (!streamJSON(CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-" + id + ".jsn", writer)) return false;
+    writer.EndObject();
+    os.Flush();
+    return os.IsOk();
+}
+
 void SPManagerDataModel::SetCStrJSONSoundProcessorPreset(const char *id, const char* data) {
     ESP_LOGD("Model", "String %s", data);
     Document presets;
     presets.Parse(data);
     if(presets.HasParseError()) return;
-    storeJSON(presets, string(CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-" + id + ".jsn"));
+    const string fn = CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-" + id + ".jsn";
+    storeJSON(presets, fn);
+    CTAG::SP::ctagSPPresetStore::Invalidate(fn); // binary presets are rebuilt from new json on next access
 }
 
 bool SPManagerDataModel::HasPluginID(const string &id) {
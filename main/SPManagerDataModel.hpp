@@ -47,6 +47,9 @@ namespace CTAG {
 
             const char *GetCStrJSONSoundProcessorPresets(const string &id);
 
+            // same as GetCStrJSONSoundProcessorPresets, streamed to os, false if output is incomplete
+            bool WriteJSONSoundProcessorPresets(const string &id, CTAG::SP::ctagChunkedStream &os);
+
             void SetCStrJSONSoundProcessorPreset(const char *id, const char* data);
 
             string GetActiveProcessorID(const int chan);
@@ -78,7 +81,12 @@ namespace CTAG {
 
             void validatePatches();
 
+            // stores m and invalidates cached responses, must be used for all changes of m,
+            // deferred for frequent changes which may be coalesced
+            void storeModel(const bool deferred = false);
+
             Document m;
+            StringBuffer processorsJSON, configurationJSON;
 #ifndef TBD_SIM
             const string MODELJSONFN = "/spiffs/data/spm-config.jsn";
 #else
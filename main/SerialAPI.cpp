@@ -8,6 +8,7 @@
 #include "SPManager.hpp"
 #include "Favorites.hpp"
 #include "Calibration.hpp"
+#include "ctagPathMatch.hpp"
 #include "driver/gpio.h"
 #include "driver/uart.h"
 
@@ -84,30 +85,34 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{\"error\":\"" + cmd + "\"}");
         return;
     }
-    string s(d["cmd"].GetString());
+    if(!d["cmd"].IsString()){
+        sendString("{\"error\":\"" + cmd + "\"}");
+        return;
+    }
+    const std::string_view s(d["cmd"].GetString(), d["cmd"].GetStringLength());
     if(s == "/api/v1/getPlugins"){
         string s = CTAG::AUDIO::SoundProcessorManager::GetCStrJSONSoundProcessors();
         sendString(s);
         return;
     }
-    if(s.find("/api/v1/getActivePlugin/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getActivePlugin/")){
         int ch = d["ch"].GetInt();
         sendString("{\"id\":\"" + CTAG::AUDIO::SoundProcessorManager::GetStringID(ch) + "\"}");
         return;
     }
-    if(s.find("/api/v1/getPluginParams/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getPluginParams/")){
         int ch = d["ch"].GetInt();
         sendString(CTAG::AUDIO::SoundProcessorManager::GetCStrJSONActivePluginParams(ch));
         return;
     }
-    if(s.find("/api/v1/setActivePlugin/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setActivePlugin/")){
         int ch = d["ch"].GetInt();
         string id = d["id"].GetString();
         CTAG::AUDIO::SoundProcessorManager::SetSoundProcessorChannel(ch, id);
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/setPluginParam/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setPluginParam/")){
         int ch = d["ch"].GetInt();
         int val = d["current"].GetInt();
         string id = d["id"].GetString();
@@ -115,7 +120,7 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/setPluginParamCV/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setPluginParamCV/")){
         int ch = d["ch"].GetInt();
         int val = d["cv"].GetInt();
         string id = d["id"].GetString();
@@ -123,7 +128,7 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/setPluginParamTRIG/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setPluginParamTRIG/")){
         int ch = d["ch"].GetInt();
         int val = d["trig"].GetInt();
         string id = d["id"].GetString();
@@ -131,19 +136,31 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/getPresets/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getPresets/")){
         int ch = d["ch"].GetInt();
         sendString(CTAG::AUDIO::SoundProcessorManager::GetCStrJSONGetPresets(ch));
         return;
     }
-    if(s.find("/api/v1/loadPreset/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/loadPreset/")){
         int ch = d["ch"].GetInt();
         int num = d["number"].GetInt();
         CTAG::AUDIO::SoundProcessorManager::ChannelLoadPreset(ch, num);
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/savePreset/") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/morphPresets/")){
+        int ch = d["ch"].GetInt();
+        int a = d["a"].GetInt();
+        int b = d["b"].GetInt();
+        int time = d.HasMember("time") ? d["time"].GetInt() : 0;
+        int cv = d.HasMember("cv") ? d["cv"].GetInt() : -1;
+        if(CTAG::AUDIO::SoundProcessorManager::ChannelMorphPresets(ch, a, b, time, cv))
+            sendString("{}");
+        else
+            sendString("{\"error\":\"morph not possible\"}");
+        return;
+    }
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/savePreset/")){
         int ch = d["ch"].GetInt();
         int num = d["number"].GetInt();
         string name = d["name"].GetString();
@@ -151,36 +168,65 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/getConfiguration") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getConfiguration")){
         sendString(CTAG::AUDIO::SoundProcessorManager::GetCStrJSONConfiguration());
         return;
     }
-    if(s.find("/api/v1/reboot") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/reboot")){
         int doCal = d["calibration"].GetInt();
         if (doCal) CTAG::CAL::Calibration::RequestCalibrationOnReboot();
         sendString("{}");
+        CTAG::SP::ctagDataModelBase::FlushDeferred(true);
         esp_restart();
         // no return
     }
-    if(s.find("/api/v1/getPresetData") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getPresetData")){
         string pluginID = d["id"].GetString();
-        const char *json = CTAG::AUDIO::SoundProcessorManager::GetCStrJSONSoundProcessorPresets(string(pluginID));
-        if (json != NULL)
-            sendString(json);
-        else
-            sendString("{}");
+        // streamed in chunks, presets of large plugins are never held in memory as a whole
+        CTAG::SP::ctagChunkedStream os([](void *, const char *data, size_t len) {
+            return write(STDOUT_FILENO, data, len) == static_cast<ssize_t>(len);
+        }, nullptr);
+        write(STDOUT_FILENO, &stx, 1);
+        CTAG::AUDIO::SoundProcessorManager::WriteJSONSoundProcessorPresets(pluginID, os);
+        write(STDOUT_FILENO, &etx, 1);
         return;
     }
-    if(s.find("/api/v1/getCalibration") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getCalibration")){
         sendString(CTAG::CAL::Calibration::GetCStrJSONCalibration());
         return;
     }
-    if(s.find("/api/v1/getIOCaps") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getPerfStats")){
+        sendString(CTAG::AUDIO::SoundProcessorManager::GetJSONPerfStats());
+        return;
+    }
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getMemStats")){
+        sendString(CTAG::AUDIO::SoundProcessorManager::GetJSONMemStats());
+        return;
+    }
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getParamDelta/")){
+        if(!d.HasMember("ch") || !d["ch"].IsInt() || (d["ch"].GetInt() != 0 && d["ch"].GetInt() != 1) ||
+           (d.HasMember("since") && !d["since"].IsUint())){
+            sendString("{\"error\":\"invalid channel or since\"}");
+            return;
+        }
+        int ch = d["ch"].GetInt();
+        uint32_t since = d.HasMember("since") ? d["since"].GetUint() : 0;
+        sendString(CTAG::AUDIO::SoundProcessorManager::GetJSONParamDelta(ch, since));
+        return;
+    }
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setParamPatch/")){
+        int ch = d["ch"].GetInt();
+        // command object carries the params array itself
+        if(CTAG::AUDIO::SoundProcessorManager::SetChannelParamPatch(ch, cmd)) sendString("{}");
+        else sendString("{\"error\":\"invalid parameter patch\"}");
+        return;
+    }
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/getIOCaps")){
 #include "IOCapabilities.hpp"
         sendString(s);
         return;
     }
-    if(s.find("/api/v1/setCalibration") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setCalibration")){
         Value calibrationData = d["calibration"].GetObject();
         StringBuffer buffer;
         Writer<StringBuffer> writer(buffer);
@@ -189,7 +235,7 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/setConfiguration") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setConfiguration")){
         Value configData = d["configuration"].GetObject();
         StringBuffer buffer;
         Writer<StringBuffer> writer(buffer);
@@ -198,11 +244,11 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/favorites/getAll") == 0) {
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/favorites/getAll")) {
         sendString(FAV::Favorites::GetAllFavorites().c_str());
         return;
     }
-    if(s.find("/api/v1/favorites/store") == 0) {
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/favorites/store")) {
         Value data = d["data"].GetObject();
         int fav = d["fav"].GetInt();
         StringBuffer buffer;
@@ -212,13 +258,13 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/favorites/recall") == 0) {
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/favorites/recall")) {
         int fav = d["fav"].GetInt();
         FAV::Favorites::ActivateFavorite(fav);
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/setPresetData") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/setPresetData")){
         string id = d["id"].GetString();
         Value presetData = d["data"].GetObject();
         StringBuffer buffer;
@@ -233,13 +279,13 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
     otaAPI
      */
     // sample rom API
-    if(s.find("/api/v1/srom/getSize") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/srom/getSize")){
         sendString(to_string(CONFIG_SAMPLE_ROM_SIZE));
         return;
     }
     // TODO: implement sample rom write with serial api, it is super slow...
     /*
-    if(s.find("/api/v1/srom/erase") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/srom/erase")){
         CTAG::AUDIO::SoundProcessorManager::DisablePluginProcessing();
         // erase flash / lengthy operation
         ESP_LOGI("SERIAL", "Erasing flash start %d, size %d!", CONFIG_SAMPLE_ROM_START_ADDRESS, CONFIG_SAMPLE_ROM_SIZE);
@@ -248,7 +294,7 @@ void CTAG::SAPI::SerialAPI::processAPICommand(const string &cmd) {
         sendString("{}");
         return;
     }
-    if(s.find("/api/v1/srom/upRaw") == 0){
+    if(CTAG::SP::ctagPathMatch::StartsWith(s, "/api/v1/srom/upRaw")){
         int size = d["size"].GetInt();
         // erase flash / lengthy operation
         ESP_LOGI("SERIAL", "Receiving srom BLOB size %d bytes", size);
@@ -35,6 +35,8 @@ respective component folders / files if different from this license.
 #include <vector>
 #include "SPManager.hpp"
 #include "ctagSPAllocator.hpp"
+#include "ctagDataModelBase.hpp"
+#include "ctagResources.hpp"
 
 #if defined(CONFIG_TBD_PLATFORM_AEM) || defined(CONFIG_TBD_PLATFORM_MK2) || defined(CONFIG_TBD_PLATFORM_BBA)
     #include "Display.hpp"
@@ -55,12 +57,14 @@ https://www.embedded.com/modern-c-in-embedded-systems-part-1-myth-and-reality/
 void app_main() {
     // reserve large block of memory before anything else happens
     ctagSPAllocator::AllocateInternalBuffer(CONFIG_SP_FIXED_MEM_ALLOC_SZ); // TBDings has highest needs of 113944 bytes, take 112k=114688 bytes as default
+    ctagSPAllocator::AllocateSPIRAMBuffer(CONFIG_SP_SPIRAM_ARENA_SZ);
 
     // wait until power is somewhat more settled
     vTaskDelay(2000 / portTICK_PERIOD_MS);
 
     // init fs
     DRIVERS::FileSystem::InitFS();
+    CTAG::SP::ctagDataModelBase::RecoverWrites(CTAG::RESOURCES::spiffsRoot + "/data");
 
 #ifndef CONFIG_TBD_PLATFORM_STR
     DRIVERS::LedRGB::InitLedRGB();
@@ -25,12 +25,15 @@ respective component folders / files if different from this license.
 #include <cmath>
 #include <ctagSPAllocator.hpp>
 #include "esp_spi_flash.h"
+#include "helpers/ctagCVInterpolator.hpp"
 
 using namespace CTAG::AUDIO;
 
 std::mutex audioMutex;
+std::mutex paramMutex; // serializes producers of parameter update queues
 TinyWav tw;
 bool isWaveInput = false;
+CTAG::SP::HELPERS::ctagCVInterpolator<4, TBD_BLOCK_SIZE> cvInterpolator; // audio rate cvs
 
 // global variable, spiffs base directory
 namespace CTAG {
@@ -44,25 +47,25 @@ int SimSPManager::inout(void *outputBuffer, void *inputBuffer, unsigned int nBuf
                         double streamTime, RtAudioStreamStatus status, void *userData) {
     bool isStereoCH0;
     SP::ProcessData pd;
-    float fbuf[32 * 2];
+    float fbuf[TBD_BLOCK_SIZE * 2];
     float cv[4] = {0.f, 0.f, 0.f, 0.f};
     uint8_t trig[2] = {0, 0};
 
     if (inputBuffer != NULL)
-        memcpy(fbuf, inputBuffer, 32 * 2 * 4);
+        memcpy(fbuf, inputBuffer, TBD_BLOCK_SIZE * 2 * 4);
     else
-        memset(fbuf, 0, 32 * 2 * 4);
+        memset(fbuf, 0, TBD_BLOCK_SIZE * 2 * 4);
 
     if (isWaveInput) {
         int nread = 0;
         do{
-            nread = tinywav_read_f(&tw, fbuf, 32);
-            if (nread != 32) {
+            nread = tinywav_read_f(&tw, fbuf, TBD_BLOCK_SIZE);
+            if (nread != TBD_BLOCK_SIZE) {
                 tinywav_read_reset(&tw);
             }
-        }while(nread != 32);
+        }while(nread != TBD_BLOCK_SIZE);
         // check value range
-        for(int i=0;i<32;i++){
+        for(int i=0;i<TBD_BLOCK_SIZE;i++){
             if(fbuf[i*2] > 1.f)fbuf[i*2] = 0.f;
             if(fbuf[i*2] < -1.f)fbuf[i*2] = -0.f;
             if(fbuf[i*2 + 1] > 1.f)fbuf[i*2 + 1] = 0.f;
@@ -82,25 +85,44 @@ int SimSPManager::inout(void *outputBuffer, void *inputBuffer, unsigned int nBuf
 
     // sound processors
     if (audioMutex.try_lock()) {
+        // apply parameter updates queued by api since last block
+        for (int ch = 0; ch < 2; ch++) {
+            if (SimSPManager::sp[ch] == nullptr) continue;
+            SimSPManager::sp[ch]->ApplyParamEvents();
+            SimSPManager::sp[ch]->ProcessMorph(pd.cv);
+        }
+        // interpolate cvs to audio rate only if a plugin uses them
+        const bool arCV0 = SimSPManager::sp[0] != nullptr && SimSPManager::sp[0]->GetUsesAudioRateCV();
+        const bool arCV1 = SimSPManager::sp[1] != nullptr && SimSPManager::sp[1]->GetUsesAudioRateCV();
+        const float *cvBlock = nullptr;
+        if (arCV0 || arCV1) cvBlock = cvInterpolator.Process(pd.cv);
+        else cvInterpolator.Track(pd.cv);
         if (SimSPManager::sp[0] != nullptr) {
             isStereoCH0 = SimSPManager::sp[0]->GetIsStereo();
+            pd.cvBlock = arCV0 ? cvBlock : nullptr;
+            pd.nCVBlock = arCV0 ? 4 : 0;
             SimSPManager::sp[0]->Process(pd);
         }
         if (!isStereoCH0)
-            if (SimSPManager::sp[1] != nullptr)
+            if (SimSPManager::sp[1] != nullptr) {
+                pd.cvBlock = arCV1 ? cvBlock : nullptr;
+                pd.nCVBlock = arCV1 ? 4 : 0;
                 SimSPManager::sp[1]->Process(pd); // 0 is not a stereo processor
+            }
         audioMutex.unlock();
     }
 
-    memcpy(outputBuffer, fbuf, 32 * 2 * 4);
+    memcpy(outputBuffer, fbuf, TBD_BLOCK_SIZE * 2 * 4);
     return 0;
 }
 
 void SimSPManager::StartSoundProcessor(int iSoundCardID, string wavFile, string sromFile, bool bOutOnly) {
     ctagSPAllocator::AllocateInternalBuffer(112*1024); // TBDings has highest needs of 113944 bytes, this is 112k=114688 bytes
+    ctagSPAllocator::AllocateSPIRAMBuffer(1536*1024); // StrampDly has highest needs of 1444728 bytes
     // start fake sample rom
     cout << "Trying to open sample rom file (define own with -s command line option): " << sromFile << endl;
     spi_flash_emu_init(sromFile.c_str());
+    CTAG::SP::ctagDataModelBase::RecoverWrites(CTAG::RESOURCES::spiffsRoot + "/data");
     // Initialize simulator parameters
     simModel = std::make_unique<SimDataModel>();
     favModel = std::make_unique<FAV::FavoritesModel>();
@@ -160,7 +182,7 @@ void SimSPManager::StartSoundProcessor(int iSoundCardID, string wavFile, string
     iParams.nChannels = 2;
     oParams.deviceId = iSoundCardID;
     oParams.nChannels = 2;
-    unsigned int bufferFrames = 32;
+    unsigned int bufferFrames = TBD_BLOCK_SIZE;
     std::cout << "Trying to open device id: " << iSoundCardID << endl;
     try {
         if (bOutOnly) {
@@ -168,6 +190,10 @@ void SimSPManager::StartSoundProcessor(int iSoundCardID, string wavFile, string
         } else {
             audio.openStream(&oParams, &iParams, RTAUDIO_FLOAT32, 44100, &bufferFrames, &SimSPManager::inout);
         }
+        if (bufferFrames != TBD_BLOCK_SIZE) {
+            std::cout << "Sound card does not support block size of " << TBD_BLOCK_SIZE << " frames!" << endl;
+            exit(0);
+        }
         // configure channels
         model = std::make_unique<SPManagerDataModel>();
         SetSoundProcessorChannel(0, model->GetActiveProcessorID(0));
@@ -186,14 +212,15 @@ void SimSPManager::StartSoundProcessor(int iSoundCardID, string wavFile, string
 }
 
 void SimSPManager::StopSoundProcessor() {
-    // free sample rom emulation
-    spi_flash_emu_release();
     if (isWaveInput) tinywav_close_read(&tw);
     if (audio.isStreamRunning() && audio.isStreamOpen()) {
         audio.stopStream();
         audio.closeStream();
     }
+    // free sample rom emulation, after audio stopped as sample rom may be read in place
+    spi_flash_emu_release();
     ctagSPAllocator::ReleaseInternalBuffer();
+    ctagSPAllocator::ReleaseSPIRAMBuffer();
 }
 
 void SimSPManager::SetSoundProcessorChannel(const int chan, const string &id) {
@@ -203,6 +230,17 @@ void SimSPManager::SetSoundProcessorChannel(const int chan, const string &id) {
 
     // when trying to set chan 1 and chan 0 is a stereo plugin, return
     if(chan == 1 && model->IsStereo(model->GetActiveProcessorID(0))) return;
+    std::lock_guard<std::mutex> paramLock(paramMutex);
+    ctagSPAllocator::AllocationType aType = ctagSPAllocator::AllocationType::CH0;
+    if(chan == 1) aType = ctagSPAllocator::AllocationType::CH1;
+    if(model->IsStereo(id)) aType = ctagSPAllocator::AllocationType::STEREO;
+    // keep current plugin if new one does not fit next to plugin of other channel, channels are switched one at a time
+    if(!ctagSPAllocator::Fits(aType, ctagSoundProcessorFactory::GetInternalMemRequirement(id))){
+        printf("Plugin %s does not fit into internal memory next to other channel's plugin\n", id.c_str());
+        return;
+    }
+    // stage json data model of new plugin before audio is locked
+    ctagSPDataModel::Prefetch(id);
     audioMutex.lock();
     if(nullptr != sp[chan]){
         delete sp[chan];
@@ -217,16 +255,21 @@ void SimSPManager::SetSoundProcessorChannel(const int chan, const string &id) {
         }
     }
 
-    ctagSPAllocator::AllocationType aType = ctagSPAllocator::AllocationType::CH0;
-    if(chan == 1) aType = ctagSPAllocator::AllocationType::CH1;
-    if(model->IsStereo(id)) aType = ctagSPAllocator::AllocationType::STEREO;
     sp[chan] = ctagSoundProcessorFactory::Create(id, aType);
+    if(sp[chan] == nullptr){
+        // channel stays empty, configuration keeps previous plugin
+        printf("Could not create plugin %s for channel %d\n", id.c_str(), chan);
+        audioMutex.unlock();
+        return;
+    }
     model->SetActivePluginID(id, chan);
     sp[chan]->LoadPreset(model->GetActivePatchNum(chan));
     audioMutex.unlock();
 }
 
 void SimSPManager::SetChannelParamValue(const int chan, const string &id, const string &key, const int val) {
+    std::lock_guard<std::mutex> paramLock(paramMutex);
+    if (sp[chan] == nullptr) return;
     sp[chan]->SetParamValue(id, key, val);
 }
 
@@ -239,11 +282,24 @@ void SimSPManager::ChannelSavePreset(const int chan, const string &name, const i
 }
 
 void SimSPManager::ChannelLoadPreset(const int chan, const int number) {
+    std::lock_guard<std::mutex> paramLock(paramMutex);
     if (sp[chan] == nullptr) return;
+    sp[chan]->PrepareLoadPreset(number);
     audioMutex.lock();
-    sp[chan]->LoadPreset(number);
+    sp[chan]->ApplyLoadedPreset();
+    audioMutex.unlock();
     model->SetActivePatchNum(number, chan);
+}
+
+bool SimSPManager::ChannelMorphPresets(const int chan, const int presetA, const int presetB, const int timeMs,
+                                       const int cv) {
+    std::lock_guard<std::mutex> paramLock(paramMutex);
+    if (sp[chan] == nullptr) return false;
+    if (!sp[chan]->PrepareMorph(presetA, presetB, timeMs, cv)) return false;
+    audioMutex.lock();
+    sp[chan]->ApplyPreparedMorph();
     audioMutex.unlock();
+    return true;
 }
 
 string SimSPManager::GetStringID(const int chan) {
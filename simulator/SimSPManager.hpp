@@ -87,6 +87,10 @@ namespace CTAG {
 
             static void ChannelLoadPreset(const int chan, const int number);
 
+            // morphs parameters of active plugin from preset a to b in timeMs, or controlled by cv channel if cv >= 0
+            static bool ChannelMorphPresets(const int chan, const int presetA, const int presetB, const int timeMs,
+                                            const int cv);
+
             static void SetProcessParams(const string &params);
 
             static const char *GetProcessParams() {
@@ -208,6 +208,29 @@ void WebServer::Start() {
         response->write(SimpleWeb::StatusCode::success_ok);
     };
 
+    server.resource["^/api/v1/morphPresets/([0-1])$"]["GET"] = [](shared_ptr<HttpServer::Response> response,
+                                                                  shared_ptr<HttpServer::Request> request) {
+        // Retrieve string:
+        int ch = std::stoi(request->path_match[1].str());
+        auto query_fields = request->parse_query_string();
+        int a = 0, b = 0, time = 0, cv = -1;
+        for (auto &field: query_fields) {
+            if (field.first == "a") {
+                a = std::stoi(field.second);
+            } else if (field.first == "b") {
+                b = std::stoi(field.second);
+            } else if (field.first == "time") {
+                time = std::stoi(field.second);
+            } else if (field.first == "cv") {
+                cv = std::stoi(field.second);
+            }
+        }
+        if (SimSPManager::ChannelMorphPresets(ch, a, b, time, cv))
+            response->write(SimpleWeb::StatusCode::success_ok);
+        else
+            response->write(SimpleWeb::StatusCode::client_error_bad_request);
+    };
+
     server.resource["^/api/v1/savePreset/([0-1])$"]["GET"] = [](shared_ptr<HttpServer::Response> response,
                                                                 shared_ptr<HttpServer::Request> request) {
         // Retrieve string:
@@ -25,6 +25,11 @@ respective component folders / files if different from this license.
 void *heap_caps_malloc(unsigned int size, unsigned int  caps){
     return malloc(size);
 }
+void *heap_caps_aligned_alloc(unsigned int alignment, unsigned int size, unsigned int caps){
+    void *ptr = NULL;
+    if(posix_memalign(&ptr, alignment, size) != 0) return NULL;
+    return ptr;
+}
 void heap_caps_free(void *ptr){
     free(ptr);
 }
@@ -20,16 +20,36 @@ respective component folders / files if different from this license.
 ***************/
 
 #include "esp_spi_flash.h"
+#include "spi_flash_mmap.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
+#include <assert.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 static char* file_buffer = NULL;
+static size_t file_size = 0;
 
 void spi_flash_emu_init(const char *sromFile) {
     if(file_buffer != NULL) return;
     if(NULL == sromFile) return;
+#ifndef _WIN32
+    // map sample rom file read only, pages are loaded on access
+    int fd = open(sromFile, O_RDONLY);
+    assert(fd >= 0);
+    struct stat st;
+    fstat(fd, &st);
+    file_size = st.st_size;
+    file_buffer = (char*)mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    assert(file_buffer != MAP_FAILED);
+#else
     FILE *f = fopen(sromFile, "rb");
     assert(f != NULL);
     fseek(f, 0L, SEEK_END);
@@ -40,12 +60,19 @@ void spi_flash_emu_init(const char *sromFile) {
     int res = fread(file_buffer, sz, 1, f);
     assert(res != 0);
     fclose(f);
+    file_size = sz;
+#endif
 }
 
 void spi_flash_emu_release(){
     if(file_buffer != NULL){
+#ifndef _WIN32
+        munmap(file_buffer, file_size);
+#else
         free(file_buffer);
+#endif
         file_buffer = NULL;
+        file_size = 0;
     }
 }
 
@@ -53,4 +80,16 @@ esp_err_t spi_flash_read(size_t src, void *dstv, size_t size){
     if(NULL == file_buffer) return ESP_ERR_INVALID_ARG;
     memcpy(dstv, (const void*)&file_buffer[src], size);
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+esp_err_t spi_flash_mmap(size_t src_addr, size_t size, spi_flash_mmap_memory_t memory,
+                         const void **out_ptr, spi_flash_mmap_handle_t *out_handle){
+    if(NULL == file_buffer || src_addr % SPI_FLASH_MMU_PAGE_SIZE != 0) return ESP_ERR_INVALID_ARG;
+    if(src_addr + size > file_size) return ESP_ERR_INVALID_ARG;
+    *out_ptr = &file_buffer[src_addr];
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle){
+}
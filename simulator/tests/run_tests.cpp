@@ -1,12 +1,27 @@
 
 #include "test_ctagADSREnv.hpp"
+#include "test_ctagSPSCQueue.hpp"
+#include "test_ctagSPPresetStore.hpp"
+#include "test_ctagPathMatch.hpp"
+#include "test_ctagSampleCodec.hpp"
 #include "helpers/ctagFastMath.hpp"
 #include <cstdio>
+#include <iostream>
 
 using namespace CTAG::TESTS;
 
 int main(int argc, char** argv){
     test_ctagADSREnv testadsr;
     testadsr.DoTest();
-    return 0;
+    std::cout << std::endl;
+    bool ok = true;
+    test_ctagSPSCQueue testqueue;
+    ok &= testqueue.DoTest();
+    test_ctagSPPresetStore testpresetstore;
+    ok &= testpresetstore.DoTest();
+    test_ctagPathMatch testpathmatch;
+    ok &= testpathmatch.DoTest();
+    test_ctagSampleCodec testsamplecodec;
+    ok &= testsamplecodec.DoTest();
+    return ok ? 0 : 1;
 }
@@ -0,0 +1,93 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "test_ctagPathMatch.hpp"
+#include <iostream>
+#include <string>
+
+using namespace CTAG::TESTS;
+using CTAG::SP::ctagPathMatch;
+
+// matcher is usable at compile time
+static_assert(ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/getAll?x=1"));
+static_assert(ctagPathMatch::ToInt("42") == 42);
+
+bool test_ctagPathMatch::DoTest(){
+    bool ok = true;
+    auto check = [&ok](const bool c, const char *what){
+        if(!c){
+            std::cout << "ctagPathMatch: " << what << " failed" << std::endl;
+            ok = false;
+        }
+    };
+
+    // literal patterns
+    check(ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/getAll"), "literal");
+    check(ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/getAll?ch=0"), "query ignored");
+    check(!ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/get"), "shorter segment");
+    check(!ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites"), "fewer segments");
+    check(!ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/getAll/1"), "more segments");
+    check(!ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v1/favorites/getAll/"), "trailing slash");
+    check(!ctagPathMatch::Match("/api/v1/favorites/getAll", "/api/v2/favorites/getAll"), "other segment");
+
+    // parameter extraction, captures point into url
+    const std::string url("/api/v1/favorites/store/7?name=x");
+    std::string_view id;
+    check(ctagPathMatch::Match("/api/v1/favorites/store/:id", url, &id, 1), "capture");
+    check(id == "7" && id.data() == url.data() + 24, "captured segment");
+    std::string_view caps[3];
+    check(ctagPathMatch::Match("/api/v1/setParam/:ch/:id/:key", "/api/v1/setParam/1/fb/current", caps, 3),
+          "several captures");
+    check(caps[0] == "1" && caps[1] == "fb" && caps[2] == "current", "captured segments");
+
+    // rejection
+    check(!ctagPathMatch::Match("/api/v1/favorites/store/:id", "/api/v1/favorites/store/"), "empty capture");
+    check(!ctagPathMatch::Match("/api/v1/favorites/store/:id", "/api/v1/favorites/store"), "missing capture");
+    check(!ctagPathMatch::Match("/api/v1/favorites/store/:id", "/api/v1/favorites/store/1/2", &id, 1),
+          "capture with extra segment");
+    check(!ctagPathMatch::Match("/api/v1/favorites/store/:id", "/api/v1/favorites/store/1"), "no room for capture");
+    check(!ctagPathMatch::Match("/api/v1/setParam/:ch/:id", "/api/v1/setParam/1/fb", caps, 1), "too many captures");
+    check(!ctagPathMatch::Match("/api/v1/favorites/recall/:id", "/api/v1/favorites/store/1", &id, 1),
+          "literal before capture");
+
+    // rest of path
+    check(ctagPathMatch::Match("/data/*", "/data/sp/mp-x.jsn"), "wildcard");
+    check(ctagPathMatch::Match("/data/*", "/data/"), "wildcard, empty rest");
+    check(!ctagPathMatch::Match("/data/*", "/dbup/sp/mp-x.jsn"), "wildcard, other prefix");
+
+    // helpers
+    check(ctagPathMatch::Path("/a/b?c=/d") == "/a/b", "path");
+    check(ctagPathMatch::LastSegment("/api/v1/getPresets/1?x=y") == "1", "last segment");
+    check(ctagPathMatch::LastSegment("name") == "name", "last segment without slash");
+    check(ctagPathMatch::StartsWith("/spiffs/data", "/spiffs") && !ctagPathMatch::StartsWith("/sp", "/spiffs"),
+          "starts with");
+    check(ctagPathMatch::FindSegment("/spiffs/data/sp/mp-x.jsn", "data") == 8, "find segment");
+    check(ctagPathMatch::FindSegment("/x/mydata/data", "data") == 10, "find whole segment");
+    check(ctagPathMatch::FindSegment("/spiffs/database", "data") == std::string_view::npos, "segment prefix");
+    check(ctagPathMatch::FindSegment("data/x", "data") == 0, "segment at start");
+    check(ctagPathMatch::ToInt("0") == 0 && ctagPathMatch::ToInt("123") == 123, "to int");
+    check(ctagPathMatch::ToInt("") == -1 && ctagPathMatch::ToInt("-1") == -1 && ctagPathMatch::ToInt("1a") == -1,
+          "to int, invalid");
+    check(ctagPathMatch::ToInt("1234567890") == -1, "to int, too long");
+
+    std::cout << "ctagPathMatch: " << (ok ? "passed" : "FAILED") << std::endl;
+    return ok;
+}
@@ -0,0 +1,115 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "test_ctagSPPresetStore.hpp"
+#include <iostream>
+#include <filesystem>
+#include <cstring>
+
+using namespace CTAG::TESTS;
+using namespace CTAG::SP;
+
+bool test_ctagSPPresetStore::DoTest(){
+    bool ok = true;
+    auto check = [&ok](const bool c, const char *what){
+        if(!c){
+            std::cout << "ctagSPPresetStore: " << what << " failed" << std::endl;
+            ok = false;
+        }
+    };
+    const std::string jsonFn = (std::filesystem::temp_directory_path() / "mp-test_ctagSPPresetStore.jsn").string();
+    const std::string binFn = jsonFn.substr(0, jsonFn.rfind('.')) + ".bin";
+    ctagSPPresetStore::Invalidate(jsonFn);
+
+    // presets with different parameter sets, parameter index is union in order of appearance
+    const char *presets = R"({"activePatch": 1, "patches": [
+        {"name": "first", "params": [{"id": "a", "current": 1, "cv": 2}, {"id": "b", "current": -5, "trig": 1}]},
+        {"name": "second", "params": [{"id": "b", "current": 7}, {"id": "c", "current": 3}]},
+        {"name": "name which does not fit into the fixed size name field", "params": []}]})";
+    rapidjson::Document d;
+    d.Parse(presets);
+    model.Store(d, jsonFn);
+    ctagSPPresetStore(jsonFn).Build(d);
+
+    // build and read
+    std::string ids, name;
+    uint32_t idsCrc = 0;
+    std::vector<ctagSPPresetStore::Entry> entries;
+    {
+        ctagSPPresetStore store(jsonFn);
+        check(store.Open(ids, idsCrc), "open after build");
+        check(ids == std::string("a\0b\0c\0", 6), "parameter id table");
+        check(store.GetNumPresets() == 3, "number of presets");
+        check(store.GetActivePatch() == 1, "active patch from json");
+        check(store.Read(0, name, entries) && name == "first" && entries.size() == 3, "read first preset");
+        check(entries[0].flags == (ctagSPPresetStore::PRESENT | ctagSPPresetStore::HAS_CV) &&
+              entries[0].current == 1 && entries[0].cv == 2, "entry with cv");
+        check(entries[1].flags == (ctagSPPresetStore::PRESENT | ctagSPPresetStore::HAS_TRIG) &&
+              entries[1].current == -5 && entries[1].trig == 1, "entry with trig");
+        check(entries[2].flags == 0, "parameter not in preset");
+        check(store.Read(1, name, entries) && name == "second", "read second preset");
+        check(entries[0].flags == 0 && entries[1].current == 7 && entries[2].current == 3, "entries of second preset");
+        check(!store.Read(2, name, entries), "name too long for store");
+        check(!store.Read(3, name, entries) && !store.Read(-1, name, entries), "preset out of range");
+    }
+    {
+        // id table is not read again if caller holds it
+        std::string noIds;
+        ctagSPPresetStore store(jsonFn);
+        check(store.Open(noIds, idsCrc) && noIds.empty(), "open with known id table");
+        store.WriteActivePatch(0);
+    }
+    check(ctagSPPresetStore::ReadActivePatch(jsonFn) == 0, "active patch written to header");
+    check(ctagSPPresetStore(jsonFn).Open(ids, idsCrc), "open after active patch change");
+
+    // stale detection, json of same size but different content
+    d["patches"][0]["params"][0]["current"] = 9;
+    model.Store(d, jsonFn);
+    check(!ctagSPPresetStore(jsonFn).Open(ids, idsCrc), "stale after same size change of json");
+    check(ctagSPPresetStore::ReadActivePatch(jsonFn) == 0, "active patch of stale store");
+    ctagSPPresetStore(jsonFn).Build(d);
+    {
+        ctagSPPresetStore store(jsonFn);
+        check(store.Open(ids, idsCrc) && store.Read(0, name, entries) && entries[0].current == 9, "rebuild");
+    }
+
+    // damaged record
+    FILE *f = fopen(binFn.c_str(), "r+b");
+    check(f != nullptr, "open store file");
+    if(f != nullptr){
+        fseek(f, -1, SEEK_END);
+        const int c = fgetc(f);
+        fseek(f, -1, SEEK_END);
+        fputc(c ^ 0xFF, f);
+        fclose(f);
+        ctagSPPresetStore store(jsonFn);
+        check(store.Open(ids, idsCrc) && store.Read(0, name, entries) && !store.Read(2, name, entries),
+              "damaged record");
+    }
+
+    ctagSPPresetStore::Invalidate(jsonFn);
+    check(!ctagSPPresetStore(jsonFn).Open(ids, idsCrc), "open after invalidate");
+    check(ctagSPPresetStore::ReadActivePatch(jsonFn) == -1, "active patch after invalidate");
+    remove(jsonFn.c_str());
+
+    std::cout << "ctagSPPresetStore: " << (ok ? "passed" : "FAILED") << std::endl;
+    return ok;
+}
@@ -0,0 +1,72 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "test_ctagSPSCQueue.hpp"
+#include <iostream>
+
+using namespace CTAG::TESTS;
+
+bool test_ctagSPSCQueue::DoTest(){
+    bool ok = true;
+    auto check = [&ok](const bool c, const char *what){
+        if(!c){
+            std::cout << "ctagSPSCQueue: " << what << " failed" << std::endl;
+            ok = false;
+        }
+    };
+    int v = -1;
+
+    // empty
+    check(queue.IsEmpty(), "initially empty");
+    check(!queue.Pop(v), "pop from empty");
+    check(v == -1, "pop from empty leaves value");
+
+    // full, one slot is never used
+    for(int i=0;i<7;i++){
+        check(queue.Push(i), "push until full");
+    }
+    check(!queue.Push(7), "push to full");
+    check(!queue.IsEmpty(), "full not empty");
+    check(queue.Pop(v) && v == 0, "pop from full");
+    check(queue.Push(7), "push after pop from full");
+    check(!queue.Push(8), "push to full again");
+    for(int i=1;i<8;i++){
+        check(queue.Pop(v) && v == i, "fifo order of full queue");
+    }
+    check(queue.IsEmpty() && !queue.Pop(v), "empty after draining");
+
+    // wrap around, indices pass the end of the ring many times, every other round one element is left over
+    int next = 0, expected = 0;
+    for(int round=0;round<100;round++){
+        const int nPush = round % 6 + 1;
+        for(int i=0;i<nPush;i++){
+            check(queue.Push(next++), "push while wrapping");
+        }
+        const int nPop = round & 1 ? nPush + 1 : nPush - 1;
+        for(int i=0;i<nPop;i++){
+            check(queue.Pop(v) && v == expected++, "fifo order while wrapping");
+        }
+    }
+    check(next == expected && queue.IsEmpty(), "all elements popped while wrapping");
+
+    std::cout << "ctagSPSCQueue: " << (ok ? "passed" : "FAILED") << std::endl;
+    return ok;
+}
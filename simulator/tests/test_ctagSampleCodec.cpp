@@ -0,0 +1,136 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#include "test_ctagSampleCodec.hpp"
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+using namespace CTAG::TESTS;
+using CTAG::SP::HELPERS::ctagSampleCodec;
+
+void test_ctagSampleCodec::decode(int16_t *dst, const uint32_t offset, const uint32_t len){
+    uint32_t pos = offset;
+    const uint32_t end = offset + len;
+    while(pos < end){
+        const uint32_t b = pos / SAMPLE_ADPCM_BLOCK_SAMPLES;
+        const uint32_t from = pos % SAMPLE_ADPCM_BLOCK_SAMPLES;
+        const uint32_t n = end - pos < SAMPLE_ADPCM_BLOCK_SAMPLES - from ? end - pos : SAMPLE_ADPCM_BLOCK_SAMPLES - from;
+        const uint8_t *src = &encoded[b * SAMPLE_ADPCM_BLOCK_BYTES];
+        if(block != b || state.pos > from){
+            ctagSampleCodec::Begin(state, src);
+            block = b;
+        }
+        ctagSampleCodec::Decode(dst, src, state, from, n);
+        dst += n;
+        pos += n;
+    }
+}
+
+bool test_ctagSampleCodec::DoTest(){
+    bool ok = true;
+    auto check = [&ok](const bool c, const char *what){
+        if(!c){
+            std::cout << "ctagSampleCodec: " << what << " failed" << std::endl;
+            ok = false;
+        }
+    };
+
+    check(ctagSampleCodec::EncodedSize(0) == 0, "encoded size of empty slice");
+    check(ctagSampleCodec::EncodedSize(SAMPLE_ADPCM_BLOCK_SAMPLES) == SAMPLE_ADPCM_BLOCK_BYTES / 2,
+          "encoded size of one block");
+    check(ctagSampleCodec::EncodedSize(SAMPLE_ADPCM_BLOCK_SAMPLES + 1) == SAMPLE_ADPCM_BLOCK_BYTES,
+          "encoded size of started block");
+
+    // three full blocks and a partial last one, decaying tone with a step to exercise step adaption
+    const uint32_t nSamples = 3 * SAMPLE_ADPCM_BLOCK_SAMPLES + 123;
+    std::vector<int16_t> src(nSamples);
+    for(uint32_t i=0;i<nSamples;i++){
+        const float env = expf(-2.f * i / nSamples);
+        src[i] = static_cast<int16_t>(20000.f * env * sinf(2.f * M_PI * 440.f * i / 44100.f) + (i > 800 ? 3000 : 0));
+    }
+    encoded.assign(ctagSampleCodec::EncodedSize(nSamples) * 2, 0);
+    ctagSampleCodec::Encode(encoded.data(), src.data(), nSamples);
+
+    // round trip, reference decodes every block in one go
+    std::vector<int16_t> ref(nSamples);
+    for(uint32_t start=0;start<nSamples;start+=SAMPLE_ADPCM_BLOCK_SAMPLES){
+        const uint32_t n = nSamples - start < SAMPLE_ADPCM_BLOCK_SAMPLES ? nSamples - start : SAMPLE_ADPCM_BLOCK_SAMPLES;
+        ctagSampleCodec::State s;
+        const uint8_t *blk = &encoded[start / SAMPLE_ADPCM_BLOCK_SAMPLES * SAMPLE_ADPCM_BLOCK_BYTES];
+        ctagSampleCodec::Begin(s, blk);
+        ctagSampleCodec::Decode(&ref[start], blk, s, 0, n);
+        check(ref[start] == src[start], "first sample of block is exact");
+    }
+    double sig = 0., err = 0.;
+    for(uint32_t i=0;i<nSamples;i++){
+        sig += double(src[i]) * src[i];
+        err += double(src[i] - ref[i]) * (src[i] - ref[i]);
+    }
+    const double snr = 10. * log10(sig / err);
+    check(snr > 25., "round trip snr");
+
+    // decoder resumes across chunks, chunks cross block boundaries
+    std::vector<int16_t> chunked(nSamples);
+    for(uint32_t pos=0;pos<nSamples;pos+=37){
+        decode(&chunked[pos], pos, nSamples - pos < 37 ? nSamples - pos : 37);
+    }
+    check(chunked == ref, "chunked decode");
+
+    // reading backwards within a block restarts it, single samples resume
+    int16_t x[64];
+    decode(x, 700, 64);
+    check(memcmp(x, &ref[700], sizeof(x)) == 0, "decode in block");
+    decode(x, 600, 64);
+    check(memcmp(x, &ref[600], sizeof(x)) == 0, "decode backwards");
+    bool single = true;
+    for(uint32_t i=495;i<515;i++){
+        decode(x, i, 1);
+        single &= x[0] == ref[i];
+    }
+    check(single, "single samples across block boundary");
+
+    // float decode
+    float f[64];
+    ctagSampleCodec::State s;
+    ctagSampleCodec::Begin(s, &encoded[SAMPLE_ADPCM_BLOCK_BYTES]);
+    ctagSampleCodec::Decode(f, &encoded[SAMPLE_ADPCM_BLOCK_BYTES], s, 10, 64);
+    bool floats = true;
+    for(int i=0;i<64;i++){
+        floats &= fabsf(f[i] - ref[SAMPLE_ADPCM_BLOCK_SAMPLES + 10 + i] / 32767.f) < 1e-6f;
+    }
+    check(floats, "float decode");
+
+    // partial last block, nibbles after last sample of slice are not accessed
+    const uint32_t lastStart = 3 * SAMPLE_ADPCM_BLOCK_SAMPLES;
+    std::vector<uint8_t> last(&encoded[3 * SAMPLE_ADPCM_BLOCK_BYTES], &encoded[4 * SAMPLE_ADPCM_BLOCK_BYTES]);
+    const uint32_t lastByte = 4 + (nSamples - lastStart - 2) / 2; // byte holding nibble of last sample
+    std::fill(last.begin() + lastByte + 1, last.end(), 0xFF);
+    std::vector<int16_t> tail(nSamples - lastStart);
+    ctagSampleCodec::Begin(s, last.data());
+    ctagSampleCodec::Decode(tail.data(), last.data(), s, 0, tail.size());
+    check(std::equal(tail.begin(), tail.end(), ref.begin() + lastStart), "partial last block");
+    check(s.pos == tail.size() - 1, "decoder position after partial last block");
+
+    std::cout << "ctagSampleCodec: " << (ok ? "passed" : "FAILED") << " (snr " << snr << " dB)" << std::endl;
+    return ok;
+}
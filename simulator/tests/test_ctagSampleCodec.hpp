@@ -0,0 +1,46 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+#ifndef CTAG_TBD_TEST_CTAGSAMPLECODEC_HPP
+#define CTAG_TBD_TEST_CTAGSAMPLECODEC_HPP
+
+#include "helpers/ctagSampleCodec.hpp"
+#include <vector>
+
+namespace CTAG{
+    namespace TESTS{
+        class test_ctagSampleCodec {
+        public:
+            // returns false if a check fails, failed checks are printed
+            bool DoTest();
+        private:
+            // decodes len samples from offset of encoded slice in chunks as the sample rom does, the decoder
+            // resumes in the same block and restarts at block boundaries or when reading backwards
+            void decode(int16_t *dst, const uint32_t offset, const uint32_t len);
+
+            std::vector<uint8_t> encoded;
+            CTAG::SP::HELPERS::ctagSampleCodec::State state;
+            uint32_t block {UINT32_MAX}; // block state belongs to
+        };
+    }
+}
+
+#endif //CTAG_TBD_TEST_CTAGSAMPLECODEC_HPP
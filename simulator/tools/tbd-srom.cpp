@@ -0,0 +1,660 @@
+/***************
+CTAG TBD >>to be determined<< is an open source eurorack synthesizer module.
+
+A project conceived within the Creative Technologies Arbeitsgruppe of
+Kiel University of Applied Sciences: https://www.creative-technologies.de
+
+(c) 2024 by Robert Manzke. All rights reserved.
+
+The CTAG TBD software is licensed under the GNU General Public License
+(GPL 3.0), available here: https://www.gnu.org/licenses/gpl-3.0.txt
+
+The CTAG TBD hardware design is released under the Creative Commons
+Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0).
+Details here: https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+CTAG TBD is provided "as is" without any express or implied warranties.
+
+License and copyright details for specific submodules are included in their
+respective component folders / files if different from this license.
+***************/
+
+// host side sample rom tool
+// packs .wav files / folders into a sample rom file with the same layout as the web UI (sample_rom/readme.md),
+// validates sample rom files, prints slice tables, benchmarks slice reads through ctagSampleRom and exports
+// derived wavetable data (integrated wavetables as calculated by WTOsc, band limited mipmaps)
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstring>
+#include "esp_spi_flash.h"
+#include "helpers/ctagSampleRom.hpp"
+#include "helpers/ctagSampleCodec.hpp"
+#include "helpers/ctagNumUtil.hpp"
+
+using namespace std;
+using namespace CTAG::SP::HELPERS;
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+#define SROM_SAMPLE_RATE 44100
+#define SROM_WT_SIZE 256 // samples per wave
+#define SROM_WT_WAVES 64 // waves per bank
+#define SROM_WT_BANKS 32 // banks in 1MiB wavetable region
+#define SROM_WT_INT_SIZE 260 // integrated wave, see ctagSoundProcessorWTOsc::prepareWavetables
+#define SROM_DEFAULT_SIZE 5242880 // stock config 5MiB
+#define SROM_MIPMAP_LEVELS 8 // level l keeps 128 >> l harmonics, level 0 is the original wave
+#ifndef TBD_BLOCK_SIZE
+#define TBD_BLOCK_SIZE 32
+#endif
+
+struct Wav {
+    uint32_t sampleRate {0};
+    vector<vector<float>> channels;
+};
+
+struct Layout {
+    uint32_t magic {0};
+    uint32_t totalSize {0}; // int16 words of blob
+    uint32_t headerSize {0}; // bytes
+    uint32_t nBanks {0}; // leading wavetable banks
+    vector<uint32_t> offsets, sizes; // decoded samples
+    vector<uint32_t> dataStart, dataWords; // int16 words in blob
+    vector<bool> encoded;
+};
+
+static uint32_t le32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24; }
+
+static uint16_t le16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+static void put32(vector<uint8_t> &d, const uint32_t v) {
+    for (int i = 0; i < 4; i++) d.push_back((v >> (i * 8)) & 0xFF);
+}
+
+static void put16(vector<uint8_t> &d, const uint16_t v) {
+    d.push_back(v & 0xFF);
+    d.push_back(v >> 8);
+}
+
+static bool readFile(const string &path, vector<uint8_t> &d) {
+    ifstream f(path, ios::binary);
+    if (!f) return false;
+    d.assign(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+    return true;
+}
+
+static bool writeFile(const string &path, const vector<uint8_t> &d) {
+    ofstream f(path, ios::binary);
+    if (!f) return false;
+    f.write((const char *) d.data(), d.size());
+    return f.good();
+}
+
+// PCM 8/16/24/32 bit or float 32/64 bit, converted to float like the browser's WebAudio API does
+static bool readWav(const string &path, Wav &wav, string &err) {
+    vector<uint8_t> d;
+    if (!readFile(path, d)) {
+        err = "cannot read file";
+        return false;
+    }
+    if (d.size() < 12 || memcmp(&d[0], "RIFF", 4) != 0 || memcmp(&d[8], "WAVE", 4) != 0) {
+        err = "not a RIFF WAVE file";
+        return false;
+    }
+    uint16_t format = 0, nChannels = 0, bits = 0;
+    const uint8_t *data = nullptr;
+    size_t dataSize = 0;
+    size_t pos = 12;
+    while (pos + 8 <= d.size()) {
+        const uint8_t *chunk = &d[pos];
+        size_t size = le32(&chunk[4]);
+        if (size > d.size() - pos - 8) size = d.size() - pos - 8; // truncated file
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            format = le16(&chunk[8]);
+            nChannels = le16(&chunk[10]);
+            wav.sampleRate = le32(&chunk[12]);
+            bits = le16(&chunk[22]);
+            if (format == 0xFFFE && size >= 40) format = le16(&chunk[32]); // WAVE_FORMAT_EXTENSIBLE sub format
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            data = &chunk[8];
+            dataSize = size;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    if (nChannels == 0 || data == nullptr) {
+        err = "no fmt or data chunk";
+        return false;
+    }
+    if (!(format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) &&
+        !(format == 3 && (bits == 32 || bits == 64))) {
+        err = "unsupported sample format " + to_string(format) + " / " + to_string(bits) + " bits";
+        return false;
+    }
+    const uint32_t bytes = bits / 8;
+    const size_t nFrames = dataSize / (bytes * nChannels);
+    wav.channels.assign(nChannels, vector<float>(nFrames));
+    for (size_t i = 0; i < nFrames; i++) {
+        for (uint32_t c = 0; c < nChannels; c++) {
+            const uint8_t *p = &data[(i * nChannels + c) * bytes];
+            float x;
+            if (format == 3 && bits == 32) {
+                uint32_t u = le32(p);
+                memcpy(&x, &u, 4);
+            } else if (format == 3) {
+                uint64_t u = le32(p) | (uint64_t) le32(&p[4]) << 32;
+                double dx;
+                memcpy(&dx, &u, 8);
+                x = dx;
+            } else if (bits == 8) {
+                x = (p[0] - 128) / 128.f;
+            } else if (bits == 16) {
+                x = (int16_t) le16(p) / 32768.f;
+            } else if (bits == 24) {
+                x = (int32_t) ((p[0] << 8 | p[1] << 16 | (uint32_t) p[2] << 24)) / 2147483648.f;
+            } else {
+                x = (int32_t) le32(p) / 2147483648.f;
+            }
+            wav.channels[c][i] = x;
+        }
+    }
+    return true;
+}
+
+static bool writeWav(const string &path, const vector<int16_t> &samples) {
+    vector<uint8_t> d;
+    const uint32_t dataSize = samples.size() * 2;
+    d.insert(d.end(), {'R', 'I', 'F', 'F'});
+    put32(d, 36 + dataSize);
+    d.insert(d.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    put32(d, 16);
+    put16(d, 1); // PCM
+    put16(d, 1); // mono
+    put32(d, SROM_SAMPLE_RATE);
+    put32(d, SROM_SAMPLE_RATE * 2);
+    put16(d, 2);
+    put16(d, 16);
+    d.insert(d.end(), {'d', 'a', 't', 'a'});
+    put32(d, dataSize);
+    for (int16_t s: samples) put16(d, s);
+    return writeFile(path, d);
+}
+
+// same conversion as the web UI
+static int16_t toRom(float x) {
+    x = x > 1.f ? 1.f : x < -1.f ? -1.f : x;
+    return static_cast<int16_t>(floor(x * 32767.0));
+}
+
+// files as given, .wav files of folders in name order
+static vector<string> expandInputs(const vector<string> &args) {
+    vector<string> files;
+    for (const auto &arg: args) {
+        boost::system::error_code ec;
+        if (!fs::is_directory(arg, ec)) {
+            files.push_back(arg);
+            continue;
+        }
+        vector<string> dir;
+        for (fs::directory_iterator it(arg, ec), end; !ec && it != end; it.increment(ec)) {
+            string ext = it->path().extension().string();
+            transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+            if (fs::is_regular_file(it->path(), ec) && ext == ".wav") dir.push_back(it->path().string());
+        }
+        sort(dir.begin(), dir.end());
+        files.insert(files.end(), dir.begin(), dir.end());
+    }
+    return files;
+}
+
+static bool parseRom(const vector<uint8_t> &d, Layout &l, string &err, vector<string> &warnings) {
+    if (d.size() < 12) {
+        err = "file too small";
+        return false;
+    }
+    l.magic = le32(&d[0]);
+    if (l.magic != SAMPLE_ROM_MAGIC && l.magic != SAMPLE_ROM_MAGIC_ADPCM) {
+        err = "magic number wrong";
+        return false;
+    }
+    l.totalSize = le32(&d[4]);
+    const uint32_t n = le32(&d[8]);
+    const uint32_t tables = l.magic == SAMPLE_ROM_MAGIC_ADPCM ? 2 : 1;
+    if (n > (d.size() - 12) / (4 * tables)) {
+        err = "slice table exceeds file";
+        return false;
+    }
+    l.headerSize = 12 + 4 * n * tables;
+    const size_t dataBytes = d.size() - l.headerSize;
+    if ((size_t) l.totalSize * 2 > dataBytes) {
+        err = "sample data truncated, header claims " + to_string(l.totalSize) + " words, file has " +
+              to_string(dataBytes / 2);
+        return false;
+    }
+    if ((size_t) l.totalSize * 2 < dataBytes)
+        warnings.push_back(to_string(dataBytes - l.totalSize * 2) + " bytes after sample data");
+    l.offsets.resize(n);
+    l.sizes.resize(n);
+    l.dataStart.resize(n);
+    l.dataWords.resize(n);
+    l.encoded.resize(n);
+    uint32_t last = 0, lastData = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const uint32_t end = le32(&d[12 + 4 * i]);
+        if (end < last) {
+            err = "slice " + to_string(i) + " ends before slice " + to_string(i - 1);
+            return false;
+        }
+        l.offsets[i] = last;
+        l.sizes[i] = end - last;
+        last = end;
+        uint32_t dataEnd = end;
+        if (tables == 2) {
+            const uint32_t e = le32(&d[12 + 4 * (n + i)]);
+            l.encoded[i] = (e & SAMPLE_ROM_SLICE_ADPCM) != 0;
+            dataEnd = e & ~SAMPLE_ROM_SLICE_ADPCM;
+        }
+        if (dataEnd < lastData) {
+            err = "data of slice " + to_string(i) + " ends before data of slice " + to_string(i - 1);
+            return false;
+        }
+        l.dataStart[i] = lastData;
+        l.dataWords[i] = dataEnd - lastData;
+        lastData = dataEnd;
+        const uint32_t expected = l.encoded[i] ? ctagSampleCodec::EncodedSize(l.sizes[i]) : l.sizes[i];
+        if (l.dataWords[i] != expected) {
+            err = "slice " + to_string(i) + " has " + to_string(l.dataWords[i]) + " data words, expected " +
+                  to_string(expected);
+            return false;
+        }
+    }
+    if (lastData != l.totalSize) {
+        err = "slices end at word " + to_string(lastData) + ", sample data size is " + to_string(l.totalSize);
+        return false;
+    }
+    // leading banks of 64 unencoded slices of 256 samples, as checked by wavetable plugins
+    l.nBanks = 0;
+    while ((l.nBanks + 1) * SROM_WT_WAVES <= n) {
+        bool isBank = true;
+        for (uint32_t i = l.nBanks * SROM_WT_WAVES; i < (l.nBanks + 1) * SROM_WT_WAVES; i++)
+            if (l.sizes[i] != SROM_WT_SIZE || l.encoded[i]) isBank = false;
+        if (!isBank) break;
+        l.nBanks++;
+    }
+    if (l.nBanks > SROM_WT_BANKS)
+        warnings.push_back("more than " + to_string(SROM_WT_BANKS) + " wavetable banks");
+    for (uint32_t i = 0; i < l.nBanks * SROM_WT_WAVES; i++) {
+        if (l.dataStart[i] != i * SROM_WT_SIZE) {
+            err = "wavetable slice " + to_string(i) + " is not at offset " + to_string(i * SROM_WT_SIZE);
+            return false;
+        }
+    }
+    return true;
+}
+
+// reference decoding of a slice from file data
+static void decodeSlice(const vector<uint8_t> &d, const Layout &l, const uint32_t slice, vector<int16_t> &dst) {
+    dst.resize(l.sizes[slice]);
+    const uint8_t *data = &d[l.headerSize + l.dataStart[slice] * 2];
+    if (!l.encoded[slice]) {
+        for (uint32_t i = 0; i < l.sizes[slice]; i++) dst[i] = (int16_t) le16(&data[i * 2]);
+        return;
+    }
+    for (uint32_t i = 0; i < l.sizes[slice]; i += SAMPLE_ADPCM_BLOCK_SAMPLES) {
+        const uint8_t *block = &data[i / SAMPLE_ADPCM_BLOCK_SAMPLES * SAMPLE_ADPCM_BLOCK_BYTES];
+        ctagSampleCodec::State s;
+        ctagSampleCodec::Begin(s, block);
+        ctagSampleCodec::Decode(&dst[i], block, s, 0, min<uint32_t>(SAMPLE_ADPCM_BLOCK_SAMPLES, l.sizes[slice] - i));
+    }
+}
+
+// same calculation as ctagSoundProcessorWTOsc::prepareWavetables
+static void integrateWave(int16_t *dst, const int16_t *wave) {
+    float fbuffer[SROM_WT_SIZE * 2];
+    float sum4 = wave[0] + wave[1] + wave[2] + wave[3]; // add dc
+    for (int j = 0; j < SROM_WT_SIZE * 2; j++) {
+        fbuffer[j] = wave[j % SROM_WT_SIZE] + sum4;
+    }
+    removeMeanOfFloatArray(fbuffer, SROM_WT_SIZE * 2);
+    scaleFloatArrayToAbsMax(fbuffer, SROM_WT_SIZE * 2);
+    accumulateFloatArray(fbuffer, SROM_WT_SIZE * 2);
+    removeMeanOfFloatArray(fbuffer, SROM_WT_SIZE * 2);
+    for (int j = SROM_WT_SIZE * 2 - SROM_WT_INT_SIZE; j < SROM_WT_SIZE * 2; j++) {
+        *dst++ = static_cast<int16_t>(roundf(fbuffer[j] * 4.f * 32768.f / 256.f));
+    }
+}
+
+// band limits wave to nHarmonics by dft
+static void bandLimitWave(int16_t *dst, const int16_t *wave, const uint32_t nHarmonics) {
+    static double cosTable[SROM_WT_SIZE], sinTable[SROM_WT_SIZE];
+    if (cosTable[0] == 0.0) {
+        for (int i = 0; i < SROM_WT_SIZE; i++) {
+            cosTable[i] = cos(2.0 * M_PI * i / SROM_WT_SIZE);
+            sinTable[i] = sin(2.0 * M_PI * i / SROM_WT_SIZE);
+        }
+    }
+    double re[SROM_WT_SIZE / 2 + 1], im[SROM_WT_SIZE / 2 + 1];
+    for (uint32_t k = 0; k <= nHarmonics; k++) {
+        re[k] = im[k] = 0.0;
+        for (int i = 0; i < SROM_WT_SIZE; i++) {
+            re[k] += wave[i] * cosTable[(k * i) % SROM_WT_SIZE];
+            im[k] += wave[i] * sinTable[(k * i) % SROM_WT_SIZE];
+        }
+    }
+    for (int i = 0; i < SROM_WT_SIZE; i++) {
+        double x = re[0];
+        for (uint32_t k = 1; k <= nHarmonics; k++) {
+            const double w = k == SROM_WT_SIZE / 2 ? 1.0 : 2.0; // nyquist bin has no mirror
+            x += w * (re[k] * cosTable[(k * i) % SROM_WT_SIZE] + im[k] * sinTable[(k * i) % SROM_WT_SIZE]);
+        }
+        x = round(x / SROM_WT_SIZE);
+        dst[i] = x > 32767.0 ? 32767 : x < -32768.0 ? -32768 : (int16_t) x;
+    }
+}
+
+static int pack(const vector<string> &wtInputs, const vector<string> &sampleInputs, const string &outFile,
+                const bool bCompress, const uint32_t romSize) {
+    vector<int16_t> blob;
+    vector<uint32_t> ends, dataEnds; // dataEnds with encoding flag
+    uint32_t offset = 0, nBanks = 0, nSampleSlices = 0, nSamples = 0;
+    for (const auto &file: expandInputs(wtInputs)) {
+        Wav wav;
+        string err;
+        if (!readWav(file, wav, err)) {
+            cerr << file << ": " << err << endl;
+            return 1;
+        }
+        if (wav.channels.size() != 1 || wav.channels[0].size() != SROM_WT_SIZE * SROM_WT_WAVES) {
+            cerr << file << ": invalid wavetable file, must be mono " << SROM_WT_SIZE * SROM_WT_WAVES
+                 << " samples" << endl;
+            return 1;
+        }
+        const uint32_t dataStart = blob.size();
+        for (float x: wav.channels[0]) blob.push_back(toRom(x));
+        for (uint32_t j = 0; j < SROM_WT_WAVES; j++) {
+            offset += SROM_WT_SIZE;
+            ends.push_back(offset);
+            dataEnds.push_back(dataStart + (j + 1) * SROM_WT_SIZE);
+        }
+        cout << "bank " << nBanks++ << ": " << file << endl;
+    }
+    for (const auto &file: expandInputs(sampleInputs)) {
+        Wav wav;
+        string err;
+        if (!readWav(file, wav, err)) {
+            cerr << file << ": " << err << endl;
+            return 1;
+        }
+        if (wav.sampleRate != SROM_SAMPLE_RATE) {
+            cerr << file << ": sample rate is " << wav.sampleRate << "Hz, resample to " << SROM_SAMPLE_RATE
+                 << "Hz first" << endl;
+            return 1;
+        }
+        // stereo files are stored as subsequent slices, left first
+        for (const auto &channel: wav.channels) {
+            vector<int16_t> a(channel.size());
+            transform(channel.begin(), channel.end(), a.begin(), toRom);
+            if (bCompress) {
+                const uint32_t start = blob.size();
+                blob.resize(start + ctagSampleCodec::EncodedSize(a.size()));
+                ctagSampleCodec::Encode((uint8_t *) &blob[start], a.data(), a.size());
+                dataEnds.push_back(blob.size() | SAMPLE_ROM_SLICE_ADPCM);
+            } else {
+                blob.insert(blob.end(), a.begin(), a.end());
+                dataEnds.push_back(blob.size());
+            }
+            offset += a.size();
+            ends.push_back(offset);
+            nSamples += a.size();
+        }
+        cout << "slice " << ends.size() - wav.channels.size() << (wav.channels.size() > 1 ? " (stereo)" : "")
+             << ": " << file << endl;
+        nSampleSlices += wav.channels.size();
+    }
+    if (nBanks > SROM_WT_BANKS)
+        cout << "Warning: " << nBanks << " wavetable banks exceed the 1MiB wavetable region" << endl;
+
+    vector<uint8_t> d;
+    put32(d, bCompress ? SAMPLE_ROM_MAGIC_ADPCM : SAMPLE_ROM_MAGIC);
+    put32(d, blob.size());
+    put32(d, ends.size());
+    for (uint32_t e: ends) put32(d, e);
+    if (bCompress) for (uint32_t e: dataEnds) put32(d, e);
+    for (int16_t s: blob) put16(d, s);
+    cout << ends.size() << " slices (" << nBanks << " wavetable banks, " << nSampleSlices << " sample slices, "
+         << fixed << setprecision(1) << (float) nSamples / SROM_SAMPLE_RATE << "s), " << d.size() << " of "
+         << romSize << " bytes (" << 100.f * d.size() / romSize << "%)" << endl;
+    if (d.size() > romSize) {
+        cerr << "Sample rom does not fit into " << romSize << " bytes" << endl;
+        return 1;
+    }
+    if (!writeFile(outFile, d)) {
+        cerr << "Cannot write " << outFile << endl;
+        return 1;
+    }
+    cout << "Written " << outFile << endl;
+    return 0;
+}
+
+static void printTable(const Layout &l) {
+    const uint32_t n = l.sizes.size();
+    cout << "format: " << (l.magic == SAMPLE_ROM_MAGIC_ADPCM ? "int16 / IMA-ADPCM" : "int16") << endl;
+    cout << "slices: " << n << ", wavetable banks: " << l.nBanks << ", header: " << l.headerSize
+         << " bytes, sample data: " << l.totalSize * 2 << " bytes" << endl;
+    cout << setw(9) << "slice" << setw(10) << "offset" << setw(10) << "length" << setw(9) << "seconds"
+         << setw(10) << "data" << setw(10) << "words" << setw(8) << "coding" << endl;
+    for (uint32_t b = 0; b < l.nBanks; b++) {
+        const uint32_t i = b * SROM_WT_WAVES;
+        cout << setw(4) << i << "-" << setw(4) << left << i + SROM_WT_WAVES - 1 << right << setw(10) << l.offsets[i]
+             << setw(10) << SROM_WT_SIZE * SROM_WT_WAVES << setw(9) << "-" << setw(10) << l.dataStart[i]
+             << setw(10) << SROM_WT_SIZE * SROM_WT_WAVES << setw(8) << "int16" << "  wavetable bank " << b << endl;
+    }
+    for (uint32_t i = l.nBanks * SROM_WT_WAVES; i < n; i++) {
+        cout << setw(9) << i << setw(10) << l.offsets[i] << setw(10) << l.sizes[i] << setw(9) << fixed
+             << setprecision(3) << (float) l.sizes[i] / SROM_SAMPLE_RATE << setw(10) << l.dataStart[i] << setw(10)
+             << l.dataWords[i] << setw(8) << (l.encoded[i] ? "adpcm" : "int16") << endl;
+    }
+}
+
+// reads all slices through ctagSampleRom as plugins do and compares to reference decoding
+static bool crossCheck(const string &file, const vector<uint8_t> &d, const Layout &l) {
+    spi_flash_emu_init(file.c_str());
+    bool good = true;
+    {
+        ctagSampleRom rom;
+        if (rom.GetNumberSlices() != l.sizes.size()) {
+            cerr << "ctagSampleRom reads " << rom.GetNumberSlices() << " slices" << endl;
+            good = false;
+        }
+        vector<int16_t> ref, buf;
+        for (uint32_t i = 0; good && i < l.sizes.size(); i++) {
+            if (rom.GetSliceSize(i) != l.sizes[i] || rom.GetSliceOffset(i) != l.offsets[i]) {
+                cerr << "ctagSampleRom reads slice " << i << " at " << rom.GetSliceOffset(i) << " size "
+                     << rom.GetSliceSize(i) << endl;
+                good = false;
+                break;
+            }
+            decodeSlice(d, l, i, ref);
+            buf.assign(ref.size(), 0);
+            rom.ReadSlice(buf.data(), i, 0, buf.size());
+            if (buf != ref) {
+                cerr << "ctagSampleRom reads wrong data of slice " << i << endl;
+                good = false;
+            }
+        }
+    }
+    spi_flash_emu_release();
+    return good;
+}
+
+static void benchmark(const string &file, const Layout &l) {
+    using clock = chrono::steady_clock;
+    spi_flash_emu_init(file.c_str());
+    {
+        ctagSampleRom rom;
+        cout << "benchmark, block size " << TBD_BLOCK_SIZE << (rom.IsMapped() ? ", memory mapped" : "") << endl;
+        int16_t buf[TBD_BLOCK_SIZE];
+        float fbuf[TBD_BLOCK_SIZE];
+        mt19937 rng(1);
+        for (int coding = 0; coding < 2; coding++) {
+            vector<uint32_t> slices;
+            uint64_t nSamples = 0;
+            for (uint32_t i = l.nBanks * SROM_WT_WAVES; i < l.sizes.size(); i++) {
+                if (l.encoded[i] != (coding == 1) || l.sizes[i] == 0) continue;
+                slices.push_back(i);
+                nSamples += l.sizes[i];
+            }
+            if (slices.empty()) continue;
+            // sequential playback, random access as with modulated slice / start positions
+            for (int mode = 0; mode < 3; mode++) {
+                uint64_t nBlocks = 0;
+                auto start = clock::now();
+                if (mode < 2) {
+                    for (uint32_t i: slices) {
+                        for (uint32_t pos = 0; pos < l.sizes[i]; pos += TBD_BLOCK_SIZE, nBlocks++) {
+                            if (mode == 0) rom.ReadSlice(buf, i, pos, TBD_BLOCK_SIZE);
+                            else rom.ReadSliceAsFloat(fbuf, i, pos, TBD_BLOCK_SIZE);
+                        }
+                    }
+                } else {
+                    const uint64_t n = nSamples / TBD_BLOCK_SIZE;
+                    for (; nBlocks < n; nBlocks++) {
+                        const uint32_t i = slices[rng() % slices.size()];
+                        rom.ReadSlice(buf, i, rng() % l.sizes[i], TBD_BLOCK_SIZE);
+                    }
+                }
+                const double us = chrono::duration<double, micro>(clock::now() - start).count();
+                cout << setw(6) << (coding ? "adpcm" : "int16") << setw(12)
+                     << (mode == 0 ? "sequential" : mode == 1 ? "float" : "random") << ": " << fixed
+                     << setprecision(1) << nBlocks * TBD_BLOCK_SIZE / us << " Msamples/s, " << setprecision(3)
+                     << us / nBlocks << "us per block" << endl;
+            }
+        }
+        if (l.nBanks > 0) {
+            vector<int16_t> bank(SROM_WT_SIZE * SROM_WT_WAVES);
+            int16_t wave[SROM_WT_INT_SIZE];
+            auto start = clock::now();
+            for (uint32_t b = 0; b < l.nBanks; b++) {
+                ctagSampleRom::Read(bank.data(), b * SROM_WT_SIZE * SROM_WT_WAVES, bank.size());
+                for (uint32_t i = 0; i < SROM_WT_WAVES; i++) integrateWave(wave, &bank[i * SROM_WT_SIZE]);
+            }
+            const double us = chrono::duration<double, micro>(clock::now() - start).count();
+            cout << "wavetable bank integration: " << fixed << setprecision(1) << us / l.nBanks << "us per bank"
+                 << endl;
+        }
+    }
+    spi_flash_emu_release();
+}
+
+static bool exportWavetables(const vector<uint8_t> &d, const Layout &l, const string &dir) {
+    boost::system::error_code ec;
+    fs::create_directories(dir, ec);
+    for (uint32_t b = 0; b < l.nBanks; b++) {
+        vector<int16_t> bank;
+        for (uint32_t i = 0; i < SROM_WT_WAVES; i++) {
+            vector<int16_t> wave;
+            decodeSlice(d, l, b * SROM_WT_WAVES + i, wave);
+            bank.insert(bank.end(), wave.begin(), wave.end());
+        }
+        char name[32];
+        // integrated waves as int16 raw data, layout of WTOsc's wavetable buffer
+        vector<uint8_t> integrated;
+        int16_t wave[SROM_WT_INT_SIZE];
+        for (uint32_t i = 0; i < SROM_WT_WAVES; i++) {
+            integrateWave(wave, &bank[i * SROM_WT_SIZE]);
+            for (int16_t s: wave) put16(integrated, s);
+        }
+        snprintf(name, sizeof(name), "bank%02u-integrated.raw", b);
+        if (!writeFile((fs::path(dir) / name).string(), integrated)) return false;
+        // mipmap levels are wavetable files again and can be packed into a sample rom
+        for (uint32_t level = 1; level < SROM_MIPMAP_LEVELS; level++) {
+            vector<int16_t> mip(bank.size());
+            for (uint32_t i = 0; i < SROM_WT_WAVES; i++)
+                bandLimitWave(&mip[i * SROM_WT_SIZE], &bank[i * SROM_WT_SIZE], (SROM_WT_SIZE / 2) >> level);
+            snprintf(name, sizeof(name), "bank%02u-mip%u.wav", b, level);
+            if (!writeWav((fs::path(dir) / name).string(), mip)) return false;
+        }
+    }
+    cout << "Exported " << l.nBanks << " wavetable banks to " << dir << endl;
+    return true;
+}
+
+static int inspect(const string &file, const bool bTable, const bool bBench, const string &exportDir) {
+    vector<uint8_t> d;
+    if (!readFile(file, d)) {
+        cerr << "Cannot read " << file << endl;
+        return 1;
+    }
+    Layout l;
+    string err;
+    vector<string> warnings;
+    if (!parseRom(d, l, err, warnings)) {
+        cerr << file << ": " << err << endl;
+        return 1;
+    }
+    if (bTable) {
+        cout << file << endl;
+        printTable(l);
+    }
+    for (const auto &w: warnings) cout << "Warning: " << w << endl;
+    if (!crossCheck(file, d, l)) return 1;
+    cout << file << ": valid, " << l.sizes.size() << " slices" << endl;
+    if (bBench) benchmark(file, l);
+    if (!exportDir.empty() && !exportWavetables(d, l, exportDir)) {
+        cerr << "Cannot export to " << exportDir << endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int ac, char **av) {
+    // parse command line args
+    vector<string> wtInputs, sampleInputs;
+    string outFile, infoFile, exportDir;
+    bool bCompress = false, bBench = false;
+    uint32_t romSize = SROM_DEFAULT_SIZE;
+    po::options_description desc(string(av[0]) + " options");
+    po::variables_map vm;
+    try {
+        desc.add_options()
+                ("help,h", "this help message")
+                ("wavetables,w", po::value<vector<string>>(&wtInputs)->multitoken(),
+                 "wavetable .wav files or folders (mono, 64 waves of 256 samples), packed first, one bank each")
+                ("samples,a", po::value<vector<string>>(&sampleInputs)->multitoken(),
+                 "sample .wav files or folders (44.1kHz), stereo files are split into left and right slice")
+                ("output,o", po::value<string>(&outFile), "pack wavetables and samples into sample rom file (arg)")
+                ("compress,c", po::bool_switch(&bCompress)->default_value(false),
+                 "IMA-ADPCM encode sample slices, wavetables are not compressed")
+                ("size", po::value<uint32_t>(&romSize)->default_value(SROM_DEFAULT_SIZE),
+                 "sample rom flash size in bytes, default 5242880 (5MiB)")
+                ("info,i", po::value<string>(&infoFile), "validate sample rom file (arg) and print slice table")
+                ("bench,b", po::bool_switch(&bBench)->default_value(false),
+                 "with -i, benchmark slice reads and wavetable integration")
+                ("export,x", po::value<string>(&exportDir),
+                 "with -i, write integrated wavetables and mipmaps of wavetable banks to folder (arg)");
+
+        po::store(po::parse_command_line(ac, av, desc), vm);
+        po::notify(vm);
+    } catch (const po::error &e) {
+        cout << e.what() << endl;
+        cout << desc << endl;
+        return 1;
+    }
+    if (vm.count("help") || (outFile.empty() && infoFile.empty())) {
+        cout << desc << "\n";
+        return 1;
+    }
+    if (!outFile.empty()) {
+        if (pack(wtInputs, sampleInputs, outFile, bCompress, romSize) != 0) return 1;
+        if (infoFile.empty()) return inspect(outFile, false, false, "");
+    }
+    return inspect(infoFile, true, bBench, exportDir);
+}
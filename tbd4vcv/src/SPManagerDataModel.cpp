@@ -29,6 +29,7 @@ respective component folders / files if different from this license.
 #include <dirent.h>
 #include "esp_log.h"
 #include "ctagResources.hpp"
+#include "ctagSPPresetStore.hpp"
 
 using namespace CTAG::AUDIO;
 
@@ -261,7 +262,9 @@ void SPManagerDataModel::SetJSONSoundProcessorPreset(const string &id, const str
     ESP_LOGD("Model", "String %s", data.c_str());
     Document presets;
     presets.Parse(data);
-    storeJSON(presets, string(CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-" + id + ".jsn"));
+    const string fn = CTAG::RESOURCES::spiffsRoot + "/data/sp/mp-" + id + ".jsn";
+    storeJSON(presets, fn);
+    CTAG::SP::ctagSPPresetStore::Invalidate(fn); // binary presets are rebuilt from new json on next access
 }
 
 bool SPManagerDataModel::HasPluginID(const string &id) {